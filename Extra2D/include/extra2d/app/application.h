@@ -6,12 +6,14 @@
 #include <extra2d/config/config_manager.h>
 #include <extra2d/config/module_config.h>
 #include <extra2d/platform/iwindow.h>
+#include <memory>
 #include <string>
 
 namespace extra2d {
 
 class IInput;
 class RenderBackend;
+class RenderThread;
 
 /**
  * @brief 应用程序类
@@ -97,6 +99,15 @@ public:
      */
     RenderBackend& renderer();
 
+    /**
+     * @brief 获取渲染线程
+     * @return 流水线模式（RenderModuleConfig::renderThread）运行中返回渲染线程，否则返回 nullptr
+     *
+     * 流水线模式下图形上下文归渲染线程所有，创建或销毁 GPU 资源须经
+     * RenderThread::invoke() 执行
+     */
+    RenderThread* renderThread() const { return renderThread_.get(); }
+
     /**
      * @brief 获取输入接口
      * @return 输入接口引用
@@ -213,7 +224,30 @@ private:
      */
     void render();
 
+    /**
+     * @brief 立即模式渲染：直接调用渲染器绘制当前场景并交换缓冲区
+     * @param renderer 渲染后端，须在图形上下文所在线程调用
+     */
+    void renderImmediate(RenderBackend& renderer);
+
+    /**
+     * @brief 流水线模式渲染：录制命令并提交给渲染线程
+     */
+    void submitFrame();
+
+    /**
+     * @brief 按相机服务更新场景的剔除区域
+     * @param scene 当前场景
+     */
+    void updateCullRect(const Ptr<class Scene>& scene);
+
+    /**
+     * @brief 按渲染配置启动渲染线程
+     */
+    void startRenderThread();
+
     IWindow* window_ = nullptr;
+    std::unique_ptr<RenderThread> renderThread_;
 
     bool initialized_ = false;
     bool running_ = false;
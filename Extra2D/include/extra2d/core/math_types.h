@@ -315,6 +315,75 @@ struct Transform2D {
   Transform2D inverse() const { return Transform2D(glm::inverse(matrix)); }
 };
 
+// ---------------------------------------------------------------------------
+// 2D 仿射变换（2x3，列主序）
+//   x' = a * x + c * y + tx
+//   y' = b * x + d * y + ty
+// 可表示平移、旋转、缩放与斜切，直接变换顶点，无需分解
+// ---------------------------------------------------------------------------
+struct Affine2D {
+  float a = 1.0f, b = 0.0f;   // 第一列（局部 X 轴）
+  float c = 0.0f, d = 1.0f;   // 第二列（局部 Y 轴）
+  float tx = 0.0f, ty = 0.0f; // 平移
+
+  constexpr Affine2D() = default;
+  constexpr Affine2D(float a, float b, float c, float d, float tx, float ty)
+      : a(a), b(b), c(c), d(d), tx(tx), ty(ty) {}
+
+  static constexpr Affine2D identity() { return Affine2D{}; }
+
+  /// 从 2D 变换的 4x4 矩阵中提取仿射部分（忽略 Z 与透视分量）
+  static Affine2D fromMat4(const glm::mat4 &m) {
+    return {m[0][0], m[0][1], m[1][0], m[1][1], m[3][0], m[3][1]};
+  }
+
+  glm::mat4 toMat4() const {
+    glm::mat4 m(1.0f);
+    m[0][0] = a;
+    m[0][1] = b;
+    m[1][0] = c;
+    m[1][1] = d;
+    m[3][0] = tx;
+    m[3][1] = ty;
+    return m;
+  }
+
+  Vec2 transformPoint(const Vec2 &p) const {
+    return {a * p.x + c * p.y + tx, b * p.x + d * p.y + ty};
+  }
+
+  /// 变换方向向量（不含平移）
+  Vec2 transformVector(const Vec2 &v) const {
+    return {a * v.x + c * v.y, b * v.x + d * v.y};
+  }
+
+  float determinant() const { return a * d - b * c; }
+
+  /// 逆变换；不可逆（行列式为 0）时返回单位变换
+  Affine2D inverse() const {
+    float det = determinant();
+    if (det == 0.0f) {
+      return identity();
+    }
+    float inv = 1.0f / det;
+    float ia = d * inv, ib = -b * inv, ic = -c * inv, id = a * inv;
+    return {ia, ib, ic, id, -(ia * tx + ic * ty), -(ib * tx + id * ty)};
+  }
+
+  bool operator==(const Affine2D &o) const {
+    return a == o.a && b == o.b && c == o.c && d == o.d && tx == o.tx &&
+           ty == o.ty;
+  }
+  bool operator!=(const Affine2D &o) const { return !(*this == o); }
+
+  /// 组合变换：先应用 other，再应用 this
+  Affine2D operator*(const Affine2D &other) const {
+    return {a * other.a + c * other.b,         b * other.a + d * other.b,
+            a * other.c + c * other.d,         b * other.c + d * other.d,
+            a * other.tx + c * other.ty + tx,  b * other.tx + d * other.ty + ty};
+  }
+};
+
 // ---------------------------------------------------------------------------
 // 数学工具函数
 // ---------------------------------------------------------------------------
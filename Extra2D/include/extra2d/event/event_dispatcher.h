@@ -19,6 +19,8 @@ using ListenerId = uint64_t;
 class EventDispatcher {
 public:
   using EventCallback = std::function<void(Event &)>;
+  // 监听器总数在 0 与非 0 之间变化时调用，参数为变化后是否有监听器
+  using PresenceCallback = std::function<void(bool)>;
 
   EventDispatcher();
   ~EventDispatcher() = default;
@@ -40,7 +42,15 @@ public:
 
   // 统计
   size_t getListenerCount(EventType type) const;
-  size_t getTotalListenerCount() const;
+  size_t getTotalListenerCount() const { return totalCount_; }
+  bool hasListeners() const { return totalCount_ != 0; }
+
+  /**
+   * @brief 设置监听器有无变化的回调（供持有者维护缓存状态）
+   */
+  void setPresenceCallback(PresenceCallback callback) {
+    presenceCallback_ = std::move(callback);
+  }
 
 private:
   struct Listener {
@@ -49,8 +59,12 @@ private:
     EventCallback callback;
   };
 
+  void setTotalCount(size_t count);
+
   std::unordered_map<EventType, std::vector<Listener>> listeners_;
   ListenerId nextId_;
+  size_t totalCount_ = 0;
+  PresenceCallback presenceCallback_;
 };
 
 } // namespace extra2d
@@ -39,8 +39,37 @@ public:
   void setViewport(const Rect &rect);
   Rect getViewport() const;
 
+  /**
+   * @brief 获取可见区域在世界坐标系中的轴对齐包围盒（含缩放与旋转）
+   */
+  Rect getVisibleRect() const;
+
+  /**
+   * @brief 由视图-投影矩阵计算可见区域的世界坐标包围盒
+   * @param viewProjection 视图-投影矩阵
+   * @return NDC 四角反投影后的轴对齐包围盒
+   */
+  static Rect computeVisibleRect(const glm::mat4 &viewProjection);
+  static Rect computeVisibleRect(const Affine2D &viewProjection);
+
+  /**
+   * @brief 计算每屏幕像素对应的世界单位（两轴取较大者）
+   * @param viewProjection 视图-投影变换
+   * @param viewportSize 视口像素尺寸
+   * @return 世界单位；视口尺寸无效时返回1
+   */
+  static float computeUnitsPerPixel(const Affine2D &viewProjection,
+                                    const Size &viewportSize);
+
+  // ------------------------------------------------------------------------
+  // 仿射变换获取（CPU 侧的坐标转换与剔除使用）
+  // ------------------------------------------------------------------------
+  const Affine2D &getViewTransform() const;
+  const Affine2D &getProjectionTransform() const;
+  Affine2D getViewProjectionTransform() const;
+
   // ------------------------------------------------------------------------
-  // 矩阵获取
+  // 矩阵获取（提交给 GPU 时使用，由仿射变换转换而来）
   // ------------------------------------------------------------------------
   glm::mat4 getViewMatrix() const;
   glm::mat4 getProjectionMatrix() const;
@@ -101,9 +130,8 @@ private:
 
   ViewportAdapter *viewportAdapter_ = nullptr;
 
-  mutable glm::mat4 viewMatrix_;
-  mutable glm::mat4 projMatrix_;
-  mutable glm::mat4 vpMatrix_;
+  mutable Affine2D viewTransform_;
+  mutable Affine2D projTransform_;
   mutable bool viewDirty_ = true;
   mutable bool projDirty_ = true;
 };
@@ -1,6 +1,10 @@
 #pragma once
 
 #include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
 
 namespace extra2d {
 
@@ -8,10 +12,18 @@ namespace extra2d {
 // GPU 上下文状态管理器
 // 用于跟踪 OpenGL/Vulkan 等 GPU 上下文的生命周期状态
 // 确保在 GPU 资源析构时能安全地检查上下文是否有效
+//
+// 上下文归属：上下文移交给其他线程（如渲染线程）后，GPU 资源的创建与上传
+// 经 runOnOwner() 在所属线程同步执行；资源可能在任意线程析构，其 GPU 对象
+// 经 releaseOnOwner() 排队，由所属线程在帧执行完毕后 drainReleases() 释放。
+// 未设置所属线程时两者都直接在调用线程执行
 // ============================================================================
 
 class GPUContext {
 public:
+    /// 在所属线程上同步执行任务的执行器
+    using Invoker = std::function<void(const std::function<void()>&)>;
+
     /// 获取单例实例
     static GPUContext& get();
 
@@ -24,6 +36,42 @@ public:
     /// 检查 GPU 上下文是否有效
     bool isValid() const;
 
+    /**
+     * @brief 设置上下文的所属线程（上下文移交后调用）
+     * @param owner 上下文当前所在的线程
+     * @param invoker 在该线程上同步执行任务的执行器
+     */
+    void setOwner(std::thread::id owner, Invoker invoker);
+
+    /**
+     * @brief 清除所属线程（上下文交还调用线程后调用）
+     */
+    void clearOwner();
+
+    /**
+     * @brief 调用线程能否直接发出 GPU 调用
+     * @return 未设置所属线程或调用线程即所属线程时返回true
+     */
+    bool isOwnerThread() const;
+
+    /**
+     * @brief 在所属线程上执行任务并等待完成
+     * @param task 发出 GPU 调用的任务，调用线程即所属线程时直接执行
+     */
+    void runOnOwner(const std::function<void()>& task);
+
+    /**
+     * @brief 释放 GPU 对象
+     * @param release 释放任务；调用线程即所属线程时直接执行，否则排队
+     *                到所属线程下次 drainReleases()，任务须自行检查 isValid()
+     */
+    void releaseOnOwner(std::function<void()> release);
+
+    /**
+     * @brief 执行排队的释放任务（所属线程在帧执行完毕后调用）
+     */
+    void drainReleases();
+
 private:
     GPUContext() = default;
     ~GPUContext() = default;
@@ -31,6 +79,12 @@ private:
     GPUContext& operator=(const GPUContext&) = delete;
 
     std::atomic<bool> valid_{false};
+
+    mutable std::mutex mutex_;
+    std::thread::id owner_;  // 默认值表示未设置
+    Invoker invoker_;
+    std::vector<std::function<void()>> pendingReleases_;
+    std::vector<std::function<void()>> drainingReleases_;
 };
 
 } // namespace extra2d
@@ -62,6 +62,7 @@ private:
 
   void createAtlas();
   void cacheGlyph(char32_t codepoint) const;
+  void uploadGlyph(int x, int y, int w, int h) const;
 };
 
 } // namespace extra2d
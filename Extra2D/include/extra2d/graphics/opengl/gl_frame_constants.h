@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include <glad/glad.h>
+#include <glm/mat4x4.hpp>
+#include <glm/vec2.hpp>
+
+namespace extra2d {
+
+// ============================================================================
+// 帧常量 uniform 缓冲（std140）
+// 视图投影、时间、视口尺寸与像素缩放每帧（或相机变化时）上传一次，
+// 所有链接了 FrameConstants 块的着色器共享同一绑定点，绘制时不再逐个设置 uniform
+// ============================================================================
+class GLFrameConstants {
+public:
+  /// uniform 块绑定点
+  static constexpr GLuint BINDING = 0;
+  /// GLSL 中的块名
+  static constexpr const char *BLOCK_NAME = "FrameConstants";
+  /// 内嵌着色器使用的块声明，与 shaders/common/frame_constants.glsl 保持一致
+  static const char *const GLSL_BLOCK;
+
+  // std140 布局：mat4 占 64 字节，vec2 按 8 字节对齐，随后两个 float
+  struct Data {
+    glm::mat4 viewProjection;
+    glm::vec2 viewportSize;
+    float time;
+    float pixelScale; // 每世界单位对应的像素数
+  };
+  static_assert(sizeof(Data) == 80, "FrameConstants must match std140 layout");
+  static_assert(offsetof(Data, viewportSize) == 64 &&
+                    offsetof(Data, time) == 72 &&
+                    offsetof(Data, pixelScale) == 76,
+                "FrameConstants member offsets must match std140 layout");
+
+  /// 获取单例实例
+  static GLFrameConstants &get();
+
+  /// 创建 uniform 缓冲并绑定到 BINDING
+  bool init();
+  void shutdown();
+  bool isReady() const { return ubo_ != 0; }
+
+  // 以下设置只修改 CPU 副本，值变化时标记为脏
+  void setViewProjection(const glm::mat4 &viewProjection);
+  void setViewportSize(float width, float height);
+  void setTime(float seconds);
+
+  /// 与 GPU 上的副本不一致（下一次 upload() 会上传）
+  bool isDirty() const { return dirty_; }
+  /// 有变化时上传到 GPU，绘制前调用；未变化时为空操作
+  void upload();
+
+  const Data &getData() const { return data_; }
+  uint32_t getUploadCount() const { return uploadCount_; }
+  void resetUploadCount() { uploadCount_ = 0; }
+
+  /**
+   * @brief 将程序中的 FrameConstants 块绑定到 BINDING
+   * @param program 已链接的程序对象，不含该块时忽略
+   */
+  static void bindProgram(GLuint program);
+
+private:
+  GLFrameConstants();
+  GLFrameConstants(const GLFrameConstants &) = delete;
+  GLFrameConstants &operator=(const GLFrameConstants &) = delete;
+
+  GLuint ubo_;
+  Data data_;
+  bool dirty_;
+  uint32_t uploadCount_;
+};
+
+} // namespace extra2d
@@ -1,8 +1,12 @@
 #pragma once
 
+#include <extra2d/graphics/opengl/gl_sdf_shape_batch.h>
 #include <extra2d/graphics/opengl/gl_sprite_batch.h>
+#include <extra2d/graphics/polygon_triangulator.h>
+#include <extra2d/graphics/polyline_tessellator.h>
 #include <extra2d/graphics/render_backend.h>
 #include <extra2d/graphics/shader_interface.h>
+#include <extra2d/graphics/unit_circle.h>
 
 #include <array>
 #include <glad/glad.h>
@@ -28,14 +32,15 @@ public:
   void endFrame() override;
   void setViewport(int x, int y, int width, int height) override;
   void setVSync(bool enabled) override;
+  void setFrameTime(float seconds) override;
 
   void setBlendMode(BlendMode mode) override;
   void setViewProjection(const glm::mat4 &matrix) override;
 
-  // 变换矩阵栈
-  void pushTransform(const glm::mat4 &transform) override;
+  // 变换栈
+  void pushTransform(const Affine2D &transform) override;
   void popTransform() override;
-  glm::mat4 getCurrentTransform() const override;
+  Affine2D getCurrentTransform() const override;
 
   Ptr<Texture> createTexture(int width, int height, const uint8_t *pixels,
                              int channels) override;
@@ -47,6 +52,9 @@ public:
                   const Vec2 &anchor) override;
   void drawSprite(const Texture &texture, const Vec2 &position,
                   const Color &tint) override;
+  void drawSprite(const Texture &texture, const Affine2D &transform,
+                  const Size &size, const Rect &srcRect, const Color &tint,
+                  const Vec2 &anchor) override;
   void endSpriteBatch() override;
 
   void drawLine(const Vec2 &start, const Vec2 &end, const Color &color,
@@ -63,8 +71,21 @@ public:
                     const Color &color) override;
   void drawPolygon(const std::vector<Vec2> &points, const Color &color,
                    float width) override;
+  void drawPolyline(const std::vector<Vec2> &points, const Color &color,
+                    float width, bool closed, LineJoin join) override;
   void fillPolygon(const std::vector<Vec2> &points,
                    const Color &color) override;
+  void fillPolygonMesh(const Vec2 *points, size_t pointCount,
+                       const uint32_t *indices, size_t indexCount,
+                       const Color &color) override;
+
+  bool supportsShapeSDF() const override { return sdfShapesEnabled_; }
+  void drawCircleSDF(const Vec2 &center, float radius, const Color &color,
+                     float thickness) override;
+  void drawRoundedRectSDF(const Rect &rect, float cornerRadius,
+                          const Color &color, float thickness) override;
+  void drawCapsuleSDF(const Vec2 &start, const Vec2 &end, float radius,
+                      const Color &color, float thickness) override;
 
   Ptr<FontAtlas> createFontAtlas(const std::string &filepath, int fontSize,
                                  bool useSDF = false) override;
@@ -73,14 +94,23 @@ public:
   void drawText(const FontAtlas &font, const std::string &text, float x,
                 float y, const Color &color) override;
 
-  Stats getStats() const override { return stats_; }
+  Stats getStats() const override;
   void resetStats() override;
 
+  // 精灵批处理配置，需在 init() 之前设置
+  void setSpriteBatchConfig(const SpriteBatchConfig &config) {
+    spriteBatchConfig_ = config;
+  }
+  const SpriteBatchConfig &getSpriteBatchConfig() const {
+    return spriteBatchConfig_;
+  }
+
 private:
   // 形状批处理常量
-  static constexpr size_t MAX_CIRCLE_SEGMENTS = 128;
+  static constexpr int MAX_CIRCLE_SEGMENTS = UnitCircleCache::MAX_SEGMENTS;
+  // 视口未知时自动 LOD 使用的分段数
+  static constexpr int DEFAULT_CIRCLE_SEGMENTS = 32;
   static constexpr size_t MAX_SHAPE_VERTICES = 8192; // 最大形状顶点数
-  static constexpr size_t MAX_LINE_VERTICES = 16384; // 最大线条顶点数
 
   // 形状顶点结构（包含颜色）
   struct ShapeVertex {
@@ -90,31 +120,44 @@ private:
 
   IWindow* window_;
   GLSpriteBatch spriteBatch_;
+  SpriteBatchConfig spriteBatchConfig_;
   Ptr<IShader> shapeShader_;
 
   GLuint shapeVao_;
   GLuint shapeVbo_;
-  GLuint lineVao_; // 线条专用 VAO
-  GLuint lineVbo_; // 线条专用 VBO
 
   glm::mat4 viewProjection_;
-  std::vector<glm::mat4> transformStack_;
+  std::vector<Affine2D> transformStack_;
   Stats stats_;
   bool vsync_;
 
-  // 形状批处理缓冲区（预分配，避免每帧内存分配）
-  std::array<ShapeVertex, MAX_SHAPE_VERTICES> shapeVertexCache_;
+  // 形状批处理缓冲区（init 时在堆上预分配，避免每帧内存分配）
+  std::vector<ShapeVertex> shapeVertexCache_;
   size_t shapeVertexCount_ = 0;
   GLenum currentShapeMode_ = GL_TRIANGLES;
 
-  // 线条批处理缓冲区
-  std::array<ShapeVertex, MAX_LINE_VERTICES> lineVertexCache_;
-  size_t lineVertexCount_ = 0;
-  float currentLineWidth_ = 1.0f;
+  // 线条在 CPU 端三角化后与填充形状共用批次，线宽变化不再刷新
+  PolylineTessellator tessellator_;
+  std::vector<Vec2> linePoints_;
+
+  // 按分段数缓存的单位圆
+  UnitCircleCache unitCircles_;
+
+  // fillPolygon 即时剖分的索引缓冲
+  std::vector<uint32_t> polygonIndices_;
+
+  // 统一批次：填充形状经白色纹素写入精灵批次（仅在精灵批处理期间生效）
+  bool shapesInSpriteBatch_ = false;
+  bool spriteBatchActive_ = false;
+  std::vector<glm::vec2> solidScratch_;
+
+  // SDF 形状批次：与其它批次交替时先刷新对方，保持提交顺序；
+  // 统一批次模式下 SDF 形状改为写入精灵批次，只在精灵批处理之外使用
+  GLSDFShapeBatch sdfShapes_;
+  bool sdfShapesEnabled_ = false;
 
   // OpenGL 状态缓存
   BlendMode cachedBlendMode_ = BlendMode::None;
-  bool blendEnabled_ = false;
   int cachedViewportX_ = 0;
   int cachedViewportY_ = 0;
   int cachedViewportWidth_ = 0;
@@ -122,10 +165,37 @@ private:
 
   void initShapeRendering();
   void flushShapeBatch();
-  void flushLineBatch();
   void addShapeVertex(float x, float y, const Color &color);
-  void addLineVertex(float x, float y, const Color &color);
+  void pushShapeVertex(const glm::vec2 &pos, const Color &color);
+  // 变换后三角化折线并写入当前形状批次
+  void strokePolyline(const Vec2 *points, size_t count, const Color &color,
+                      float width, bool closed, LineJoin join);
+  void submitTessellatedQuads(const Color &color);
   void submitShapeBatch(GLenum mode);
+  // 分段数 <= 0 时按当前变换与视图投影下的屏幕半径选择
+  int resolveCircleSegments(float radius, int segments) const;
+  // 像素线宽换算为世界单位（按视图投影的缩放）
+  float pixelsToWorld(float pixels) const;
+  // 像素宽度换算为 local 变换下的局部单位（SDF 描边）
+  float pixelsToLocal(float pixels, const Affine2D &local) const;
+  void submitSDFShape(SDFShapeKind kind, const Color &color,
+                      GLSDFShapeBatch::InstanceData &inst);
+  void flushSDFShapes();
+  // 精灵或三角形批次写入前调用，先绘制已排队的 SDF 形状
+  void flushPendingSDFShapes() {
+    if (!sdfShapes_.empty()) {
+      flushSDFShapes();
+    }
+  }
+
+  bool useSpriteBatchForShapes() const {
+    return shapesInSpriteBatch_ && spriteBatchActive_;
+  }
+  glm::vec2 transformPoint(float x, float y) const;
+  Affine2D currentAffine() const {
+    return transformStack_.empty() ? Affine2D::identity()
+                                   : transformStack_.back();
+  }
 };
 
 } // namespace extra2d
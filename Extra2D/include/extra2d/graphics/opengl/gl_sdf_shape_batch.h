@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <extra2d/graphics/opengl/gl_shader.h>
+#include <extra2d/graphics/opengl/gl_stream_buffer.h>
+
+#include <glad/glad.h>
+
+namespace extra2d {
+
+// ============================================================================
+// SDF 形状种类（与片段着色器中的分支一一对应）
+// ============================================================================
+enum class SDFShapeKind : uint8_t {
+  Circle = 0,      // 圆：halfSize = (r, r)
+  RoundedRect = 1, // 圆角矩形：radius 为圆角半径
+  Capsule = 2      // 胶囊：沿局部 X 轴的线段 + 半径为 radius 的端帽
+};
+
+// ============================================================================
+// OpenGL SDF 形状批渲染器
+// 每个形状只上传一条实例记录，顶点着色器展开为覆盖形状的四边形，
+// 片段着色器按解析有向距离计算覆盖率，边缘自带抗锯齿
+// ============================================================================
+class GLSDFShapeBatch {
+public:
+  static constexpr size_t MAX_SHAPES = 4096; // 单批次容量
+  /// 片段着色器函数 sdfShapeCoverage(p, params, kind)，精灵批次共用
+  static const char *const GLSL_COVERAGE;
+
+  // 每形状实例记录（48 字节）
+  // 距离场在形状局部空间计算，axisX/axisY 为局部单位轴在世界空间的向量
+  struct InstanceData {
+    glm::vec2 center;   // 形状中心（世界坐标）
+    glm::vec2 axisX;    // 局部 X 轴
+    glm::vec2 axisY;    // 局部 Y 轴
+    glm::vec2 halfSize; // 局部半尺寸（不含描边）
+    float radius;       // 圆半径 / 圆角半径 / 端帽半径
+    float thickness;    // 描边宽度（局部单位，以轮廓为中心），0 为填充
+    uint8_t color[4];
+    uint8_t kind;
+    uint8_t padding[3];
+  };
+  static_assert(sizeof(InstanceData) == 48, "InstanceData must be packed");
+
+  GLSDFShapeBatch();
+  ~GLSDFShapeBatch();
+
+  GLSDFShapeBatch(const GLSDFShapeBatch &) = delete;
+  GLSDFShapeBatch &operator=(const GLSDFShapeBatch &) = delete;
+
+  bool init(VertexStreamMode streamMode);
+  void shutdown();
+
+  /**
+   * @brief 获取下一条实例记录的写入位置
+   * @return 实例记录指针，批次已满或映射失败返回 nullptr（调用方先 flush）
+   */
+  InstanceData *append();
+
+  /**
+   * @brief 绘制所有待处理形状（视图投影取自 GLFrameConstants）
+   * @return 本次绘制的形状数
+   */
+  size_t flush();
+
+  bool empty() const { return count_ == 0; }
+  bool isFull() const { return count_ >= MAX_SHAPES; }
+  bool isReady() const { return vao_ != 0; }
+
+private:
+  GLuint vao_;
+  GLShader shader_;
+  GLStreamBuffer instanceStream_;
+  InstanceData *instances_;
+  size_t count_;
+
+  void bindInstanceAttributes(size_t offset);
+};
+
+} // namespace extra2d
@@ -2,7 +2,12 @@
 
 #include <extra2d/core/color.h>
 #include <extra2d/graphics/shader_interface.h>
+#include <array>
+#include <cstdint>
+#include <deque>
 #include <glad/glad.h>
+#include <string>
+#include <string_view>
 #include <unordered_map>
 #include <vector>
 
@@ -86,6 +91,30 @@ public:
      */
     void setColor(const std::string& name, const Color& color) override;
 
+    /**
+     * @brief 查找uniform句柄
+     * @param name uniform变量名
+     * @return uniform句柄，不存在时返回 INVALID_UNIFORM
+     *
+     * 句柄高位记录程序的构建代数，程序重新编译（热重载）后旧句柄被忽略
+     */
+    UniformId uniform(const char* name) override;
+
+    /**
+     * @brief 按句柄设置uniform变量
+     * @param id uniform句柄
+     * @param value 值
+     *
+     * 通过 glProgramUniform* 写入，无需先绑定；与影子副本相同的值直接跳过
+     */
+    void set(UniformId id, int value) override;
+    void set(UniformId id, float value) override;
+    void set(UniformId id, const glm::vec2& value) override;
+    void set(UniformId id, const glm::vec3& value) override;
+    void set(UniformId id, const glm::vec4& value) override;
+    void set(UniformId id, const glm::mat4& value) override;
+    void set(UniformId id, const Color& color) override;
+
     /**
      * @brief 检查Shader是否有效
      * @return 有效返回true，否则返回false
@@ -139,9 +168,26 @@ public:
     GLuint getProgramID() const { return programID_; }
 
 private:
+    // uniform 槽位：位置与最近一次上传值的影子副本
+    struct UniformSlot {
+        GLint location = -1;
+        uint32_t size = 0; // 影子副本的有效字节数，0 表示尚未上传
+        std::array<uint8_t, sizeof(glm::mat4)> shadow{};
+    };
+
+    // 句柄布局：低 16 位为槽位下标，16~30 位为程序构建代数（不为 0）
+    static constexpr int UNIFORM_INDEX_BITS = 16;
+    static constexpr uint32_t UNIFORM_INDEX_MASK = (1u << UNIFORM_INDEX_BITS) - 1;
+    static constexpr uint32_t UNIFORM_GENERATION_MASK = 0x7FFF;
+
     GLuint programID_ = 0;
     std::string name_;
-    std::unordered_map<std::string, GLint> uniformCache_;
+    // 以 string_view 为键查找，按名称设置 uniform 时不构造临时字符串；
+    // 键指向 uniformNames_ 中的字符串（deque 追加不移动已有元素）
+    std::unordered_map<std::string_view, UniformId> uniformCache_;
+    std::deque<std::string> uniformNames_;
+    std::vector<UniformSlot> uniforms_;
+    uint32_t generation_ = 0;
 
     /**
      * @brief 编译单个着色器
@@ -152,11 +198,18 @@ private:
     GLuint compileShader(GLenum type, const char* source);
 
     /**
-     * @brief 获取uniform位置
-     * @param name uniform变量名
-     * @return uniform位置
+     * @brief 比较并更新影子副本
+     * @param id uniform句柄
+     * @param data 新值
+     * @param size 字节数
+     * @return 需要上传返回对应槽位，值未变化或句柄无效返回nullptr
+     */
+    const UniformSlot* updateShadow(UniformId id, const void* data, uint32_t size);
+
+    /**
+     * @brief 程序重建后清空所有句柄，并取得新的构建代数
      */
-    GLint getUniformLocation(const std::string& name);
+    void resetUniforms();
 };
 
 class GLShaderFactory : public IShaderFactory {
@@ -1,10 +1,13 @@
 #pragma once
 
 #include <array>
+#include <cstdint>
 #include <extra2d/core/color.h>
 #include <extra2d/core/math_types.h>
 #include <extra2d/core/types.h>
+#include <extra2d/graphics/opengl/gl_sdf_shape_batch.h>
 #include <extra2d/graphics/opengl/gl_shader.h>
+#include <extra2d/graphics/opengl/gl_stream_buffer.h>
 #include <extra2d/graphics/texture.h>
 #include <glm/mat4x4.hpp>
 #include <vector>
@@ -13,23 +16,95 @@
 
 namespace extra2d {
 
+// ============================================================================
+// 精灵批渲染器配置
+// ============================================================================
+struct SpriteBatchConfig {
+  // 顶点上传方式，SubData 为原有路径，便于与流式模式对比
+  VertexStreamMode streamMode = VertexStreamMode::SubData;
+  // 单批次最大精灵数（对应 RenderModuleConfig::spriteBatchSize）
+  size_t maxSprites = 10000;
+  // 使用紧凑顶点格式（float 位置 + unorm16 UV + RGBA8 颜色）。
+  // 限制：UV 量化前被截断到 [0, 1]，纹理设置 setWrap(true) 后以超出该范围
+  // 的 UV 平铺的精灵会显示错误，这类场景须保持标准格式
+  bool compactVertices = false;
+  // 单批次同时绑定的纹理数（1 为每次换纹理即刷新的原有行为）
+  size_t textureSlots = 1;
+  // 实例化模式：每个精灵只上传一条实例记录，由顶点着色器展开四边形；
+  // 实例中的 UV 同样是 unorm16，与 compactVertices 有相同的平铺限制
+  bool instanced = false;
+  // 单次 drawBatch 达到该精灵数时，顶点生成分发到工作线程（0 为禁用）；
+  // 大于 maxSprites 时按 maxSprites 处理
+  size_t parallelThreshold = 8192;
+  // 填充形状经保留的白色纹素并入精灵批次，与精灵交错时不再切换批次
+  // （实例化模式下不支持，GLRenderer 退回独立形状批次）
+  bool batchShapes = false;
+  // 圆、圆角矩形与胶囊以单个四边形 + 解析 SDF 绘制（GLRenderer 使用）；
+  // 同时开启 batchShapes 时 SDF 形状也写入精灵批次，否则使用独立的实例化批次
+  bool sdfShapes = true;
+};
+
 // ============================================================================
 // OpenGL 精灵批渲染器 - 优化版本
 // ============================================================================
 class GLSpriteBatch {
 public:
-  static constexpr size_t MAX_SPRITES = 10000;
+  static constexpr size_t MAX_SPRITES = 10000; // 默认单批次容量
   static constexpr size_t VERTICES_PER_SPRITE = 4;
   static constexpr size_t INDICES_PER_SPRITE = 6;
-  static constexpr size_t MAX_VERTICES = MAX_SPRITES * VERTICES_PER_SPRITE;
-  static constexpr size_t MAX_INDICES = MAX_SPRITES * INDICES_PER_SPRITE;
+  // 16 位索引可寻址的顶点数，超出时按子批次拆分绘制
+  static constexpr size_t MAX_VERTICES_PER_DRAW = 65536;
+  static constexpr size_t MAX_SPRITES_PER_DRAW =
+      MAX_VERTICES_PER_DRAW / VERTICES_PER_SPRITE;
+  // 多纹理批处理的最大纹理槽位数
+  static constexpr size_t MAX_TEXTURE_SLOTS = 16;
+  // 保留槽位：片段着色器对该槽位直接返回白色纹素，不占用纹理单元
+  static constexpr uint32_t WHITE_TEXEL_SLOT = 255;
+  // 保留槽位：SDF_SHAPE_SLOT + SDFShapeKind，片段着色器按解析距离计算覆盖率
+  static constexpr uint32_t SDF_SHAPE_SLOT = 252;
+  static_assert(SDF_SHAPE_SLOT + static_cast<uint32_t>(SDFShapeKind::Capsule) <
+                    WHITE_TEXEL_SLOT,
+                "SDF shape slots must not overlap the white texel slot");
 
+  // 标准顶点格式（36 字节）
   struct Vertex {
     glm::vec2 position;
     glm::vec2 texCoord;
     glm::vec4 color;
+    float texSlot;
   };
 
+  // 紧凑顶点格式（20 字节）：UV 归一化到 [0, 1] 后量化为 uint16
+  struct CompactVertex {
+    glm::vec2 position;
+    uint16_t texCoord[2];
+    uint8_t color[4];
+    uint8_t texSlot;
+    uint8_t padding[3];
+  };
+  static_assert(sizeof(CompactVertex) == 20, "CompactVertex must be packed");
+
+  // 实例化模式的每精灵记录（40 字节）
+  // 四边形表示为原点 + 两条边向量，旋转、缩放与斜切均在 CPU 端折算
+  struct InstanceData {
+    glm::vec2 origin; // 角点 (0, 0) 的世界坐标
+    glm::vec2 axisX;  // 角点 (0, 0) -> (1, 0) 的边向量
+    glm::vec2 axisY;  // 角点 (0, 0) -> (0, 1) 的边向量
+    uint16_t texRect[4]; // unorm16: minU, minV, maxU, maxV
+    uint8_t color[4];
+    uint8_t texSlot;
+    uint8_t padding[3];
+  };
+  static_assert(sizeof(InstanceData) == 40, "InstanceData must be packed");
+
+  // SDF 形状的附加顶点属性（24 字节），存放在独立的流缓冲区中，
+  // 只有含 SDF 形状的批次才上传并启用；精灵顶点对应位置的内容不被读取
+  struct ShapeVertex {
+    glm::vec2 local;  // 形状局部坐标
+    glm::vec4 params; // halfSize.xy, radius, thickness
+  };
+  static_assert(sizeof(ShapeVertex) == 24, "ShapeVertex must be packed");
+
   struct SpriteData {
     glm::vec2 position;
     glm::vec2 size;
@@ -41,14 +116,28 @@ public:
     bool isSDF = false;
   };
 
+  // 仿射精灵：局部四边形 [-anchor * size, (1 - anchor) * size] 经 transform
+  // 变换到世界坐标，支持斜切与非等比缩放，不需要三角函数
+  struct AffineSpriteData {
+    Affine2D transform;
+    glm::vec2 size;
+    glm::vec2 texCoordMin;
+    glm::vec2 texCoordMax;
+    glm::vec4 color;
+    glm::vec2 anchor;
+    bool isSDF = false;
+  };
+
   GLSpriteBatch();
   ~GLSpriteBatch();
 
   bool init();
+  bool init(const SpriteBatchConfig &config);
   void shutdown();
 
   void begin(const glm::mat4 &viewProjection);
   void draw(const Texture &texture, const SpriteData &data);
+  void draw(const Texture &texture, const AffineSpriteData &data);
   void end();
 
   // 批量绘制接口 - 用于自动批处理
@@ -58,41 +147,110 @@ public:
   // 立即绘制（不缓存）
   void drawImmediate(const Texture &texture, const SpriteData &data);
 
+  // 纯色形状（白色纹素 * 顶点颜色），与精灵共用同一批次
+  bool supportsSolidShapes() const { return !instanced_; }
+  void drawSolidQuad(const glm::vec2 &p0, const glm::vec2 &p1,
+                     const glm::vec2 &p2, const glm::vec2 &p3,
+                     const glm::vec4 &color);
+  void drawSolidTriangle(const glm::vec2 &p0, const glm::vec2 &p1,
+                         const glm::vec2 &p2, const glm::vec4 &color);
+  // 三角形扇：points[0] 为中心，依次与相邻两点组成三角形
+  void drawSolidFan(const glm::vec2 *points, size_t count,
+                    const glm::vec4 &color);
+
+  // SDF 形状（圆、圆角矩形、胶囊），与精灵、纯色形状共用同一批次
+  bool supportsSDFShapes() const { return sdfShapes_; }
+  void drawSDFShape(const GLSDFShapeBatch::InstanceData &shape);
+
   // 统计
   uint32_t getDrawCallCount() const { return drawCallCount_; }
   uint32_t getSpriteCount() const { return spriteCount_; }
   uint32_t getBatchCount() const { return batchCount_; }
+  // 因纹理槽位命中而省去的刷新次数
+  uint32_t getFlushesAvoided() const { return flushesAvoided_; }
+  uint32_t getFlushCount() const { return flushCount_; }
 
   // 检查是否需要刷新
   bool needsFlush(const Texture &texture, bool isSDF) const;
 
+  VertexStreamMode getStreamMode() const { return vertexStream_.getMode(); }
+  size_t getCapacity() const { return maxSprites_; }
+  bool isCompact() const { return compact_; }
+  size_t getTextureSlots() const { return textureSlots_; }
+  bool isInstanced() const { return instanced_; }
+  size_t getParallelThreshold() const { return parallelThreshold_; }
+
 private:
   GLuint vao_;
-  GLuint vbo_;
   GLuint ibo_;
   GLShader shader_;
 
-  // 使用固定大小数组减少内存分配
-  std::array<Vertex, MAX_VERTICES> vertexBuffer_;
+  // 顶点直接写入流缓冲区的映射内存（SubData 模式下为 CPU 暂存区）
+  // 实例化模式下流中存放 InstanceData，vertexCount_ 仍按每精灵 4 个顶点计数
+  GLStreamBuffer vertexStream_;
+  uint8_t *vertexPtr_;
   size_t vertexCount_;
+  size_t vertexStride_;
+  size_t bytesPerSprite_;
+  size_t maxSprites_;
+  size_t maxVertices_;
+  bool compact_;
+  bool instanced_;
+  size_t parallelThreshold_;
 
-  const Texture *currentTexture_;
-  bool currentIsSDF_;
-  glm::mat4 viewProjection_;
+  // SDF 形状属性流：本批次写入第一个 SDF 形状时才映射
+  GLStreamBuffer shapeStream_;
+  ShapeVertex *shapePtr_;
+  bool sdfShapes_;
+  // 顶点属性指针当前不在偏移 0（含 SDF 形状的批次按偏移重新指定）
+  bool attribsOffset_;
 
-  // 缓存上一帧的 viewProjection，避免重复设置
-  glm::mat4 cachedViewProjection_;
-  bool viewProjectionDirty_ = true;
+  // 当前批次绑定的纹理槽位
+  std::array<const Texture *, MAX_TEXTURE_SLOTS> slotTextures_;
+  size_t slotCount_;
+  size_t textureSlots_;
+  uint32_t currentSlot_;
+  const Texture *lastTexture_;
+  bool currentIsSDF_;
+  UniformId useSDFUniform_ = INVALID_UNIFORM;
 
   uint32_t drawCallCount_;
   uint32_t spriteCount_;
   uint32_t batchCount_;
+  uint32_t flushesAvoided_;
+  uint32_t flushCount_;
 
   void flush();
   void setupShader();
 
-  // 添加顶点到缓冲区
-  void addVertices(const SpriteData &data);
+  // 确保顶点写入指针有效（每次刷新后延迟映射）
+  bool mapVertices();
+
+  // 实例化模式：将实例属性指向流缓冲区中本批次的偏移
+  void bindInstanceAttributes(size_t offset);
+
+  // 非实例化模式：将顶点属性指向流缓冲区中的偏移
+  void bindVertexAttributes(size_t offset);
+  // 将 SDF 形状属性指向形状流中的偏移，enable 为 false 时禁用
+  void bindShapeAttributes(size_t offset, bool enable);
+
+  // 查找或分配纹理槽位，槽位用尽或 SDF 状态改变时先刷新
+  uint32_t acquireSlot(const Texture &texture, bool isSDF);
+  int findSlot(const Texture &texture) const;
+
+  // 添加一段精灵的顶点到缓冲区（批量路径使用 SIMD 内核，超过阈值时多线程）
+  void addVertices(const SpriteData *sprites, size_t count);
+
+  // 为一个纯色四边形预留空间（SDF 批次或缓冲区已满时先刷新）
+  bool reserveSolid();
+  void writeSolidQuad(const glm::vec2 &p0, const glm::vec2 &p1,
+                      const glm::vec2 &p2, const glm::vec2 &p3,
+                      const glm::vec4 &color,
+                      uint32_t slot = WHITE_TEXEL_SLOT);
+
+  // 将精灵写入 dst 起始的连续区域，只读成员状态，可在工作线程中调用
+  void writeSprites(const SpriteData *sprites, size_t count,
+                    uint8_t *dst) const;
 };
 
 } // namespace extra2d
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <extra2d/graphics/opengl/gl_sprite_batch.h>
+
+namespace extra2d {
+
+// ============================================================================
+// 精灵顶点计算内核
+// 批量计算精灵四边形的四个角点（锚点、尺寸、旋转），按平台选择实现：
+//   - x86:  AVX2（运行时检测，每次 8 个）/ SSE2（每次 4 个）
+//   - ARM:  NEON（每次 4 个）
+//   - 其他: 标量
+// SIMD 实现使用多项式 sin/cos；单个精灵与 SIMD 尾部走标量 4096 点查表
+// （角度误差不超过 7.7e-4 弧度，优于原 0.25 度查表）
+// ============================================================================
+
+/**
+ * @brief 单个精灵的四个角点，顺序为 (0,0) (w,0) (w,h) (0,h)
+ */
+struct SpriteCorners {
+  float x[4];
+  float y[4];
+};
+
+/**
+ * @brief 批量计算精灵角点（自动选择最快的实现）
+ * @param sprites 精灵数据数组
+ * @param count 精灵数量
+ * @param out 输出角点数组，长度不小于 count
+ */
+void computeSpriteCorners(const GLSpriteBatch::SpriteData *sprites,
+                          size_t count, SpriteCorners *out);
+
+/**
+ * @brief 批量计算精灵角点（标量实现，用于单个精灵与基准对比）
+ * @param sprites 精灵数据数组
+ * @param count 精灵数量
+ * @param out 输出角点数组
+ */
+void computeSpriteCornersScalar(const GLSpriteBatch::SpriteData *sprites,
+                                size_t count, SpriteCorners *out);
+
+/**
+ * @brief 获取当前使用的内核名称
+ * @return "AVX2" / "SSE2" / "NEON" / "Scalar"
+ */
+const char *getSpriteKernelName();
+
+/**
+ * @brief 标量 sin/cos（4096 点查表，取最近采样点）
+ * @param radians 弧度
+ * @param s 输出 sin 值
+ * @param c 输出 cos 值
+ */
+void fastSinCos(float radians, float &s, float &c);
+
+} // namespace extra2d
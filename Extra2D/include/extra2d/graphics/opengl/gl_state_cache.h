@@ -0,0 +1,83 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#include <glad/glad.h>
+
+namespace extra2d {
+
+// ============================================================================
+// OpenGL 状态缓存
+// 集中跟踪程序、VAO、数组/索引缓冲、各纹理单元绑定、混合状态与视口，
+// 与当前状态相同的调用直接跳过；实际下发的绑定计入统计。
+// 只能在 GL 上下文所在线程使用；绕过缓存直接修改 GL 状态后需调用 invalidate()
+// ============================================================================
+class GLStateCache {
+public:
+  static constexpr uint32_t MAX_TEXTURE_UNITS = 32;
+
+  // 实际下发与被跳过的调用次数
+  struct Counters {
+    uint32_t shaderBinds = 0;
+    uint32_t textureBinds = 0;
+    uint32_t vertexArrayBinds = 0;
+    uint32_t bufferBinds = 0;
+    uint32_t redundantSkipped = 0;
+  };
+
+  /// 获取单例实例
+  static GLStateCache &get();
+
+  void useProgram(GLuint program);
+  void bindVertexArray(GLuint vao);
+  /// 跟踪 GL_ARRAY_BUFFER 与 GL_ELEMENT_ARRAY_BUFFER，其它目标直接下发
+  void bindBuffer(GLenum target, GLuint buffer);
+  /// 绑定 GL_TEXTURE_2D 到指定纹理单元，必要时切换活动单元
+  void bindTexture(uint32_t unit, GLuint texture);
+  /// 当前活动纹理单元（未知时返回 0）
+  uint32_t getActiveTextureUnit() const {
+    return activeUnit_ < MAX_TEXTURE_UNITS ? activeUnit_ : 0;
+  }
+
+  void setBlend(bool enabled, GLenum srcFactor, GLenum dstFactor);
+  void setViewport(GLint x, GLint y, GLsizei width, GLsizei height);
+
+  // 对象删除后清除指向它的缓存（GL 会把已删除对象的绑定重置为 0，
+  // 而名字可能被新对象复用）
+  void onProgramDeleted(GLuint program);
+  void onVertexArrayDeleted(GLuint vao);
+  void onBufferDeleted(GLuint buffer);
+  void onTextureDeleted(GLuint texture);
+
+  /// 令全部缓存失效（新建上下文或外部代码直接调用 GL 之后）
+  void invalidate();
+
+  const Counters &getCounters() const { return counters_; }
+  void resetCounters() { counters_ = Counters{}; }
+
+private:
+  GLStateCache();
+  GLStateCache(const GLStateCache &) = delete;
+  GLStateCache &operator=(const GLStateCache &) = delete;
+
+  // 未知状态标记：下一次设置必定下发
+  static constexpr GLuint UNKNOWN = 0xFFFFFFFFu;
+
+  GLuint program_;
+  GLuint vao_;
+  GLuint arrayBuffer_;
+  GLuint elementBuffer_; // 属于当前 VAO 的状态，切换 VAO 时失效
+  uint32_t activeUnit_;
+  std::array<GLuint, MAX_TEXTURE_UNITS> textures_;
+
+  int blendEnabled_; // -1 未知
+  GLenum blendSrc_;
+  GLenum blendDst_;
+  std::array<GLint, 4> viewport_;
+  bool viewportKnown_;
+
+  Counters counters_;
+};
+
+} // namespace extra2d
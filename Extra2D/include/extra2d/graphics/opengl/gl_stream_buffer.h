@@ -0,0 +1,86 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <extra2d/graphics/render_backend.h>
+#include <vector>
+
+#include <glad/glad.h>
+
+namespace extra2d {
+
+// ============================================================================
+// OpenGL 动态顶点流缓冲区
+// 每个批次从缓冲区中子分配一段连续空间，调用方直接写入映射内存：
+//   - SubData:    写入 CPU 暂存区，unmap 时 glBufferSubData 到偏移 0
+//   - Orphan:     在缓冲区内追加写入（非同步映射），写满后孤立整个缓冲区
+//   - RingBuffer: 批次按实际写入量在缓冲区内连续追加；写入位置越过一段后
+//                 为该段插入围栏，下一轮首次进入该段前才等待
+// ============================================================================
+class GLStreamBuffer {
+public:
+  // 环形缓冲区段数，每段为一次 map 的最大容量（GPU 最多落后约 RING_SECTIONS-1 段）
+  static constexpr size_t RING_SECTIONS = 3;
+
+  GLStreamBuffer();
+  ~GLStreamBuffer();
+
+  GLStreamBuffer(const GLStreamBuffer &) = delete;
+  GLStreamBuffer &operator=(const GLStreamBuffer &) = delete;
+
+  /**
+   * @brief 创建缓冲区
+   * @param target 缓冲区目标（如 GL_ARRAY_BUFFER）
+   * @param capacity 单次 map 的最大字节数
+   * @param mode 上传模式
+   * @return 成功返回 true
+   */
+  bool init(GLenum target, size_t capacity, VertexStreamMode mode);
+  void shutdown();
+
+  /**
+   * @brief 预留一段可写内存
+   * @param bytes 本次最多写入的字节数（不超过 capacity）
+   * @param alignment 起始偏移对齐（通常为顶点步长）
+   * @return 可直接写入的内存指针，失败返回 nullptr
+   */
+  void *map(size_t bytes, size_t alignment);
+
+  /**
+   * @brief 提交已写入的数据
+   * @param usedBytes 实际写入的字节数
+   * @return 数据在 GPU 缓冲区中的字节偏移
+   */
+  size_t unmap(size_t usedBytes);
+
+  bool isMapped() const { return mapped_ != nullptr; }
+  bool isPersistent() const { return persistentPtr_ != nullptr; }
+  GLuint getBuffer() const { return buffer_; }
+  size_t getCapacity() const { return capacity_; }
+  VertexStreamMode getMode() const { return mode_; }
+
+private:
+  GLuint buffer_;
+  GLenum target_;
+  VertexStreamMode mode_;
+  size_t capacity_;
+  size_t size_;
+  size_t head_;
+  size_t mapOffset_;
+  uint8_t *mapped_;
+
+  // SubData 模式的 CPU 暂存区
+  std::vector<uint8_t> staging_;
+
+  // RingBuffer 模式：持久映射指针、每段围栏与本轮已占用的段
+  uint8_t *persistentPtr_;
+  std::array<GLsync, RING_SECTIONS> fences_;
+  std::array<bool, RING_SECTIONS> acquired_;
+
+  void retireSections(size_t end);
+  void acquireSections(size_t begin, size_t end);
+  void waitFence(size_t section);
+};
+
+} // namespace extra2d
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <extra2d/core/math_types.h>
+#include <vector>
+
+namespace extra2d {
+
+// ============================================================================
+// 多边形三角剖分 - 耳切法，支持凹多边形（简单多边形，不含自相交与孔洞）
+// 输出三角形索引（每 3 个一组），顶点顺序与输入多边形的环绕方向一致
+// ============================================================================
+class PolygonTriangulator {
+public:
+  /**
+   * @brief 三角剖分一个简单多边形
+   * @param points 顶点数组（顺时针或逆时针均可，首尾不重复）
+   * @param count 顶点数量
+   * @param indices 输出三角形索引，先清空再写入
+   * @return 成功剖分返回 true；遇到自相交等无法找到耳的情况时
+   *         剩余部分按扇形补齐并返回 false
+   */
+  static bool triangulate(const Vec2 *points, size_t count,
+                          std::vector<uint32_t> &indices);
+
+  /// 便捷重载
+  static bool triangulate(const std::vector<Vec2> &points,
+                          std::vector<uint32_t> &indices) {
+    return triangulate(points.data(), points.size(), indices);
+  }
+};
+
+} // namespace extra2d
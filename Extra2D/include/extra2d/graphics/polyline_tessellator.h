@@ -0,0 +1,56 @@
+#pragma once
+
+#include <extra2d/core/math_types.h>
+#include <extra2d/graphics/render_backend.h>
+#include <vector>
+
+namespace extra2d {
+
+// ============================================================================
+// 折线三角化 - 在 CPU 端把任意宽度的折线展开为三角形
+// 输出统一为四边形（索引顺序 (0,1,2) (0,2,3)），单个三角形表示为
+// 第四个顶点与第三个重合的退化四边形，可直接写入形状或精灵批次
+// ============================================================================
+class PolylineTessellator {
+public:
+  struct Quad {
+    Vec2 p[4];
+  };
+
+  // 默认斜接限制（斜接长度 / 半线宽），超过时退化为斜切
+  static constexpr float DEFAULT_MITER_LIMIT = 4.0f;
+
+  /**
+   * @brief 三角化一条折线，结果追加到内部四边形列表
+   * @param points 顶点数组
+   * @param count 顶点数量
+   * @param width 线宽
+   * @param closed 是否首尾相连
+   * @param join 拐角连接方式
+   * @param miterLimit 斜接限制
+   */
+  void tessellate(const Vec2 *points, size_t count, float width, bool closed,
+                  LineJoin join, float miterLimit = DEFAULT_MITER_LIMIT);
+
+  /// 三角化单条线段（无拐角）
+  void tessellateSegment(const Vec2 &start, const Vec2 &end, float width);
+
+  /// 获取三角化结果
+  const std::vector<Quad> &getQuads() const { return quads_; }
+
+  /// 清空结果（保留容量，供下一次复用）
+  void clear() { quads_.clear(); }
+
+private:
+  std::vector<Quad> quads_;
+  std::vector<Vec2> points_; // 去除重复点后的顶点
+
+  void addJoin(const Vec2 &pivot, const Vec2 &dirIn, const Vec2 &dirOut,
+               float halfWidth, LineJoin join, float miterLimit);
+  void addQuad(const Vec2 &p0, const Vec2 &p1, const Vec2 &p2,
+               const Vec2 &p3) {
+    quads_.push_back(Quad{{p0, p1, p2, p3}});
+  }
+};
+
+} // namespace extra2d
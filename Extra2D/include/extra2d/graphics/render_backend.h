@@ -34,6 +34,27 @@ enum class BlendMode {
   Multiply  // 乘法混合
 };
 
+// ============================================================================
+// 折线拐角连接方式
+// ============================================================================
+enum class LineJoin {
+  Miter, // 斜接（尖角，超过斜接限制时退化为 Bevel）
+  Bevel, // 斜切
+  Round  // 圆角
+};
+
+// 圆的分段数取该值（或任意 <= 0 的值）时，由后端按投影后的屏幕半径自动选择
+constexpr int CIRCLE_SEGMENTS_AUTO = 0;
+
+// ============================================================================
+// 动态顶点流上传模式
+// ============================================================================
+enum class VertexStreamMode {
+  SubData,   // CPU 暂存 + glBufferSubData 覆盖同一缓冲区（默认）
+  Orphan,    // 缓冲区孤立 + 非同步映射追加写入
+  RingBuffer // 多段环形缓冲区 + 围栏同步，支持时使用持久映射
+};
+
 // ============================================================================
 // 渲染后端抽象接口
 // ============================================================================
@@ -54,6 +75,8 @@ public:
   virtual void endFrame() = 0;
   virtual void setViewport(int x, int y, int width, int height) = 0;
   virtual void setVSync(bool enabled) = 0;
+  /// 设置着色器可见的运行时间（秒），随帧常量一起上传
+  virtual void setFrameTime(float seconds) = 0;
 
   // ------------------------------------------------------------------------
   // 状态设置
@@ -62,11 +85,11 @@ public:
   virtual void setViewProjection(const glm::mat4 &matrix) = 0;
 
   // ------------------------------------------------------------------------
-  // 变换矩阵栈
+  // 变换栈（2D 仿射变换，仅在 GPU 边界处转换为 4x4 矩阵）
   // ------------------------------------------------------------------------
-  virtual void pushTransform(const glm::mat4 &transform) = 0;
+  virtual void pushTransform(const Affine2D &transform) = 0;
   virtual void popTransform() = 0;
-  virtual glm::mat4 getCurrentTransform() const = 0;
+  virtual Affine2D getCurrentTransform() const = 0;
 
   // ------------------------------------------------------------------------
   // 纹理
@@ -84,10 +107,15 @@ public:
                           float rotation, const Vec2 &anchor) = 0;
   virtual void drawSprite(const Texture &texture, const Vec2 &position,
                           const Color &tint) = 0;
+  // 仿射版本：size 为局部尺寸，四个角点直接经 transform 变换（保留斜切）
+  virtual void drawSprite(const Texture &texture, const Affine2D &transform,
+                          const Size &size, const Rect &srcRect,
+                          const Color &tint, const Vec2 &anchor) = 0;
   virtual void endSpriteBatch() = 0;
 
   // ------------------------------------------------------------------------
   // 形状渲染
+  // 描边的 width 以屏幕像素计（与 GL_LINES 一致），不随变换栈或相机缩放变化
   // ------------------------------------------------------------------------
   virtual void drawLine(const Vec2 &start, const Vec2 &end, const Color &color,
                         float width = 1.0f) = 0;
@@ -95,9 +123,10 @@ public:
                         float width = 1.0f) = 0;
   virtual void fillRect(const Rect &rect, const Color &color) = 0;
   virtual void drawCircle(const Vec2 &center, float radius, const Color &color,
-                          int segments = 32, float width = 1.0f) = 0;
+                          int segments = CIRCLE_SEGMENTS_AUTO,
+                          float width = 1.0f) = 0;
   virtual void fillCircle(const Vec2 &center, float radius, const Color &color,
-                          int segments = 32) = 0;
+                          int segments = CIRCLE_SEGMENTS_AUTO) = 0;
   virtual void drawTriangle(const Vec2 &p1, const Vec2 &p2, const Vec2 &p3,
                             const Color &color, float width = 1.0f) = 0;
   virtual void fillTriangle(const Vec2 &p1, const Vec2 &p2, const Vec2 &p3,
@@ -106,6 +135,30 @@ public:
                            float width = 1.0f) = 0;
   virtual void fillPolygon(const std::vector<Vec2> &points,
                            const Color &color) = 0;
+  // 预先剖分的多边形：indices 每 3 个一组索引 points（见 PolygonTriangulator）
+  virtual void fillPolygonMesh(const Vec2 *points, size_t pointCount,
+                               const uint32_t *indices, size_t indexCount,
+                               const Color &color) = 0;
+  // 任意线宽的折线，拐角按 join 连接（所有描边形状均经三角化绘制）
+  virtual void drawPolyline(const std::vector<Vec2> &points, const Color &color,
+                            float width = 1.0f, bool closed = false,
+                            LineJoin join = LineJoin::Miter) = 0;
+
+  // ------------------------------------------------------------------------
+  // SDF 形状 - 每个形状一个四边形，片段着色器按解析距离场着色并抗锯齿
+  // thickness > 0 时绘制以轮廓为中心的描边，否则填充；描边宽度与上面的
+  // 三角化描边一样以屏幕像素计；
+  // supportsShapeSDF() 为 false 时调用方应退回上面的三角化接口
+  // ------------------------------------------------------------------------
+  virtual bool supportsShapeSDF() const = 0;
+  virtual void drawCircleSDF(const Vec2 &center, float radius,
+                             const Color &color, float thickness = 0.0f) = 0;
+  virtual void drawRoundedRectSDF(const Rect &rect, float cornerRadius,
+                                  const Color &color,
+                                  float thickness = 0.0f) = 0;
+  // 两端为半圆的线段，radius 为半宽
+  virtual void drawCapsuleSDF(const Vec2 &start, const Vec2 &end, float radius,
+                              const Color &color, float thickness = 0.0f) = 0;
 
   // ------------------------------------------------------------------------
   // 文字渲染
@@ -125,6 +178,13 @@ public:
     uint32_t triangleCount = 0;
     uint32_t textureBinds = 0;
     uint32_t shaderBinds = 0;
+    uint32_t flushesAvoided = 0; // 多纹理批处理省去的刷新次数
+    uint32_t batchFlushes = 0;   // 精灵/形状/线条批次的刷新总次数
+    uint32_t sdfShapes = 0;      // 以 SDF 绘制的形状数（含并入精灵批次的）
+    uint32_t vertexArrayBinds = 0;
+    uint32_t bufferBinds = 0;
+    uint32_t redundantBindsSkipped = 0; // 状态缓存跳过的重复绑定
+    uint32_t frameConstantUploads = 0;  // 帧常量块的上传次数
   };
   virtual Stats getStats() const = 0;
   virtual void resetStats() = 0;
@@ -4,9 +4,12 @@
 #include <extra2d/core/math_types.h>
 #include <extra2d/core/types.h>
 #include <extra2d/graphics/texture.h>
-#include <glm/mat4x4.hpp>
+#include <extra2d/utils/linear_arena.h>
 #include <cstdint>
-#include <variant>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
 
 namespace extra2d {
 
@@ -29,6 +32,7 @@ enum class RenderCommandType : uint8_t {
   FilledTriangle, // 填充三角形
   Polygon,      // 多边形绘制
   FilledPolygon, // 填充多边形
+  FilledPolygonMesh, // 预剖分的填充多边形
   Text,         // 文本绘制
   Custom        // 自定义绘制
 };
@@ -38,20 +42,19 @@ enum class RenderCommandType : uint8_t {
  */
 struct SpriteCommandData {
   const Texture* texture;
-  Rect destRect;
+  Rect destRect;     // 位于 RenderCommand::transform 的局部空间
   Rect srcRect;
   Color tint;
   float rotation;
   Vec2 anchor;
-  uint32_t sortKey;  // 用于自动排序的键值
   
   SpriteCommandData() 
     : texture(nullptr), destRect(), srcRect(), tint(Colors::White), 
-      rotation(0.0f), anchor(0.0f, 0.0f), sortKey(0) {}
+      rotation(0.0f), anchor(0.0f, 0.0f) {}
   SpriteCommandData(const Texture* tex, const Rect& dest, const Rect& src, 
-                    const Color& t, float rot, const Vec2& anc, uint32_t key)
+                    const Color& t, float rot, const Vec2& anc)
     : texture(tex), destRect(dest), srcRect(src), tint(t), 
-      rotation(rot), anchor(anc), sortKey(key) {}
+      rotation(rot), anchor(anc) {}
 };
 
 /**
@@ -116,108 +119,300 @@ struct TriangleCommandData {
 
 /**
  * @brief 多边形渲染命令数据
+ * 顶点（局部坐标）位于命令缓冲区的帧内存中，见 RenderCommandBuffer::copyPoints
  */
 struct PolygonCommandData {
-  std::vector<Vec2> points;
+  const Vec2* points;
+  size_t pointCount;
   Color color;
   float width;
   bool filled;
   
-  PolygonCommandData() : color(Colors::White), width(1.0f), filled(false) {}
-  PolygonCommandData(std::vector<Vec2> pts, const Color& col, float w, bool f)
-    : points(std::move(pts)), color(col), width(w), filled(f) {}
+  PolygonCommandData() : points(nullptr), pointCount(0), color(Colors::White),
+                         width(1.0f), filled(false) {}
+  PolygonCommandData(const Vec2* pts, size_t ptCount, const Color& col, float w,
+                     bool f)
+    : points(pts), pointCount(ptCount), color(col), width(w), filled(f) {}
+};
+
+/**
+ * @brief 预剖分多边形渲染命令数据
+ * 顶点（局部坐标）与索引位于命令缓冲区的帧内存中，
+ * 见 RenderCommandBuffer::copyPoints / copyIndices
+ */
+struct PolygonMeshCommandData {
+  const Vec2* points;
+  size_t pointCount;
+  const uint32_t* indices;
+  size_t indexCount;
+  Color color;
+  
+  PolygonMeshCommandData() : points(nullptr), pointCount(0), indices(nullptr),
+                             indexCount(0), color(Colors::White) {}
+  PolygonMeshCommandData(const Vec2* pts, size_t ptCount, const uint32_t* idx,
+                         size_t idxCount, const Color& col)
+    : points(pts), pointCount(ptCount), indices(idx), indexCount(idxCount),
+      color(col) {}
 };
 
 /**
  * @brief 文本渲染命令数据
+ * 文字内容位于命令缓冲区的帧内存中，见 RenderCommandBuffer::copyText
  */
 struct TextCommandData {
   const FontAtlas* font;
-  std::string text;
+  const char* text;
+  size_t length;
   Vec2 position;
   Color color;
   
-  TextCommandData() : font(nullptr), text(), position(), color(Colors::White) {}
+  TextCommandData() : font(nullptr), text(nullptr), length(0), position(),
+                      color(Colors::White) {}
+  TextCommandData(const FontAtlas* f, const char* str, size_t len,
+                  const Vec2& pos, const Color& col)
+    : font(f), text(str), length(len), position(pos), color(col) {}
 };
 
 /**
- * @brief 统一渲染命令结构
- * 使用 variant 存储不同类型的命令数据，减少内存分配
+ * @brief 命令负载：世界变换与具体数据连续存放于帧内存
+ */
+template <typename T>
+struct RenderCommandPayload {
+  Affine2D transform;  // 必须为首个成员，RenderCommand::getTransform 依赖此布局
+  T data;
+};
+
+/**
+ * @brief 渲染命令头
+ * 定长且平凡可拷贝，排序只读取头部；变换与各类型数据存放在
+ * 所属 RenderCommandBuffer 的帧内存中，随缓冲区 clear() 一并失效
  */
 struct RenderCommand {
   RenderCommandType type;
-  uint32_t layer;        // 渲染层级，用于排序
-  uint32_t order;        // 提交顺序，保证同层级内稳定排序
-  glm::mat4 transform;   // 变换矩阵
-  
-  // 使用 variant 存储具体数据
-  std::variant<
-    SpriteCommandData,
-    LineCommandData,
-    RectCommandData,
-    CircleCommandData,
-    TriangleCommandData,
-    PolygonCommandData,
-    TextCommandData
-  > data;
-  
-  RenderCommand() : type(RenderCommandType::None), layer(0), order(0), 
-                    transform(1.0f) {}
-  
-  // 便捷构造函数
-  static RenderCommand makeSprite(const Texture* tex, const Rect& dest, 
-                                   const Rect& src, const Color& tint,
-                                   float rot = 0.0f, const Vec2& anc = Vec2(0, 0),
-                                   uint32_t lyr = 0);
-  static RenderCommand makeLine(const Vec2& s, const Vec2& e, const Color& c, 
-                                 float w = 1.0f, uint32_t lyr = 0);
-  static RenderCommand makeRect(const Rect& r, const Color& c, 
-                                 float w = 1.0f, bool fill = false, uint32_t lyr = 0);
+  uint16_t textureSortId;  // 精灵纹理的排序 ID，其它命令为 0
+  int32_t layer;           // 渲染层级（累积 Z 序），用于排序
+  uint32_t order;          // 提交顺序，保证同层级内稳定排序
+  const void* payload;     // 指向 RenderCommandPayload<T>
+  
+  RenderCommand() : type(RenderCommandType::None), textureSortId(0), layer(0),
+                    order(0), payload(nullptr) {}
+  
+  /// 命令的世界变换
+  const Affine2D& getTransform() const {
+    return *static_cast<const Affine2D*>(payload);
+  }
+  
+  /// 按类型读取数据，T 必须与 type 对应（见 RenderCommandBuffer::add）
+  template <typename T>
+  const T& getData() const {
+    return static_cast<const RenderCommandPayload<T>*>(payload)->data;
+  }
+};
+
+static_assert(std::is_trivially_copyable<RenderCommand>::value &&
+              sizeof(RenderCommand) <= 24,
+              "RenderCommand header must stay compact");
+
+/**
+ * @brief 64 位渲染排序键
+ *
+ * 自高位到低位：
+ *   [63..48] layer   有符号层级加偏移，负 Z 序在前
+ *   [47..44] pass    精灵类（精灵/文字）在前，形状在后
+ *   [43..40] blend   混合模式
+ *   [39..32] shader  着色器/管线，当前由命令类型决定
+ *   [31..16] texture 纹理排序 ID（Texture::getSortId）
+ *   [15..0]  depth   同层内深度，未使用时为 0
+ * 相同键的命令由稳定排序保持提交顺序
+ */
+struct RenderSortKey {
+  static constexpr int LAYER_SHIFT = 48;
+  static constexpr int PASS_SHIFT = 44;
+  static constexpr int BLEND_SHIFT = 40;
+  static constexpr int SHADER_SHIFT = 32;
+  static constexpr int TEXTURE_SHIFT = 16;
+
+  static uint64_t make(int32_t layer, uint8_t pass, uint8_t blend,
+                       uint8_t shader, uint16_t texture, uint16_t depth = 0);
+  /// 由命令的层级、类型与纹理生成键
+  static uint64_t fromCommand(const RenderCommand& cmd);
+};
+
+/**
+ * @brief 视口剔除统计（每帧）
+ * drawn/culled 只统计报告了内容边界的节点；被整体剔除的子树计入
+ * subtreesCulled，其中的节点不再逐个访问与计数
+ */
+struct CullStats {
+  uint32_t drawn = 0;
+  uint32_t culled = 0;
+  uint32_t subtreesCulled = 0;
+
+  CullStats& operator+=(const CullStats& other) {
+    drawn += other.drawn;
+    culled += other.culled;
+    subtreesCulled += other.subtreesCulled;
+    return *this;
+  }
 };
 
 /**
  * @brief 渲染命令缓冲区
- * 用于收集和批量处理渲染命令
+ * 用于收集和批量处理渲染命令：命令头存于连续数组，负载与变长数据
+ * （多边形顶点、文字）存于按帧复用的线性内存；clear() 只回退游标，
+ * 预热后每帧收集不再分配内存
  */
 class RenderCommandBuffer {
 public:
   static constexpr size_t INITIAL_CAPACITY = 1024;
-  static constexpr size_t MAX_CAPACITY = 65536;
   
   RenderCommandBuffer();
   ~RenderCommandBuffer();
   
-  // 添加渲染命令
-  void addCommand(const RenderCommand& cmd);
-  void addCommand(RenderCommand&& cmd);
+  RenderCommandBuffer(const RenderCommandBuffer&) = delete;
+  RenderCommandBuffer& operator=(const RenderCommandBuffer&) = delete;
   
-  // 批量添加（预留空间后使用）
-  RenderCommand& emplaceCommand();
+  /**
+   * @brief 添加一条命令，数据拷贝到帧内存
+   * @param type 命令类型，须与 T 对应
+   * @param layer 渲染层级
+   * @param transform 世界变换
+   * @param data 命令数据
+   */
+  template <typename T>
+  void add(RenderCommandType type, int32_t layer, const Affine2D& transform,
+           const T& data) {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "command data must not own memory");
+    RenderCommand cmd;
+    cmd.type = type;
+    cmd.layer = layer;
+    cmd.order = nextOrder_++;
+    cmd.payload = arena_.create(RenderCommandPayload<T>{transform, data});
+    if constexpr (std::is_same<T, SpriteCommandData>::value) {
+      cmd.textureSortId = data.texture != nullptr ? data.texture->getSortId()
+                                                  : Texture::INVALID_SORT_ID;
+    }
+    commands_.push_back(cmd);
+  }
   
-  // 排序命令（按纹理、层级等）
+  // 便捷添加函数
+  void addSprite(const Texture* tex, const Rect& dest, const Rect& src,
+                 const Color& tint, float rot = 0.0f,
+                 const Vec2& anc = Vec2(0, 0), int32_t lyr = 0,
+                 const Affine2D& transform = Affine2D::identity());
+  void addLine(const Vec2& s, const Vec2& e, const Color& c, float w = 1.0f,
+               int32_t lyr = 0,
+               const Affine2D& transform = Affine2D::identity());
+  void addRect(const Rect& r, const Color& c, float w = 1.0f,
+               bool fill = false, int32_t lyr = 0,
+               const Affine2D& transform = Affine2D::identity());
+  
+  /**
+   * @brief 持有命令引用的资源，直到 clear()
+   *
+   * 命令数据只记录裸指针（纹理、字体）；缓冲区交给渲染线程执行时，
+   * 资源可能在执行前被场景释放，录制命令的一方须同时调用本函数。
+   * 与上一次持有的资源相同时跳过，批处理良好的场景几乎没有额外开销
+   * @param resource 命令引用的资源
+   */
+  template <typename T>
+  void retain(const std::shared_ptr<T>& resource) {
+    if (resource && resource.get() != lastRetained_) {
+      lastRetained_ = resource.get();
+      retained_.push_back(resource);
+    }
+  }
+
+  /**
+   * @brief 追加另一缓冲区的全部命令（按其提交顺序，重新编号）
+   *
+   * 剔除统计与持有的资源一并追加；只拷贝命令头，负载仍位于 other 的帧内存中，
+   * other 在本缓冲区使用完毕之前不得 clear() 或销毁
+   */
+  void append(const RenderCommandBuffer& other);
+  
+  /// 将顶点拷贝到帧内存，返回的指针在 clear() 前有效
+  const Vec2* copyPoints(const Vec2* points, size_t count);
+  /// 在帧内存中分配顶点，供调用方直接写入
+  Vec2* allocatePoints(size_t count);
+  /// 将索引拷贝到帧内存，返回的指针在 clear() 前有效
+  const uint32_t* copyIndices(const uint32_t* indices, size_t count);
+  /// 将文字拷贝到帧内存（以 '\0' 结尾），返回的指针在 clear() 前有效
+  const char* copyText(const std::string& text);
+  
+  // 排序命令：按 RenderSortKey 做稳定的基数排序，结果见 getSortedOrder()
   void sortCommands();
   
-  // 清空缓冲区
+  /**
+   * @brief 设置收集时的剔除矩形（世界坐标）
+   *
+   * 设置后 Node::collectRenderCommands 跳过内容包围盒与之不相交的节点；
+   * 剔除矩形不随 clear() 清除
+   * @param unitsPerPixel 每屏幕像素对应的世界单位，换算按像素计的描边宽度
+   */
+  void setCullRect(const Rect& rect, float unitsPerPixel = 1.0f) {
+    cullRect_ = rect;
+    cullUnitsPerPixel_ = unitsPerPixel;
+    culling_ = true;
+  }
+  void clearCullRect() { culling_ = false; }
+  /// 未设置剔除矩形时返回 nullptr
+  const Rect* getCullRect() const { return culling_ ? &cullRect_ : nullptr; }
+  float getCullUnitsPerPixel() const { return cullUnitsPerPixel_; }
+  /// 收集期间累计的剔除统计，clear() 时清零
+  CullStats& getCullStats() { return cullStats_; }
+  const CullStats& getCullStats() const { return cullStats_; }
+  
+  /**
+   * @brief 获取排序后的命令下标
+   *
+   * 排序只重排下标，命令头保持提交顺序存放；
+   * 排序后再追加命令会使结果失效，此时 isSorted() 为 false
+   */
+  const std::vector<uint32_t>& getSortedOrder() const { return sortedOrder_; }
+  bool isSorted() const { return !commands_.empty() && sortedOrder_.size() == commands_.size(); }
+  
+  // 清空缓冲区（保留全部内存供下一帧复用）
   void clear();
   
   // 获取命令列表
   const std::vector<RenderCommand>& getCommands() const { return commands_; }
-  std::vector<RenderCommand>& getCommands() { return commands_; }
   
   // 统计
   size_t size() const { return commands_.size(); }
   bool empty() const { return commands_.empty(); }
   size_t capacity() const { return commands_.capacity(); }
+  /// 本帧负载占用的字节数
+  size_t getPayloadBytes() const { return arena_.getUsedBytes(); }
   
   // 预分配空间
   void reserve(size_t capacity);
   
 private:
+  struct SortEntry {
+    uint64_t key;
+    uint32_t index;
+  };
+
   std::vector<RenderCommand> commands_;
+  LinearArena arena_;
   uint32_t nextOrder_;
   
-  // 排序比较函数
-  static bool compareCommands(const RenderCommand& a, const RenderCommand& b);
+  std::vector<uint32_t> sortedOrder_;
+  
+  // retain() 持有的资源，clear() 时释放
+  std::vector<std::shared_ptr<const void>> retained_;
+  const void* lastRetained_ = nullptr;
+  
+  Rect cullRect_;
+  float cullUnitsPerPixel_ = 1.0f;
+  bool culling_ = false;
+  CullStats cullStats_;
+  
+  // 排序用的复用缓冲，避免每帧分配
+  std::vector<SortEntry> sortEntries_;
+  std::vector<SortEntry> sortScratch_;
 };
 
 } // namespace extra2d
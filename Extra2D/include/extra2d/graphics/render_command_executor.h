@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <extra2d/graphics/render_command.h>
+#include <string>
+#include <vector>
+
+namespace extra2d {
+
+class RenderBackend;
+
+// ============================================================================
+// 渲染命令执行器 - 将排序后的命令队列回放到渲染后端
+// 相邻的同类命令连续提交，由后端的精灵/形状/文字批次合并为少量绘制调用；
+// 形状命令的变换经后端变换栈应用，相邻命令变换相同时只压栈一次
+// ============================================================================
+class RenderCommandExecutor {
+public:
+  struct Stats {
+    uint32_t commands = 0;        // 执行的命令数
+    uint32_t spriteRuns = 0;      // 连续同纹理精灵段数
+    uint32_t shapeRuns = 0;       // 连续形状段数
+    uint32_t textRuns = 0;        // 连续文字段数
+    uint32_t transformPushes = 0; // 实际压入变换栈的次数
+    uint32_t skipped = 0;         // 无法执行的命令（空命令、缺少资源等）
+  };
+
+  /**
+   * @brief 执行命令缓冲区中的全部命令（已排序时按排序结果的顺序）
+   * @param renderer 渲染后端，调用期间应处于精灵批处理中
+   * @param buffer 命令缓冲区
+   */
+  void execute(RenderBackend &renderer, const RenderCommandBuffer &buffer);
+  /// 按列表顺序执行
+  void execute(RenderBackend &renderer,
+               const std::vector<RenderCommand> &commands);
+
+  const Stats &getStats() const { return stats_; }
+
+private:
+  enum class RunKind : uint8_t { None, Sprite, Shape, Text };
+
+  Stats stats_;
+  RunKind runKind_ = RunKind::None;
+  const Texture *runTexture_ = nullptr;
+  bool transformPushed_ = false;
+  Affine2D pushedTransform_;
+
+  // 后端接口需要 vector / string，复用暂存避免每条命令分配
+  std::vector<Vec2> scratchPoints_;
+  std::string scratchText_;
+
+  void beginExecute();
+  void executeCommand(RenderBackend &renderer, const RenderCommand &cmd);
+  void beginRun(RunKind kind, const Texture *texture);
+  void applyTransform(RenderBackend &renderer, const Affine2D &transform);
+  void restoreTransform(RenderBackend &renderer);
+
+  void drawSprite(RenderBackend &renderer, const RenderCommand &cmd);
+  bool drawShape(RenderBackend &renderer, const RenderCommand &cmd);
+  void drawText(RenderBackend &renderer, const RenderCommand &cmd);
+};
+
+} // namespace extra2d
@@ -30,7 +30,7 @@ struct RenderConfigData {
     bool depthTest = false;
     bool blending = true;
     bool dithering = false;
-    int spriteBatchSize = 1000;
+    int spriteBatchSize = 10000;
     int maxRenderTargets = 1;
     bool allowShaderHotReload = false;
     std::string shaderCachePath;
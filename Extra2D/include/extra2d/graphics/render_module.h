@@ -15,7 +15,18 @@ public:
     int targetFPS = 60;
     int multisamples = 0;
     bool sRGBFramebuffer = false;
-    int spriteBatchSize = 1000;
+    int spriteBatchSize = 10000;
+    VertexStreamMode spriteStreamMode = VertexStreamMode::SubData;
+    bool spriteCompactVertices = false;
+    int spriteTextureSlots = 1;
+    bool spriteInstanced = false;
+    int spriteParallelThreshold = 8192;
+    bool spriteBatchShapes = false;
+    bool sdfShapes = true;
+    // 渲染线程：延迟渲染场景的命令交给渲染线程执行，与下一帧的更新并行；
+    // 立即模式场景仍逐帧同步绘制（见 Scene::setDeferredRendering）
+    bool renderThread = false;
+    int renderThreadFrames = 2;
     
     ModuleInfo getModuleInfo() const override {
         ModuleInfo info;
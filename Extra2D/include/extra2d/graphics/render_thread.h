@@ -0,0 +1,138 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <extra2d/core/color.h>
+#include <extra2d/graphics/render_command.h>
+#include <extra2d/graphics/render_command_executor.h>
+#include <functional>
+#include <glm/mat4x4.hpp>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace extra2d {
+
+class IWindow;
+class RenderBackend;
+
+// ============================================================================
+// 渲染线程 - 流水线模式下独占图形上下文，执行主线程提交的帧
+// 主线程录制第 N+1 帧的命令时，渲染线程执行第 N 帧并交换缓冲区；
+// 帧槽数为 2（双缓冲）或 3（三缓冲），槽全部在途时主线程在 beginFrame() 等待。
+//
+// 同步点：运行期间图形上下文只在渲染线程上为当前。渲染线程启动后登记为
+// GPUContext 的所属线程：其他线程上的 GPU 资源创建与上传经 invoke() 转到
+// 渲染线程同步执行；资源在任意线程析构时其 GPU 对象排队，每执行完一帧或
+// 一个任务后释放。帧槽持有命令引用的纹理（RenderCommandBuffer::retain），
+// 直到该槽被 beginFrame() 复用，在途帧引用的资源不会提前析构。
+// invoke() 与帧按提交顺序排队，执行时之前提交的帧均已完成，且调用方阻塞
+// 等待，因此任务内可安全访问场景数据
+// ============================================================================
+class RenderThread {
+public:
+  static constexpr size_t MIN_FRAMES = 2;
+  static constexpr size_t MAX_FRAMES = 3;
+
+  /**
+   * @brief 一帧的渲染数据，由主线程填写、渲染线程执行
+   */
+  struct Frame {
+    RenderCommandBuffer commands; // 已排序的命令
+    Color clearColor = Colors::Black;
+    int viewportX = 0;
+    int viewportY = 0;
+    int viewportWidth = 0;
+    int viewportHeight = 0;
+    glm::mat4 viewProjection{1.0f};
+    float time = 0.0f;
+  };
+
+  struct Stats {
+    uint64_t framesSubmitted = 0;
+    uint64_t framesExecuted = 0;
+    double producerWaitMs = 0.0; // 主线程等待空闲帧槽的累计时间
+    double consumerWaitMs = 0.0; // 渲染线程等待新帧的累计时间
+  };
+
+  RenderThread() = default;
+  ~RenderThread();
+
+  RenderThread(const RenderThread &) = delete;
+  RenderThread &operator=(const RenderThread &) = delete;
+
+  /**
+   * @brief 启动渲染线程并移交图形上下文（主线程调用）
+   * @param window 持有上下文的窗口
+   * @param renderer 渲染后端，之后只在渲染线程上使用
+   * @param frameCount 帧槽数，限制在 [MIN_FRAMES, MAX_FRAMES]
+   * @return 启动成功返回true
+   */
+  bool start(IWindow *window, RenderBackend *renderer, size_t frameCount);
+
+  /**
+   * @brief 执行完已提交的帧后停止，上下文交还调用线程
+   */
+  void stop();
+
+  bool isRunning() const { return thread_.joinable(); }
+
+  /**
+   * @brief 获取下一个空闲帧槽（主线程调用，必要时等待）
+   * @return 已清空命令的帧，填写后调用 submitFrame()
+   */
+  Frame &beginFrame();
+
+  /**
+   * @brief 提交 beginFrame() 返回的帧
+   */
+  void submitFrame();
+
+  /**
+   * @brief 在渲染线程上执行任务并等待完成（同步点）
+   * @param task 任务，在之前提交的帧全部执行后运行；未运行或正在停止时
+   *             等上下文交还后在调用线程执行
+   */
+  void invoke(const std::function<void()> &task);
+
+  /**
+   * @brief 等待已提交的帧全部执行完毕
+   */
+  void sync();
+
+  Stats getStats() const;
+
+private:
+  struct Item {
+    Frame *frame = nullptr;                      // 帧，或
+    const std::function<void()> *task = nullptr; // 同步任务
+  };
+
+  void threadMain();
+  void executeFrame(Frame &frame);
+
+  IWindow *window_ = nullptr;
+  RenderBackend *renderer_ = nullptr;
+  RenderCommandExecutor executor_;
+
+  std::vector<std::unique_ptr<Frame>> frames_;
+  std::vector<bool> frameBusy_;
+  size_t nextFrame_ = 0;
+  Frame *pendingFrame_ = nullptr;
+
+  std::thread thread_;
+  mutable std::mutex mutex_;
+  std::condition_variable itemCond_; // 有新条目或需要停止
+  std::condition_variable doneCond_; // 帧槽释放或任务完成
+  std::deque<Item> queue_;
+  uint64_t completedItems_ = 0;
+  uint64_t queuedItems_ = 0;
+  bool stopping_ = false;
+  bool contextReady_ = false;
+  Stats stats_;
+};
+
+} // namespace extra2d
@@ -12,6 +12,11 @@ namespace extra2d {
 
 class Color;
 
+/// uniform 句柄，由 IShader::uniform() 返回，重新编译后失效
+using UniformId = int32_t;
+/// 着色器中不存在（或被优化掉）的 uniform
+constexpr UniformId INVALID_UNIFORM = -1;
+
 // ============================================================================
 // Shader抽象接口 - 渲染后端无关
 // ============================================================================
@@ -85,6 +90,30 @@ public:
      */
     virtual void setColor(const std::string& name, const Color& color) = 0;
 
+    // ------------------------------------------------------------------------
+    // 句柄接口：一次查找，之后按整数句柄设置；值未变化时不下发
+    // ------------------------------------------------------------------------
+
+    /**
+     * @brief 查找uniform句柄
+     * @param name uniform变量名
+     * @return uniform句柄，不存在时返回 INVALID_UNIFORM
+     */
+    virtual UniformId uniform(const char* name) = 0;
+
+    /**
+     * @brief 按句柄设置uniform变量（无需先绑定Shader）
+     * @param id uniform句柄，INVALID_UNIFORM 时忽略
+     * @param value 值
+     */
+    virtual void set(UniformId id, int value) = 0;
+    virtual void set(UniformId id, float value) = 0;
+    virtual void set(UniformId id, const glm::vec2& value) = 0;
+    virtual void set(UniformId id, const glm::vec3& value) = 0;
+    virtual void set(UniformId id, const glm::vec4& value) = 0;
+    virtual void set(UniformId id, const glm::mat4& value) = 0;
+    virtual void set(UniformId id, const Color& color) = 0;
+
     /**
      * @brief 检查Shader是否有效
      * @return 有效返回true，否则返回false
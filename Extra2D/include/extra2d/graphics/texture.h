@@ -2,6 +2,7 @@
 
 #include <extra2d/core/types.h>
 #include <extra2d/core/math_types.h>
+#include <cstdint>
 
 namespace extra2d {
 
@@ -35,7 +36,21 @@ enum class PixelFormat {
 // ============================================================================
 class Texture {
 public:
-    virtual ~Texture() = default;
+    /// 未分配排序 ID（ID 耗尽或非纹理命令）
+    static constexpr uint16_t INVALID_SORT_ID = 0;
+
+    Texture();
+    Texture(const Texture& other);
+    Texture& operator=(const Texture& other);
+    virtual ~Texture();
+
+    /**
+     * @brief 获取排序 ID
+     *
+     * 纹理存活期间不变的小整数，释放后回收复用；用于渲染命令的排序键，
+     * 避免以指针位作键导致的碰撞
+     */
+    uint16_t getSortId() const { return sortId_; }
 
     // 获取尺寸
     virtual int getWidth() const = 0;
@@ -59,6 +74,9 @@ public:
     
     // 设置环绕模式
     virtual void setWrap(bool repeat) = 0;
+
+private:
+    uint16_t sortId_;
 };
 
 } // namespace extra2d
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <array>
+#include <extra2d/core/math_types.h>
+#include <vector>
+
+namespace extra2d {
+
+// ============================================================================
+// 单位圆查找表 - 按分段数缓存 (cos, sin)，圆的细分不再逐段计算三角函数
+// 另提供按屏幕半径估算分段数的 LOD 规则
+// ============================================================================
+class UnitCircleCache {
+public:
+  static constexpr int MAX_SEGMENTS = 128;
+  // 自动 LOD 的最少分段数
+  static constexpr int MIN_AUTO_SEGMENTS = 8;
+  // 自动 LOD 允许的弦高误差（像素）
+  static constexpr float DEFAULT_TOLERANCE = 0.25f;
+
+  /**
+   * @brief 获取指定分段数的单位圆顶点
+   * @param segments 分段数，限制在 [1, MAX_SEGMENTS]
+   * @return segments + 1 个顶点，最后一个与第一个重合；首次使用时生成
+   */
+  const Vec2 *get(int segments);
+
+  /**
+   * @brief 按屏幕空间半径估算分段数
+   * @param pixelRadius 投影到屏幕后的半径（像素）
+   * @param tolerance 弦与圆弧的最大偏差（像素）
+   * @return 分段数，取 4 的倍数并限制在 [MIN_AUTO_SEGMENTS, MAX_SEGMENTS]
+   */
+  static int segmentsForRadius(float pixelRadius,
+                               float tolerance = DEFAULT_TOLERANCE);
+
+private:
+  std::array<std::vector<Vec2>, MAX_SEGMENTS + 1> tables_;
+};
+
+} // namespace extra2d
@@ -53,6 +53,15 @@ public:
      */
     virtual void swap() = 0;
 
+    /**
+     * @brief 将图形上下文绑定到调用线程或从调用线程解绑
+     * @param current true 绑定，false 解绑
+     * @return 成功返回 true
+     *
+     * 上下文同一时刻只能在一个线程上为当前，移交给渲染线程前须先在原线程解绑
+     */
+    virtual bool makeContextCurrent(bool current) = 0;
+
     /**
      * @brief 窗口是否应该关闭
      */
@@ -5,6 +5,9 @@
 #include <extra2d/core/types.h>
 #include <extra2d/event/event_dispatcher.h>
 #include <extra2d/graphics/render_backend.h>
+#include <extra2d/graphics/render_command.h>
+#include <extra2d/scene/spatial_index.h>
+#include <extra2d/scene/transform_system.h>
 #include <memory>
 #include <string>
 #include <vector>
@@ -14,7 +17,7 @@ namespace extra2d {
 // 前向声明
 class Scene;
 class RenderBackend;
-struct RenderCommand;
+class ParallelCommandCollector;
 
 // ============================================================================
 // 节点基类 - 场景图的基础
@@ -24,6 +27,12 @@ public:
   Node();
   virtual ~Node();
 
+  // 节点独占变换系统中的槽位，且回调捕获了 this，禁止拷贝与移动
+  Node(const Node &) = delete;
+  Node &operator=(const Node &) = delete;
+  Node(Node &&) = delete;
+  Node &operator=(Node &&) = delete;
+
   // ------------------------------------------------------------------------
   // 层级管理
   // ------------------------------------------------------------------------
@@ -50,15 +59,15 @@ public:
   // ------------------------------------------------------------------------
   void setPos(const Vec2 &pos);
   void setPos(float x, float y);
-  Vec2 getPosition() const { return position_; }
+  Vec2 getPosition() const { return transforms().position(transformIndex_); }
 
   void setRotation(float degrees);
-  float getRotation() const { return rotation_; }
+  float getRotation() const { return transforms().rotation(transformIndex_); }
 
   void setScale(const Vec2 &scale);
   void setScale(float scale);
   void setScale(float x, float y);
-  Vec2 getScale() const { return scale_; }
+  Vec2 getScale() const { return transforms().scale(transformIndex_); }
 
   void setAnchor(const Vec2 &anchor);
   void setAnchor(float x, float y);
@@ -66,7 +75,7 @@ public:
 
   void setSkew(const Vec2 &skew);
   void setSkew(float x, float y);
-  Vec2 getSkew() const { return skew_; }
+  Vec2 getSkew() const { return transforms().skew(transformIndex_); }
 
   void setOpacity(float opacity);
   float getOpacity() const { return opacity_; }
@@ -102,25 +111,35 @@ public:
   Vec2 toWorld(const Vec2 &localPos) const;
   Vec2 toLocal(const Vec2 &worldPos) const;
 
-  glm::mat4 getLocalTransform() const;
-  glm::mat4 getWorldTransform() const;
+  Affine2D getLocalTransform() const;
+  Affine2D getWorldTransform() const;
 
   /**
-   * @brief 标记变换矩阵为脏状态，并传播到所有子节点
+   * @brief 标记变换为脏状态，并传播到所有子节点
    */
   void markTransformDirty();
 
   /**
-   * @brief 批量更新变换矩阵
-   * 在渲染前统一计算所有脏节点的变换矩阵，避免逐节点计算时的重复递归
+   * @brief 批量更新变换
+   * 在渲染前统一计算所有脏节点的变换：变换系统按父前子后的顺序
+   * 线性扫描脏区间（会一并更新其他节点树中的脏节点）
    */
   void batchTransforms();
 
   /**
    * @brief 获取变换脏标记状态
    */
-  bool isTransformDirty() const { return transformDirty_; }
-  bool isWorldTransformDirty() const { return worldTransformDirty_; }
+  bool isTransformDirty() const {
+    return transforms().isLocalDirty(transformIndex_);
+  }
+  bool isWorldTransformDirty() const {
+    return transforms().isWorldDirty(transformIndex_);
+  }
+
+  /**
+   * @brief 获取节点在变换系统中的槽位（节点重新挂接或压实后会变化）
+   */
+  TransformSystem::Index getTransformIndex() const { return transformIndex_; }
 
   // ------------------------------------------------------------------------
   // 名称和标签
@@ -146,11 +165,42 @@ public:
   // ------------------------------------------------------------------------
   virtual Rect getBounds() const;
 
+  // ------------------------------------------------------------------------
+  // 视口剔除
+  // ------------------------------------------------------------------------
+  /**
+   * @brief 获取节点自身内容的世界坐标轴对齐包围盒（缓存，变换或内容变化后重算）
+   * @param bounds 输出包围盒
+   * @return 节点报告了内容边界（见 getLocalBounds）返回true
+   */
+  bool getWorldBounds(Rect &bounds) const;
+
+  /**
+   * @brief 获取节点及其全部后代内容的世界坐标包围盒（缓存）
+   * @param bounds 输出包围盒
+   * @return 子树中至少一个节点报告了内容边界返回true
+   */
+  bool getSubtreeBounds(Rect &bounds) const;
+
+  /**
+   * @brief 设置子树剔除
+   * 开启后子树包围盒在剔除矩形之外时整棵子树不再访问，适合成组摆放的
+   * 大量节点；子树中只经 onDraw 绘制而不报告边界的节点也会随之被剔除
+   */
+  void setSubtreeCulling(bool enabled) { subtreeCulling_ = enabled; }
+  bool isSubtreeCulling() const { return subtreeCulling_; }
+
   // ------------------------------------------------------------------------
   // 事件系统
   // ------------------------------------------------------------------------
   EventDispatcher &getEventDispatcher() { return eventDispatcher_; }
 
+  /**
+   * @brief 子树（含自身）中是否有节点注册了事件监听器
+   * 随监听器增删与子节点增删增量维护，命中测试据此跳过无监听器的子树
+   */
+  bool hasListenersInSubtree() const { return subtreeListenerNodes_ != 0; }
+
   // ------------------------------------------------------------------------
   // 内部方法
   // ------------------------------------------------------------------------
@@ -158,37 +208,85 @@ public:
   void render(RenderBackend &renderer);
   void sortChildren();
 
+  /**
+   * @brief 获取按Z序排好的子节点（顺序失效时先排序），与绘制顺序一致
+   */
+  const std::vector<Ptr<Node>> &getSortedChildren();
+
   bool isRunning() const { return running_; }
   Scene *getScene() const { return scene_; }
 
-  // 多线程渲染命令收集
-  virtual void collectRenderCommands(std::vector<RenderCommand> &commands,
+  // 渲染命令收集（单线程递归；按子树并行收集见 ParallelCommandCollector）
+  virtual void collectRenderCommands(RenderCommandBuffer &commands,
                                      int parentZOrder = 0);
 
 protected:
+  friend class ParallelCommandCollector;
+  friend class Scene;
+  friend class TransformSystem;
+
   // 子类重写
   virtual void onDraw(RenderBackend &renderer) {}
   virtual void onUpdateNode(float dt) {}
-  virtual void generateRenderCommand(std::vector<RenderCommand> &commands,
+  // 命令引用纹理、字体等资源时须同时 commands.retain()，命令可能在渲染线程上
+  // 延后执行
+  virtual void generateRenderCommand(RenderCommandBuffer &commands,
                                      int zOrder) {};
 
-  // 供子类访问的内部状态
-  Vec2 &getPositionRef() { return position_; }
-  Vec2 &getScaleRef() { return scale_; }
+  /**
+   * @brief 获取节点内容在局部坐标系（世界变换之前）中的边界
+   * @param bounds 输出边界
+   * @return 无可绘制内容或范围未知时返回false，此类节点自身不参与剔除
+   */
+  virtual bool getLocalBounds(Rect &bounds) const { return false; }
+
+  /**
+   * @brief 内容超出局部边界、按屏幕像素计的宽度（如描边半宽）
+   * @return 像素宽度；剔除时按可见区域的缩放换算为世界单位加到包围盒上
+   *
+   * 变化时同样须调用 markBoundsDirty()
+   */
+  virtual float getScreenPadding() const { return 0.0f; }
+
+  /**
+   * @brief 内容范围变化时由子类调用，使缓存的包围盒失效
+   */
+  void markBoundsDirty();
+
+  /**
+   * @brief 剔除测试：开启子树剔除且子树包围盒与剔除矩形不相交
+   * @param unitsPerPixel 每屏幕像素对应的世界单位，用于换算 getScreenPadding()
+   * @return 整棵子树可跳过返回true，并计入 stats.subtreesCulled
+   */
+  bool isSubtreeCulled(const Rect &cullRect, float unitsPerPixel,
+                       CullStats &stats) const;
+
+  /**
+   * @brief 剔除测试：自身内容包围盒与剔除矩形不相交
+   * @param unitsPerPixel 每屏幕像素对应的世界单位，用于换算 getScreenPadding()
+   * @return 自身内容可跳过返回true；报告了边界的节点计入 drawn 或 culled
+   */
+  bool isContentCulled(const Rect &cullRect, float unitsPerPixel,
+                       CullStats &stats) const;
+
+  // 供子类访问的内部状态（位置与缩放存放在变换系统中，新建节点会使其引用失效，
+  // 请使用 setPos/setScale 修改）
   Vec2 &getAnchorRef() { return anchor_; }
-  float getRotationRef() { return rotation_; }
+  float getRotationRef() { return transforms().rotation(transformIndex_); }
   float getOpacityRef() { return opacity_; }
 
 private:
   // ==========================================================================
   // 成员变量按类型大小降序排列，减少内存对齐填充
-  // 64位系统对齐：std::string(32) > glm::mat4(64) > std::vector(24) >
+  // 64位系统对齐：std::string(32) > std::vector(24) >
   //              double(8) > float(4) > int(4) > bool(1)
   // ==========================================================================
 
-  // 1. 大块内存（64字节）
-  mutable glm::mat4 localTransform_; // 64 bytes
-  mutable glm::mat4 worldTransform_; // 64 bytes
+  // 1. 剔除缓存：内容与子树的世界坐标包围盒（16字节）
+  // 局部 TRS 与仿射变换保存在 TransformSystem 中，经 transformIndex_ 访问
+  mutable Rect worldBounds_;   // 16 bytes
+  mutable Rect subtreeBounds_; // 16 bytes
+  mutable float subtreePadding_ = 0.0f; // 子树中最大的 getScreenPadding()
 
   // 2. 字符串和容器（24-32字节）
   std::string name_;                // 32 bytes
@@ -204,15 +302,11 @@ private:
   // 5. 父节点引用
   WeakPtr<Node> parent_; // 16 bytes
 
-  // 7. 变换属性（按访问频率分组）
-  Vec2 position_ = Vec2::Zero();   // 8 bytes
-  Vec2 scale_ = Vec2(1.0f, 1.0f);  // 8 bytes
+  // 7. 变换属性（锚点在渲染时处理，不参与局部变换）
   Vec2 anchor_ = Vec2(0.5f, 0.5f); // 8 bytes
-  Vec2 skew_ = Vec2::Zero();       // 8 bytes
 
   // 8. 浮点属性
-  float rotation_ = 0.0f; // 4 bytes
-  float opacity_ = 1.0f;  // 4 bytes
+  float opacity_ = 1.0f; // 4 bytes
 
   // 10. 颜色属性
   Color3B color_ = Color3B(255, 255, 255); // 3 bytes
@@ -225,15 +319,33 @@ private:
   bool flipX_ = false; // 1 byte
   bool flipY_ = false; // 1 byte
 
-  // 13. 场景指针
-  Scene *scene_ = nullptr; // 8 bytes
+  // 13. 场景指针与场景空间索引中的句柄
+  Scene *scene_ = nullptr;                                     // 8 bytes
+  SpatialIndex::Handle spatialHandle_ = SpatialIndex::INVALID_HANDLE; // 4 bytes
+
+  // 13.1 变换系统中的槽位
+  TransformSystem::Index transformIndex_; // 4 bytes
+
+  // 13.2 子树（含自身）中注册了监听器的节点数
+  uint32_t subtreeListenerNodes_ = 0; // 4 bytes
 
   // 14. 布尔标志（打包在一起）
-  mutable bool transformDirty_ = true;      // 1 byte
-  mutable bool worldTransformDirty_ = true; // 1 byte
   bool childrenOrderDirty_ = false;         // 1 byte
   bool visible_ = true;                     // 1 byte
   bool running_ = false;                    // 1 byte
+  mutable bool worldBoundsDirty_ = true;    // 1 byte
+  mutable bool subtreeBoundsDirty_ = true;  // 1 byte
+  mutable bool hasWorldBounds_ = false;     // 1 byte
+  mutable bool hasSubtreeBounds_ = false;   // 1 byte
+  bool subtreeCulling_ = false;             // 1 byte
+
+  static TransformSystem &transforms() { return TransformSystem::get(); }
+  void linkTransform(Node *parent);
+  void relocateTransforms(TransformSystem::Index parentIndex);
+  void markTransformDirtyRecursive();
+  void invalidateAncestorBounds();
+  void markSpatialDirty();
+  void addSubtreeListenerNodes(int32_t delta);
 };
 
 } // namespace extra2d
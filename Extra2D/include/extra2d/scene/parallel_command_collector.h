@@ -0,0 +1,77 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <extra2d/graphics/render_command.h>
+#include <memory>
+#include <vector>
+
+namespace extra2d {
+
+class Node;
+
+// ============================================================================
+// 并行渲染命令收集器
+// 在 splitDepth 层把场景树切分为若干子树任务，浅层节点自身的命令在调用线程上
+// 按深度优先顺序记录为单独的任务；连续的任务划分为块，各块在线程池中收集到
+// 各自的 RenderCommandBuffer，最后按块顺序合并。合并后的提交顺序与
+// Node::collectRenderCommands 的单线程递归完全一致，排序结果也因此相同。
+// 调用前节点的世界变换必须已是最新（Scene::renderContent 先执行 batchTransforms），
+// 收集期间只读取变换缓存。out 设置了剔除矩形时各块沿用同一矩形，
+// 浅层节点的剔除（含子树包围盒的计算）在切分前于调用线程上完成
+// ============================================================================
+class ParallelCommandCollector {
+public:
+  static constexpr int DEFAULT_SPLIT_DEPTH = 1;
+
+  struct Stats {
+    uint32_t tasks = 0;    // 子树任务与浅层节点任务总数
+    uint32_t subtrees = 0; // 其中的子树任务数
+    uint32_t chunks = 0;   // 并行执行的块数
+  };
+
+  /**
+   * @brief 设置切分深度
+   * @param depth 根节点深度为 0，深度达到该值的节点连同其子树作为一个任务；
+   *              0 表示不切分（整棵树一个任务）
+   */
+  void setSplitDepth(int depth) { splitDepth_ = depth < 0 ? 0 : depth; }
+  int getSplitDepth() const { return splitDepth_; }
+
+  /**
+   * @brief 收集 root 及其子树的渲染命令，追加到 out
+   * @param root 根节点
+   * @param out 输出缓冲区；其中的命令引用本收集器为 out 保留的各块的帧内存，
+   *            在下一次以同一 out 调用 collect() 之前有效
+   * @param parentZOrder 根节点父级的累积 Z 序
+   */
+  void collect(Node &root, RenderCommandBuffer &out, int parentZOrder = 0);
+
+  const Stats &getStats() const { return stats_; }
+
+private:
+  struct Task {
+    Node *node;
+    int zOrder;   // 子树任务为父级累积 Z 序，浅层任务为节点自身的累积 Z 序
+    bool subtree; // true：收集整棵子树；false：只生成节点自身的命令
+  };
+
+  struct ChunkSet {
+    const RenderCommandBuffer *owner;
+    std::vector<std::unique_ptr<RenderCommandBuffer>> buffers;
+  };
+
+  void gatherTasks(Node &node, RenderCommandBuffer &out, int parentZOrder,
+                   int depth);
+  std::vector<std::unique_ptr<RenderCommandBuffer>> &
+  getChunkBuffers(const RenderCommandBuffer &out);
+
+  int splitDepth_ = DEFAULT_SPLIT_DEPTH;
+  Stats stats_;
+  std::vector<Task> tasks_;
+  std::vector<size_t> chunkBegins_;
+  // 每个输出缓冲区一组块缓冲区，每块一个，跨帧复用以保留命令数组与帧内存
+  std::vector<ChunkSet> chunkSets_;
+};
+
+} // namespace extra2d
@@ -2,21 +2,22 @@
 
 #include <extra2d/core/color.h>
 #include <extra2d/graphics/camera.h>
+#include <extra2d/graphics/render_command.h>
+#include <extra2d/graphics/render_command_executor.h>
 #include <extra2d/scene/node.h>
+#include <extra2d/scene/parallel_command_collector.h>
+#include <extra2d/scene/spatial_index.h>
 #include <vector>
 
 namespace extra2d {
 
-// 前向声明
-struct RenderCommand;
-
 // ============================================================================
 // 场景类 - 节点容器，管理整个场景图
 // ============================================================================
 class Scene : public Node {
 public:
   Scene();
-  ~Scene() override = default;
+  ~Scene() override;
 
   // ------------------------------------------------------------------------
   // 场景属性
@@ -51,13 +52,76 @@ public:
   void pause() { paused_ = true; }
   void resume() { paused_ = false; }
 
+  // ------------------------------------------------------------------------
+  // 延迟渲染：收集渲染命令、排序后由执行器按批次回放，
+  // 同一层级内按纹理归并以减少绘制调用；只有生成渲染命令的节点
+  //（Sprite、ShapeNode 等）会被绘制，仅重写 onDraw 的节点需保持立即模式。
+  // 启用渲染线程时只有延迟渲染场景与更新流水线并行，立即模式场景在渲染
+  // 线程上同步绘制
+  // ------------------------------------------------------------------------
+  void setDeferredRendering(bool enabled) { deferredRendering_ = enabled; }
+  bool isDeferredRendering() const { return deferredRendering_; }
+  const RenderCommandExecutor::Stats &getDeferredStats() const {
+    return commandExecutor_.getStats();
+  }
+
+  // 延迟模式下按子树并行收集命令（结果与单线程收集一致），
+  // 切分深度经 getCommandCollector().setSplitDepth() 调整
+  void setParallelCollection(bool enabled) { parallelCollection_ = enabled; }
+  bool isParallelCollection() const { return parallelCollection_; }
+  ParallelCommandCollector &getCommandCollector() { return commandCollector_; }
+
+  // 更新变换并按当前收集方式录制命令（未排序），供延迟模式与渲染线程使用；
+  // 启用渲染线程时场景总是以延迟方式绘制，重写 renderContent 的绘制不生效
+  void recordCommands(RenderCommandBuffer &commands);
+
+  // ------------------------------------------------------------------------
+  // 视口剔除：立即模式与命令收集均跳过内容包围盒在可见区域之外的节点，
+  // 只对报告了内容边界的节点（Sprite、ShapeNode 等）生效
+  // ------------------------------------------------------------------------
+  void setCulling(bool enabled) { culling_ = enabled; }
+  bool isCulling() const { return culling_; }
+
+  // 可见区域（世界坐标）；未设置时取活动相机的可见范围。
+  // Application 每帧按相机服务的视图-投影矩阵更新；unitsPerPixel 为每屏幕
+  // 像素对应的世界单位，用于换算按像素计的描边（见 Node::getScreenPadding）
+  void setCullRect(const Rect &rect, float unitsPerPixel = 1.0f);
+  void clearCullRect() { hasCullRect_ = false; }
+  Rect getCullRect() const;
+  float getCullUnitsPerPixel() const;
+
+  // 最近一帧的剔除统计
+  const CullStats &getCullStats() const { return cullStats_; }
+
+  // ------------------------------------------------------------------------
+  // 空间索引：按世界包围盒登记场景中报告了内容边界的节点，节点变换或
+  // 内容变化时增量更新；查询结果为不持有所有权的节点指针，追加到 out
+  // ------------------------------------------------------------------------
+  void setSpatialIndexing(bool enabled);
+  bool isSpatialIndexing() const { return spatialIndexing_; }
+  SpatialIndex &getSpatialIndex() { return spatialIndex_; }
+
+  // 处理待更新的节点（查询前自动调用；渲染剔除不使用索引）
+  void updateSpatialIndex() { spatialIndex_.refresh(); }
+
+  void queryRect(const Rect &rect, std::vector<Node *> &out);
+  void queryPoint(const Vec2 &point, std::vector<Node *> &out);
+  void queryRadius(const Vec2 &center, float radius, std::vector<Node *> &out);
+
+  // ------------------------------------------------------------------------
+  // 命中测试：返回绘制顺序中最上层、注册了监听器且包含该点的可见节点。
+  // 开启空间索引时只在索引中查找（不报告内容边界的节点不参与），
+  // 否则按Z序逆序遍历，跳过没有监听器的子树；两种方式都不分配内存
+  // ------------------------------------------------------------------------
+  Node *hitTest(const Vec2 &worldPos);
+
   // ------------------------------------------------------------------------
   // 渲染和更新
   // ------------------------------------------------------------------------
   void renderScene(RenderBackend &renderer);
   virtual void renderContent(RenderBackend &renderer);
   void updateScene(float dt);
-  void collectRenderCommands(std::vector<RenderCommand> &commands,
+  void collectRenderCommands(RenderCommandBuffer &commands,
                             int parentZOrder = 0) override;
 
   // ------------------------------------------------------------------------
@@ -73,6 +137,7 @@ protected:
   virtual void onExitTransitionDidStart() {}
   virtual void onEnterTransitionDidFinish() {}
 
+  friend class Node;
   friend class SceneManager;
   friend class TransitionScene;
 
@@ -84,6 +149,27 @@ private:
   Ptr<Camera> defaultCamera_;
 
   bool paused_ = false;
+
+  bool culling_ = false;
+  bool hasCullRect_ = false;
+  Rect cullRect_;
+  float cullUnitsPerPixel_ = 1.0f;
+  CullStats cullStats_;
+  bool spatialIndexing_ = false;
+  SpatialIndex spatialIndex_;
+  std::vector<Node *> hitCandidates_;
+  void registerSpatialSubtree(Node &node);
+
+  // 立即模式渲染期间生效的剔除矩形，供 Node::onRender 读取
+  const Rect *renderCullRect_ = nullptr;
+  float renderUnitsPerPixel_ = 1.0f;
+  const Rect *getRenderCullRect() const { return renderCullRect_; }
+
+  bool deferredRendering_ = false;
+  RenderCommandBuffer commandBuffer_;
+  RenderCommandExecutor commandExecutor_;
+  bool parallelCollection_ = false;
+  ParallelCommandCollector commandCollector_;
 };
 
 } // namespace extra2d
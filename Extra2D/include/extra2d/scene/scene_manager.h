@@ -11,7 +11,7 @@
 
 namespace extra2d {
 
-struct RenderCommand;
+class RenderCommandBuffer;
 
 /**
  * @brief 场景管理器 - 管理场景的生命周期和切换
@@ -40,7 +40,7 @@ public:
 
   void update(float dt);
   void render(RenderBackend &renderer);
-  void collectRenderCommands(std::vector<RenderCommand> &commands);
+  void collectRenderCommands(RenderCommandBuffer &commands);
 
   bool isTransitioning() const { return isTransitioning_; }
   void setTransitionCallback(TransitionCallback callback) {
@@ -2,6 +2,7 @@
 
 #include <extra2d/core/color.h>
 #include <extra2d/core/math_types.h>
+#include <extra2d/graphics/render_backend.h>
 #include <extra2d/scene/node.h>
 #include <vector>
 
@@ -10,7 +11,16 @@ namespace extra2d {
 // ============================================================================
 // 形状类型
 // ============================================================================
-enum class ShapeType { Point, Line, Rect, Circle, Triangle, Polygon };
+enum class ShapeType {
+  Point,
+  Line,
+  Rect,
+  Circle,
+  Triangle,
+  Polygon,
+  RoundedRect, // 圆角矩形，圆角半径见 cornerRadius
+  Capsule      // 胶囊（两端为半圆的线段），半径见 cornerRadius
+};
 
 // ============================================================================
 // 形状节点 - 用于绘制几何形状
@@ -39,11 +49,23 @@ public:
 
   // 圆形
   static Ptr<ShapeNode> createCircle(const Vec2 &center, float radius,
-                                     const Color &color, int segments = 32,
+                                     const Color &color,
+                                     int segments = CIRCLE_SEGMENTS_AUTO,
                                      float width = 1.0f);
   static Ptr<ShapeNode> createFilledCircle(const Vec2 &center, float radius,
                                            const Color &color,
-                                           int segments = 32);
+                                           int segments = CIRCLE_SEGMENTS_AUTO);
+
+  // 圆角矩形
+  static Ptr<ShapeNode> createRoundedRect(const Rect &rect, float radius,
+                                          const Color &color,
+                                          float width = 1.0f);
+  static Ptr<ShapeNode> createFilledRoundedRect(const Rect &rect, float radius,
+                                                const Color &color);
+
+  // 胶囊
+  static Ptr<ShapeNode> createCapsule(const Vec2 &start, const Vec2 &end,
+                                      float radius, const Color &color);
 
   // 三角形
   static Ptr<ShapeNode> createTriangle(const Vec2 &p1, const Vec2 &p2,
@@ -62,21 +84,38 @@ public:
   // ------------------------------------------------------------------------
   // 属性设置
   // ------------------------------------------------------------------------
-  void setShapeType(ShapeType type) { shapeType_ = type; }
+  void setShapeType(ShapeType type) {
+    shapeType_ = type;
+    markBoundsDirty();
+  }
   ShapeType getShapeType() const { return shapeType_; }
 
   void setColor(const Color &color) { color_ = color; }
   Color getColor() const { return color_; }
 
-  void setFilled(bool filled) { filled_ = filled; }
+  void setFilled(bool filled) {
+    filled_ = filled;
+    markBoundsDirty();
+  }
   bool isFilled() const { return filled_; }
 
-  void setLineWidth(float width) { lineWidth_ = width; }
+  void setLineWidth(float width) {
+    lineWidth_ = width;
+    markBoundsDirty();
+  }
   float getLineWidth() const { return lineWidth_; }
 
+  // 圆的分段数，CIRCLE_SEGMENTS_AUTO（默认）由后端按屏幕半径选择
   void setSegments(int segments) { segments_ = segments; }
   int getSegments() const { return segments_; }
 
+  // 圆角矩形的圆角半径 / 胶囊半径
+  void setCornerRadius(float radius) {
+    cornerRadius_ = radius;
+    markBoundsDirty();
+  }
+  float getCornerRadius() const { return cornerRadius_; }
+
   // ------------------------------------------------------------------------
   // 点设置
   // ------------------------------------------------------------------------
@@ -89,16 +128,27 @@ public:
 
 protected:
   void onDraw(RenderBackend &renderer) override;
-  void generateRenderCommand(std::vector<RenderCommand> &commands,
+  void generateRenderCommand(RenderCommandBuffer &commands,
                              int zOrder) override;
+  bool getLocalBounds(Rect &bounds) const override;
+  float getScreenPadding() const override;
 
 private:
   ShapeType shapeType_ = ShapeType::Rect;
   Color color_ = Colors::White;
   bool filled_ = false;
   float lineWidth_ = 1.0f;
-  int segments_ = 32;
+  int segments_ = CIRCLE_SEGMENTS_AUTO;
+  float cornerRadius_ = 0.0f;
   std::vector<Vec2> points_;
+  std::vector<Vec2> outline_; // 圆角矩形/胶囊的折线近似（无 SDF 绘制与生成命令时复用）
+
+  // 填充多边形的剖分缓存，仅在顶点变化后重新剖分
+  std::vector<uint32_t> fillIndices_;
+  bool fillIndicesDirty_ = true;
+
+  void buildOutline(std::vector<Vec2> &out) const;
+  const std::vector<uint32_t> &getFillIndices();
 };
 
 } // namespace extra2d
@@ -0,0 +1,126 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <extra2d/core/math_types.h>
+#include <unordered_map>
+#include <vector>
+
+namespace extra2d {
+
+class Node;
+
+// ============================================================================
+// 空间索引 - 按世界坐标包围盒组织节点的哈希网格
+// 节点按包围盒覆盖的网格单元登记，查询只访问与查询区域相交的单元；
+// 覆盖单元过多的大节点单独存放，每次查询都逐一检查。
+// 节点变换或内容变化时只标记为脏（markDirty），refresh() 统一重算包围盒，
+// 包围盒仍落在原单元范围内时不改动网格
+// ============================================================================
+class SpatialIndex {
+public:
+  using Handle = uint32_t;
+  static constexpr Handle INVALID_HANDLE = UINT32_MAX;
+  static constexpr float DEFAULT_CELL_SIZE = 128.0f;
+  // 覆盖超过该单元数的节点存入大节点列表
+  static constexpr int32_t MAX_CELLS_PER_ENTRY = 16;
+
+  explicit SpatialIndex(float cellSize = DEFAULT_CELL_SIZE);
+
+  SpatialIndex(const SpatialIndex &) = delete;
+  SpatialIndex &operator=(const SpatialIndex &) = delete;
+
+  /**
+   * @brief 设置网格单元边长，已登记的节点按新单元重新登记
+   * @param cellSize 单元边长（世界坐标），宜与典型节点尺寸相当
+   */
+  void setCellSize(float cellSize);
+  float getCellSize() const { return cellSize_; }
+
+  /**
+   * @brief 登记节点，包围盒在下一次 refresh() 时计算
+   * @return 句柄，用于 remove() 与 markDirty()
+   */
+  Handle insert(Node *node);
+
+  /**
+   * @brief 移除节点
+   */
+  void remove(Handle handle);
+
+  /**
+   * @brief 标记节点的包围盒需要重算
+   */
+  void markDirty(Handle handle);
+
+  /**
+   * @brief 重算所有被标记节点的包围盒并更新网格
+   */
+  void refresh();
+
+  /**
+   * @brief 移除全部节点
+   * @return 被移除的节点，供调用方重置各自持有的句柄
+   */
+  std::vector<Node *> clear();
+
+  // ------------------------------------------------------------------------
+  // 查询：结果追加到 out（不清空、无重复、顺序不定），只包含报告了内容
+  // 边界的节点；调用方复用 out 可避免每次查询分配内存。
+  // 查询以条目上的查询戳去重，会写入索引，因此不可并发调用（仅限主线程）
+  // ------------------------------------------------------------------------
+  void queryRect(const Rect &rect, std::vector<Node *> &out);
+  void queryPoint(const Vec2 &point, std::vector<Node *> &out);
+  void queryRadius(const Vec2 &center, float radius, std::vector<Node *> &out);
+
+  size_t size() const { return entries_.size() - freeList_.size(); }
+  size_t getDirtyCount() const { return dirtyQueue_.size(); }
+  size_t getCellCount() const { return cells_.size(); }
+
+private:
+  struct CellRange {
+    int32_t x0 = 0, y0 = 0, x1 = -1, y1 = -1; // 空范围
+
+    bool operator==(const CellRange &o) const {
+      return x0 == o.x0 && y0 == o.y0 && x1 == o.x1 && y1 == o.y1;
+    }
+    int64_t cellCount() const {
+      return static_cast<int64_t>(x1 - x0 + 1) * (y1 - y0 + 1);
+    }
+  };
+
+  struct Entry {
+    Node *node = nullptr;
+    Rect bounds;
+    CellRange cells;
+    uint32_t queryStamp = 0;
+    bool dirty = false;
+    bool hasBounds = false;
+    bool oversized = false;
+  };
+
+  static uint64_t cellKey(int32_t x, int32_t y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) |
+           static_cast<uint32_t>(y);
+  }
+
+  CellRange rangeOf(const Rect &bounds) const;
+  void link(Handle handle);
+  void unlink(Handle handle);
+
+  /**
+   * @brief 遍历与 rect 相交的候选条目（每个条目至多一次）
+   */
+  template <typename Fn> void forEachCandidate(const Rect &rect, Fn &&fn);
+
+  float cellSize_;
+  float invCellSize_;
+  std::vector<Entry> entries_;
+  std::vector<Handle> freeList_;
+  std::vector<Handle> dirtyQueue_;
+  std::vector<Handle> oversized_;
+  std::unordered_map<uint64_t, std::vector<Handle>> cells_;
+  uint32_t queryStamp_ = 0;
+};
+
+} // namespace extra2d
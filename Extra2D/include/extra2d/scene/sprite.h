@@ -41,8 +41,9 @@ public:
 
 protected:
   void onDraw(RenderBackend &renderer) override;
-  void generateRenderCommand(std::vector<RenderCommand> &commands,
+  void generateRenderCommand(RenderCommandBuffer &commands,
                              int zOrder) override;
+  bool getLocalBounds(Rect &bounds) const override;
 
 private:
   Ptr<Texture> texture_;
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <extra2d/core/math_types.h>
+#include <vector>
+
+namespace extra2d {
+
+class Node;
+
+// ============================================================================
+// 变换系统 - 以 SoA 连续数组保存全部节点的局部 TRS、局部/世界仿射变换与父索引
+// 槽位顺序满足"父节点在子节点之前"：挂到索引更大的父节点下时，整棵子树
+// 按先序搬到数组末尾，因此 update() 只需按索引升序线性扫描脏区间，
+// 计算每个槽位时其父节点的世界变换已是最新。
+// 节点销毁后槽位留空，空槽过多时在 update() 中按原顺序压实
+// 所有节点须在同一线程（主线程）创建、修改与销毁
+// ============================================================================
+class TransformSystem {
+public:
+  using Index = uint32_t;
+  static constexpr Index INVALID_INDEX = UINT32_MAX;
+
+  /**
+   * @brief 获取单例实例
+   *
+   * 实例有意不释放：静态对象析构期间仍可能有节点析构并归还槽位
+   */
+  static TransformSystem &get() {
+    static TransformSystem *instance = new TransformSystem();
+    return *instance;
+  }
+
+  TransformSystem(const TransformSystem &) = delete;
+  TransformSystem &operator=(const TransformSystem &) = delete;
+
+  // ------------------------------------------------------------------------
+  // 槽位管理（由 Node 调用）
+  // ------------------------------------------------------------------------
+  Index allocate(Node *owner);
+  void release(Index index);
+
+  /**
+   * @brief 设置父槽位，调用方保证 parent 为 INVALID_INDEX 或小于 index，
+   * 并负责将该槽位及其后代标记为脏
+   */
+  void setParent(Index index, Index parent);
+
+  /**
+   * @brief 将槽位数据（含脏标记）搬到数组末尾
+   * @param index 原槽位（随后释放）
+   * @param parent 新的父槽位
+   * @return 新槽位
+   */
+  Index relocate(Index index, Index parent);
+
+  // ------------------------------------------------------------------------
+  // 局部 TRS（修改后须调用 markLocalDirty）
+  // ------------------------------------------------------------------------
+  Vec2 &position(Index index) { return positions_[index]; }
+  Vec2 &scale(Index index) { return scales_[index]; }
+  Vec2 &skew(Index index) { return skews_[index]; }
+  float &rotation(Index index) { return rotations_[index]; }
+
+  // ------------------------------------------------------------------------
+  // 脏标记
+  // ------------------------------------------------------------------------
+  /**
+   * @brief 局部 TRS 已变化：局部与世界变换均需重算
+   */
+  void markLocalDirty(Index index) {
+    flags_[index] |= LOCAL_DIRTY | WORLD_DIRTY;
+    extendDirtySpan(index);
+  }
+
+  /**
+   * @brief 祖先变换已变化：世界变换需重算
+   */
+  void markWorldDirty(Index index) {
+    flags_[index] |= WORLD_DIRTY;
+    extendDirtySpan(index);
+  }
+
+  bool isLocalDirty(Index index) const {
+    return (flags_[index] & LOCAL_DIRTY) != 0;
+  }
+  bool isWorldDirty(Index index) const {
+    return (flags_[index] & WORLD_DIRTY) != 0;
+  }
+
+  // ------------------------------------------------------------------------
+  // 仿射变换（为脏时按需重算；返回的引用在下一次分配槽位前有效）
+  // ------------------------------------------------------------------------
+  const Affine2D &getLocal(Index index);
+  const Affine2D &getWorld(Index index);
+
+  /**
+   * @brief 按索引升序重算脏区间内所有被标记槽位的变换
+   */
+  void update();
+
+  // ------------------------------------------------------------------------
+  // 统计
+  // ------------------------------------------------------------------------
+  size_t size() const { return owners_.size() - freeList_.size(); }
+  size_t getSlotCount() const { return owners_.size(); }
+  size_t getDirtySpan() const {
+    return dirtyEnd_ > dirtyBegin_ ? dirtyEnd_ - dirtyBegin_ : 0;
+  }
+
+private:
+  TransformSystem() = default;
+
+  static constexpr uint8_t LOCAL_DIRTY = 1 << 0;
+  static constexpr uint8_t WORLD_DIRTY = 1 << 1;
+
+  void extendDirtySpan(Index index) {
+    if (index < dirtyBegin_) {
+      dirtyBegin_ = index;
+    }
+    if (index >= dirtyEnd_) {
+      dirtyEnd_ = index + 1;
+    }
+  }
+
+  Index appendSlot();
+  void computeLocal(Index index);
+  void compact();
+
+  // SoA 数据，按槽位索引对齐
+  std::vector<Vec2> positions_;
+  std::vector<Vec2> scales_;
+  std::vector<Vec2> skews_;
+  std::vector<float> rotations_;
+  std::vector<Affine2D> locals_;
+  std::vector<Affine2D> worlds_;
+  std::vector<Index> parents_;
+  std::vector<uint8_t> flags_;
+  std::vector<Node *> owners_; // 空槽为 nullptr
+
+  std::vector<Index> freeList_;
+  std::vector<Index> remap_; // 压实时复用
+
+  Index dirtyBegin_ = INVALID_INDEX;
+  Index dirtyEnd_ = 0;
+};
+
+} // namespace extra2d
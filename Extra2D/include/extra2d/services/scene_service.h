@@ -30,7 +30,7 @@ public:
     virtual bool hasScene(const std::string& name) const = 0;
 
     virtual void render(RenderBackend& renderer) = 0;
-    virtual void collectRenderCommands(std::vector<RenderCommand>& commands) = 0;
+    virtual void collectRenderCommands(RenderCommandBuffer &commands) = 0;
 
     virtual bool isTransitioning() const = 0;
     virtual void setTransitionCallback(SceneManager::TransitionCallback callback) = 0;
@@ -72,7 +72,7 @@ public:
     bool hasScene(const std::string& name) const override;
 
     void render(RenderBackend& renderer) override;
-    void collectRenderCommands(std::vector<RenderCommand>& commands) override;
+    void collectRenderCommands(RenderCommandBuffer &commands) override;
 
     bool isTransitioning() const override;
     void setTransitionCallback(SceneManager::TransitionCallback callback) override;
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <vector>
+
+namespace extra2d {
+
+// ============================================================================
+// LinearArena 类 - 按帧复用的线性分配器
+// 从固定大小的内存块中顺序分配，reset() 只回退游标、保留全部内存块，
+// 预热后每帧不再向系统申请内存；分配的地址在 reset() 之前保持有效。
+// 只适合存放平凡可析构的数据，reset() 不会调用析构函数
+// ============================================================================
+class LinearArena {
+public:
+  static constexpr size_t DEFAULT_BLOCK_SIZE = 64 * 1024;
+
+  explicit LinearArena(size_t blockSize = DEFAULT_BLOCK_SIZE);
+
+  LinearArena(const LinearArena &) = delete;
+  LinearArena &operator=(const LinearArena &) = delete;
+  LinearArena(LinearArena &&) noexcept = default;
+  LinearArena &operator=(LinearArena &&) noexcept = default;
+
+  /**
+   * @brief 分配未初始化的内存
+   * @param size 字节数
+   * @param alignment 对齐（2 的幂，不超过 alignof(std::max_align_t)）
+   */
+  void *allocate(size_t size, size_t alignment) {
+    uintptr_t aligned = (cursor_ + alignment - 1) & ~(alignment - 1);
+    if (aligned + size <= limit_) {
+      cursor_ = aligned + size;
+      used_ += size;
+      return reinterpret_cast<void *>(aligned);
+    }
+    return allocateSlow(size, alignment);
+  }
+
+  /// 拷贝构造一个平凡可析构的对象
+  template <typename T> T *create(const T &value) {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "LinearArena only holds trivially destructible types");
+    return new (allocate(sizeof(T), alignof(T))) T(value);
+  }
+
+  /// 分配 count 个未初始化的元素
+  template <typename T> T *allocateArray(size_t count) {
+    static_assert(std::is_trivially_destructible<T>::value,
+                  "LinearArena only holds trivially destructible types");
+    return static_cast<T *>(allocate(sizeof(T) * count, alignof(T)));
+  }
+
+  /// 回退到起点，保留已申请的内存块
+  void reset();
+
+  /// 本帧已分配的字节数（不含对齐填充）
+  size_t getUsedBytes() const { return used_; }
+  /// 已向系统申请的总字节数
+  size_t getReservedBytes() const { return reserved_; }
+
+private:
+  struct Block {
+    std::unique_ptr<unsigned char[]> data;
+    size_t size;
+  };
+
+  void *allocateSlow(size_t size, size_t alignment);
+
+  std::vector<Block> blocks_;
+  size_t blockSize_;
+  size_t blockIndex_ = 0; // 当前使用的内存块
+  uintptr_t cursor_ = 0;
+  uintptr_t limit_ = 0;
+  size_t used_ = 0;
+  size_t reserved_ = 0;
+};
+
+} // namespace extra2d
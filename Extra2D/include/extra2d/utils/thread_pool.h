@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace extra2d {
+
+// ============================================================================
+// ThreadPool 类 - 数据并行任务池
+// 工作线程数为 CPU 核心数 - 1，调用线程同样参与执行；
+// 同一时刻只执行一个 parallelFor，嵌套或并发调用时退化为在调用线程串行执行
+// ============================================================================
+class ThreadPool {
+public:
+  /// 区间任务：处理 [begin, end)
+  using RangeFn = std::function<void(size_t begin, size_t end)>;
+
+  /// 获取单例实例
+  static ThreadPool &get();
+
+  /// 获取工作线程数（不含调用线程，0 表示单核设备）
+  size_t getWorkerCount() const { return workers_.size(); }
+
+  /**
+   * @brief 将 [0, count) 切分为若干块并行执行，返回时所有块均已完成
+   * @param count 元素总数
+   * @param minChunk 每块最少元素数，避免任务过碎
+   * @param fn 区间任务，不同块之间不得有数据竞争
+   */
+  void parallelFor(size_t count, size_t minChunk, const RangeFn &fn);
+
+private:
+  ThreadPool();
+  ~ThreadPool();
+
+  ThreadPool(const ThreadPool &) = delete;
+  ThreadPool &operator=(const ThreadPool &) = delete;
+
+  void workerLoop();
+  void runChunks();
+
+  std::vector<std::thread> workers_;
+
+  std::mutex submitMutex_; // 串行化 parallelFor 调用
+  std::mutex mutex_;
+  std::condition_variable wakeCond_;
+  std::condition_variable doneCond_;
+
+  // 当前任务（由 mutex_ 保护发布，执行期间只读）
+  const RangeFn *job_;
+  size_t jobCount_;
+  size_t chunkSize_;
+  size_t chunkTotal_;
+  std::atomic<size_t> nextChunk_;
+
+  uint64_t generation_;
+  size_t activeWorkers_;
+  bool jobActive_;
+  bool stop_;
+};
+
+} // namespace extra2d
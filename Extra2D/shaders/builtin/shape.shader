@@ -20,7 +20,7 @@ precision highp float;
 layout(location = 0) in vec2 a_position;
 layout(location = 1) in vec4 a_color;
 
-uniform mat4 u_viewProjection;
+#include "frame_constants.glsl"
 
 out vec4 v_color;
 
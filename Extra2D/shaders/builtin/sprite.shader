@@ -12,7 +12,7 @@
     "author": "Extra2D Team",
     "description": "标准2D精灵渲染Shader",
     "uniforms": {
-        "u_viewProjection": { "type": "mat4", "description": "视图投影矩阵" },
+        "u_viewProjection": { "type": "mat4", "description": "视图投影矩阵（FrameConstants 块，由渲染器上传）" },
         "u_model": { "type": "mat4", "description": "模型矩阵" },
         "u_opacity": { "type": "float", "default": 1.0, "description": "透明度" }
     }
@@ -26,7 +26,7 @@ layout(location = 0) in vec2 a_position;
 layout(location = 1) in vec2 a_texCoord;
 layout(location = 2) in vec4 a_color;
 
-uniform mat4 u_viewProjection;
+#include "frame_constants.glsl"
 uniform mat4 u_model;
 
 out vec2 v_texCoord;
@@ -0,0 +1,24 @@
+// ============================================
+// Frame Constants (std140 uniform block)
+// ============================================
+
+#ifndef E2D_FRAME_CONSTANTS_GLSL
+#define E2D_FRAME_CONSTANTS_GLSL
+
+/**
+ * @brief 每帧共享的常量，由渲染器在帧开始或相机变化时上传一次
+ *
+ * 布局须与 GLFrameConstants::Data 一致
+ * u_viewProjection 视图投影矩阵
+ * u_viewportSize   视口尺寸（像素）
+ * u_time           运行时间（秒）
+ * u_pixelScale     每世界单位对应的像素数
+ */
+layout(std140) uniform FrameConstants {
+    mat4 u_viewProjection;
+    vec2 u_viewportSize;
+    float u_time;
+    float u_pixelScale;
+};
+
+#endif // E2D_FRAME_CONSTANTS_GLSL
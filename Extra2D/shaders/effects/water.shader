@@ -21,7 +21,7 @@ layout(location = 0) in vec2 a_position;
 layout(location = 1) in vec2 a_texCoord;
 layout(location = 2) in vec4 a_color;
 
-uniform mat4 u_viewProjection;
+#include "frame_constants.glsl"
 uniform mat4 u_model;
 
 out vec2 v_texCoord;
@@ -44,7 +44,7 @@ uniform sampler2D u_texture;
 uniform float u_waveSpeed;
 uniform float u_waveAmplitude;
 uniform float u_waveFrequency;
-uniform float u_time;
+#include "frame_constants.glsl"
 
 out vec4 fragColor;
 
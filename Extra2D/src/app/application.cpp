@@ -3,6 +3,7 @@
 #include <extra2d/config/module_registry.h>
 #include <extra2d/graphics/render_config.h>
 #include <extra2d/graphics/render_module.h>
+#include <extra2d/graphics/render_thread.h>
 #include <extra2d/graphics/vram_manager.h>
 #include <extra2d/platform/iinput.h>
 #include <extra2d/platform/input_module.h>
@@ -12,6 +13,8 @@
 #include <extra2d/services/event_service.h>
 #include <extra2d/services/scene_service.h>
 #include <extra2d/services/timer_service.h>
+#include <extra2d/scene/scene.h>
+#include <extra2d/utils/logger.h>
 
 
 #include <chrono>
@@ -215,6 +218,11 @@ void Application::shutdown() {
   if (!initialized_)
     return;
 
+  if (renderThread_) {
+    renderThread_->stop();
+    renderThread_.reset();
+  }
+
   VRAMMgr::get().printStats();
 
   ServiceLocator::instance().clear();
@@ -247,10 +255,39 @@ void Application::run() {
   }
 
   lastFrameTime_ = getTimeSeconds();
+  startRenderThread();
 
   while (running_ && !window_->shouldClose()) {
     mainLoop();
   }
+
+  // 交还图形上下文，之后的资源释放在主线程进行
+  if (renderThread_) {
+    renderThread_->stop();
+    renderThread_.reset();
+  }
+}
+
+void Application::startRenderThread() {
+  auto *renderConfig = dynamic_cast<const RenderModuleConfig *>(
+      ModuleRegistry::instance().getModuleConfig(get_render_module_id()));
+  if (!renderConfig || !renderConfig->renderThread) {
+    return;
+  }
+
+  auto *renderModule = dynamic_cast<RenderModuleInitializer *>(
+      ModuleRegistry::instance().getInitializer(get_render_module_id()));
+  if (!renderModule || !renderModule->getRenderer()) {
+    return;
+  }
+
+  renderThread_ = std::make_unique<RenderThread>();
+  if (!renderThread_->start(
+          window_, renderModule->getRenderer(),
+          static_cast<size_t>(renderConfig->renderThreadFrames))) {
+    E2D_LOG_WARN("Render thread unavailable, rendering on the main thread");
+    renderThread_.reset();
+  }
 }
 
 void Application::quit() {
@@ -339,26 +376,111 @@ void Application::render() {
     return;
   }
 
+  if (renderThread_) {
+    // 只有延迟渲染场景能流水线化；立即模式场景在 onDraw 中直接调用渲染器，
+    // 只能在渲染线程上同步绘制，主线程等待其完成
+    auto sceneService = ServiceLocator::instance().getService<ISceneService>();
+    auto scene = sceneService ? sceneService->getCurrentScene() : nullptr;
+    if (!scene || scene->isDeferredRendering()) {
+      submitFrame();
+    } else {
+      renderThread_->invoke([&] { renderImmediate(*renderer); });
+    }
+    return;
+  }
+
+  renderImmediate(*renderer);
+}
+
+/**
+ * @brief 立即模式渲染当前场景
+ * @param renderer 渲染后端
+ */
+void Application::renderImmediate(RenderBackend &renderer) {
+  renderer.setFrameTime(totalTime_);
+
   auto cameraService = ServiceLocator::instance().getService<ICameraService>();
   if (cameraService) {
     const auto &vp = cameraService->getViewportResult().viewport;
-    renderer->setViewport(
+    renderer.setViewport(
         static_cast<int>(vp.origin.x), static_cast<int>(vp.origin.y),
         static_cast<int>(vp.size.width), static_cast<int>(vp.size.height));
 
-    renderer->setViewProjection(cameraService->getViewProjectionMatrix());
+    renderer.setViewProjection(cameraService->getViewProjectionMatrix());
   } else {
-    renderer->setViewport(0, 0, window_->width(), window_->height());
+    renderer.setViewport(0, 0, window_->width(), window_->height());
   }
 
   auto sceneService = ServiceLocator::instance().getService<ISceneService>();
   if (sceneService) {
-    sceneService->render(*renderer);
+    updateCullRect(sceneService->getCurrentScene());
+    sceneService->render(renderer);
   }
 
   window_->swap();
 }
 
+/**
+ * @brief 按相机服务的视图-投影矩阵更新场景的剔除区域
+ * @param scene 当前场景
+ *
+ * 渲染使用的是相机服务的矩阵而非场景自带相机，剔除区域须与之一致
+ */
+void Application::updateCullRect(const Ptr<Scene> &scene) {
+  if (!scene || !scene->isCulling()) {
+    return;
+  }
+  auto cameraService = ServiceLocator::instance().getService<ICameraService>();
+  if (cameraService) {
+    Affine2D viewProjection =
+        Affine2D::fromMat4(cameraService->getViewProjectionMatrix());
+    const Rect &viewport = cameraService->getViewportResult().viewport;
+    scene->setCullRect(
+        Camera::computeVisibleRect(viewProjection),
+        Camera::computeUnitsPerPixel(viewProjection, viewport.size));
+  }
+}
+
+/**
+ * @brief 流水线模式下录制一帧并提交
+ *
+ * 命令与帧状态写入空闲帧槽后交给渲染线程执行，主线程随即开始下一帧的
+ * 更新；渲染线程落后超过帧槽数时在 beginFrame() 处等待
+ */
+void Application::submitFrame() {
+  RenderThread::Frame &frame = renderThread_->beginFrame();
+  frame.time = totalTime_;
+
+  auto cameraService = ServiceLocator::instance().getService<ICameraService>();
+  if (cameraService) {
+    const auto &vp = cameraService->getViewportResult().viewport;
+    frame.viewportX = static_cast<int>(vp.origin.x);
+    frame.viewportY = static_cast<int>(vp.origin.y);
+    frame.viewportWidth = static_cast<int>(vp.size.width);
+    frame.viewportHeight = static_cast<int>(vp.size.height);
+    frame.viewProjection = cameraService->getViewProjectionMatrix();
+  } else {
+    frame.viewportX = 0;
+    frame.viewportY = 0;
+    frame.viewportWidth = window_->width();
+    frame.viewportHeight = window_->height();
+    frame.viewProjection = glm::mat4(1.0f);
+  }
+
+  frame.clearColor = Colors::Black;
+  auto sceneService = ServiceLocator::instance().getService<ISceneService>();
+  if (sceneService) {
+    if (auto scene = sceneService->getCurrentScene()) {
+      frame.clearColor = scene->getBackgroundColor();
+      updateCullRect(scene);
+    }
+    sceneService->collectRenderCommands(frame.commands);
+  }
+  frame.commands.sortCommands();
+
+  renderThread_->submitFrame();
+}
+
 IInput &Application::input() { return *window_->input(); }
 
 RenderBackend &Application::renderer() {
@@ -398,6 +520,7 @@ void Application::enterScene(Ptr<Scene> scene) {
   if (sceneService && scene) {
     scene->setViewportSize(static_cast<float>(window_->width()),
                            static_cast<float>(window_->height()));
+    // 旧场景释放的资源由在途帧持有到执行完毕，GPU 对象在渲染线程上删除
     sceneService->enterScene(scene);
   }
 }
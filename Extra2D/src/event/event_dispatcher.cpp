@@ -23,6 +23,7 @@ ListenerId EventDispatcher::addListener(EventType type,
                                         EventCallback callback) {
   ListenerId id = nextId_++;
   listeners_[type].push_back({id, type, callback});
+  setTotalCount(totalCount_ + 1);
   return id;
 }
 
@@ -38,7 +39,9 @@ void EventDispatcher::removeListener(ListenerId id) {
     auto it = std::remove_if(listeners.begin(), listeners.end(),
                              [id](const Listener &l) { return l.id == id; });
     if (it != listeners.end()) {
+      size_t removed = static_cast<size_t>(listeners.end() - it);
       listeners.erase(it, listeners.end());
+      setTotalCount(totalCount_ - removed);
       return;
     }
   }
@@ -52,7 +55,12 @@ void EventDispatcher::removeListener(ListenerId id) {
  * @param type 要移除监听器的事件类型
  */
 void EventDispatcher::removeAllListeners(EventType type) {
-  listeners_.erase(type);
+  auto it = listeners_.find(type);
+  if (it != listeners_.end()) {
+    size_t removed = it->second.size();
+    listeners_.erase(it);
+    setTotalCount(totalCount_ - removed);
+  }
 }
 
 /**
@@ -60,7 +68,10 @@ void EventDispatcher::removeAllListeners(EventType type) {
  *
  * 清除事件分发器中所有已注册的监听器
  */
-void EventDispatcher::removeAllListeners() { listeners_.clear(); }
+void EventDispatcher::removeAllListeners() {
+  listeners_.clear();
+  setTotalCount(0);
+}
 
 /**
  * @brief 分发事件
@@ -120,18 +131,18 @@ size_t EventDispatcher::getListenerCount(EventType type) const {
 }
 
 /**
- * @brief 获取所有监听器的总数量
+ * @brief 更新监听器总数
  *
- * 返回所有事件类型的监听器总数
+ * 总数在 0 与非 0 之间变化时通知持有者
  *
- * @return 所有监听器的总数量
+ * @param count 新的监听器总数
  */
-size_t EventDispatcher::getTotalListenerCount() const {
-  size_t count = 0;
-  for (const auto &[type, listeners] : listeners_) {
-    count += listeners.size();
+void EventDispatcher::setTotalCount(size_t count) {
+  bool had = totalCount_ != 0;
+  totalCount_ = count;
+  if (had != (count != 0) && presenceCallback_) {
+    presenceCallback_(count != 0);
   }
-  return count;
 }
 
 } // namespace extra2d
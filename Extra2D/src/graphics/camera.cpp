@@ -1,12 +1,22 @@
 #include <algorithm>
+#include <cmath>
 #include <extra2d/graphics/camera.h>
 #include <extra2d/graphics/viewport_adapter.h>
-#include <glm/gtc/matrix_inverse.hpp>
-#include <glm/gtc/matrix_transform.hpp>
 
 
 namespace extra2d {
 
+/**
+ * @brief 将含正交投影的仿射变换转换为 4x4 矩阵
+ *
+ * Z 范围与 glm::ortho(..., -1, 1) 一致
+ */
+static glm::mat4 toProjectionMatrix(const Affine2D &transform) {
+  glm::mat4 m = transform.toMat4();
+  m[2][2] = -1.0f;
+  return m;
+}
+
 /**
  * @brief 默认构造函数
  *
@@ -125,65 +135,149 @@ Rect Camera::getViewport() const {
 }
 
 /**
- * @brief 获取视图矩阵
- * @return 视图矩阵
- *
- * 变换顺序：平移 -> 旋转 -> 缩放（逆序应用）
- * View = T(-position) × R(-rotation) × S(1/zoom)
+ * @brief 获取可见区域的世界坐标包围盒
+ * @return 当前视图-投影下可见区域的轴对齐包围盒
  */
-glm::mat4 Camera::getViewMatrix() const {
-  if (viewDirty_) {
-    viewMatrix_ = glm::mat4(1.0f);
+Rect Camera::getVisibleRect() const {
+  return computeVisibleRect(getViewProjectionTransform());
+}
 
-    // 1. 平移（最后应用）
-    viewMatrix_ = glm::translate(viewMatrix_,
-                                 glm::vec3(-position_.x, -position_.y, 0.0f));
+/**
+ * @brief 由视图-投影矩阵计算可见区域的世界坐标包围盒
+ * @param viewProjection 视图-投影矩阵
+ * @return NDC 四角反投影后的轴对齐包围盒
+ *
+ * 2D 正交视图-投影只有仿射部分，转换后按仿射变换计算
+ */
+Rect Camera::computeVisibleRect(const glm::mat4 &viewProjection) {
+  return computeVisibleRect(Affine2D::fromMat4(viewProjection));
+}
 
-    // 2. 旋转（中间应用）
-    if (rotation_ != 0.0f) {
-      viewMatrix_ = glm::rotate(viewMatrix_, -rotation_ * DEG_TO_RAD,
-                                glm::vec3(0.0f, 0.0f, 1.0f));
+/**
+ * @brief 由视图-投影变换计算可见区域的世界坐标包围盒
+ * @param viewProjection 视图-投影仿射变换
+ * @return NDC 四角反投影后的轴对齐包围盒
+ *
+ * 用于视口剔除；相机旋转时返回旋转后可见区域的外接矩形
+ */
+Rect Camera::computeVisibleRect(const Affine2D &viewProjection) {
+  Affine2D invVP = viewProjection.inverse();
+  static constexpr float corners[4][2] = {
+      {-1.0f, -1.0f}, {1.0f, -1.0f}, {1.0f, 1.0f}, {-1.0f, 1.0f}};
+
+  float minX = 0.0f, minY = 0.0f, maxX = 0.0f, maxY = 0.0f;
+  for (int i = 0; i < 4; ++i) {
+    Vec2 world = invVP.transformPoint(Vec2(corners[i][0], corners[i][1]));
+    if (i == 0) {
+      minX = maxX = world.x;
+      minY = maxY = world.y;
+    } else {
+      minX = std::min(minX, world.x);
+      minY = std::min(minY, world.y);
+      maxX = std::max(maxX, world.x);
+      maxY = std::max(maxY, world.y);
     }
+  }
+  return Rect(minX, minY, maxX - minX, maxY - minY);
+}
 
-    // 3. 缩放（最先应用）
-    if (zoom_ != 1.0f) {
-      viewMatrix_ =
-          glm::scale(viewMatrix_, glm::vec3(1.0f / zoom_, 1.0f / zoom_, 1.0f));
-    }
+/**
+ * @brief 计算每屏幕像素对应的世界单位
+ * @param viewProjection 视图-投影变换
+ * @param viewportSize 视口像素尺寸
+ * @return 两轴中较大的每像素世界单位，用于保守地外扩剔除包围盒
+ *
+ * NDC 跨度为 2，逆变换的两列即 NDC 单位轴在世界空间中的长度
+ */
+float Camera::computeUnitsPerPixel(const Affine2D &viewProjection,
+                                   const Size &viewportSize) {
+  if (viewportSize.width <= 0.0f || viewportSize.height <= 0.0f) {
+    return 1.0f;
+  }
+  Affine2D invVP = viewProjection.inverse();
+  float perPixelX = std::sqrt(invVP.a * invVP.a + invVP.b * invVP.b) * 2.0f /
+                    viewportSize.width;
+  float perPixelY = std::sqrt(invVP.c * invVP.c + invVP.d * invVP.d) * 2.0f /
+                    viewportSize.height;
+  return std::max(perPixelX, perPixelY);
+}
 
+/**
+ * @brief 获取视图变换
+ * @return 视图仿射变换
+ *
+ * 变换顺序：平移 -> 旋转 -> 缩放（逆序应用）
+ * View = T(-position) × R(-rotation) × S(1/zoom)，直接写出 2x3 系数
+ */
+const Affine2D &Camera::getViewTransform() const {
+  if (viewDirty_) {
+    float c = 1.0f;
+    float s = 0.0f;
+    if (rotation_ != 0.0f) {
+      c = std::cos(rotation_ * DEG_TO_RAD);
+      s = std::sin(rotation_ * DEG_TO_RAD);
+    }
+    float invZoom = 1.0f / zoom_;
+    // R(-rotation) 的列为 (c, -s) 与 (s, c)
+    viewTransform_ = Affine2D(c * invZoom, -s * invZoom, s * invZoom,
+                              c * invZoom, -position_.x, -position_.y);
     viewDirty_ = false;
   }
-  return viewMatrix_;
+  return viewTransform_;
 }
 
 /**
- * @brief 获取投影矩阵
- * @return 正交投影矩阵
+ * @brief 获取投影变换
+ * @return 正交投影的仿射变换
  *
  * 对于2D游戏，Y轴向下增长（屏幕坐标系）
  * OpenGL默认Y轴向上，所以需要反转Y轴
  */
-glm::mat4 Camera::getProjectionMatrix() const {
+const Affine2D &Camera::getProjectionTransform() const {
   if (projDirty_) {
-    // 对于2D游戏，Y轴向下增长（屏幕坐标系）
-    // OpenGL默认Y轴向上，所以需要反转Y轴
-    // glm::ortho(left, right, bottom, top)
-    // 为了Y轴向下：传入 (bottom=height, top=0)，这样Y轴翻转
-    projMatrix_ = glm::ortho(
-        left_, right_, // X轴：从左到右
-        bottom_, top_, // Y轴：从下到上（传入bottom>top，实现Y轴向下增长）
-        -1.0f, 1.0f);
+    // 与 glm::ortho(left, right, bottom, top) 的 X/Y 部分一致：
+    // 传入 bottom>top 时 Y 轴翻转，实现Y轴向下增长
+    float sx = 2.0f / (right_ - left_);
+    float sy = 2.0f / (top_ - bottom_);
+    projTransform_ =
+        Affine2D(sx, 0.0f, 0.0f, sy, -(right_ + left_) / (right_ - left_),
+                 -(top_ + bottom_) / (top_ - bottom_));
     projDirty_ = false;
   }
-  return projMatrix_;
+  return projTransform_;
+}
+
+/**
+ * @brief 获取视图-投影变换
+ * @return 视图-投影仿射变换
+ */
+Affine2D Camera::getViewProjectionTransform() const {
+  return getProjectionTransform() * getViewTransform();
+}
+
+/**
+ * @brief 获取视图矩阵
+ * @return 视图矩阵
+ */
+glm::mat4 Camera::getViewMatrix() const { return getViewTransform().toMat4(); }
+
+/**
+ * @brief 获取投影矩阵
+ * @return 正交投影矩阵
+ *
+ */
+glm::mat4 Camera::getProjectionMatrix() const {
+  return toProjectionMatrix(getProjectionTransform());
 }
 
 /**
  * @brief 获取视图-投影矩阵
  * @return 视图-投影矩阵
+ *
+ * 在仿射空间中组合后再转换为 4x4，仅用于提交给 GPU
  */
 glm::mat4 Camera::getViewProjectionMatrix() const {
-  return getProjectionMatrix() * getViewMatrix();
+  return toProjectionMatrix(getViewProjectionTransform());
 }
 
 /**
@@ -199,11 +293,8 @@ Vec2 Camera::screenToWorld(const Vec2 &screenPos) const {
     logicPos = viewportAdapter_->screenToLogic(screenPos);
   }
 
-  // 使用逆视图-投影矩阵转换
-  glm::mat4 invVP = glm::inverse(getViewProjectionMatrix());
-  glm::vec4 ndc(logicPos.x, logicPos.y, 0.0f, 1.0f);
-  glm::vec4 world = invVP * ndc;
-  return Vec2(world.x, world.y);
+  // 使用逆视图-投影变换转换
+  return getViewProjectionTransform().inverse().transformPoint(logicPos);
 }
 
 /**
@@ -212,9 +303,7 @@ Vec2 Camera::screenToWorld(const Vec2 &screenPos) const {
  * @return 屏幕坐标
  */
 Vec2 Camera::worldToScreen(const Vec2 &worldPos) const {
-  glm::vec4 world(worldPos.x, worldPos.y, 0.0f, 1.0f);
-  glm::vec4 screen = getViewProjectionMatrix() * world;
-  Vec2 logicPos(screen.x, screen.y);
+  Vec2 logicPos = getViewProjectionTransform().transformPoint(worldPos);
 
   // 如果有视口适配器，转换到屏幕坐标
   if (viewportAdapter_) {
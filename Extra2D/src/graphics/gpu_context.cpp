@@ -1,4 +1,5 @@
 #include <extra2d/graphics/gpu_context.h>
+#include <utility>
 
 namespace extra2d {
 
@@ -41,4 +42,92 @@ bool GPUContext::isValid() const {
     return valid_.load(std::memory_order_acquire);
 }
 
+/**
+ * @brief 设置上下文的所属线程
+ * @param owner 上下文当前所在的线程
+ * @param invoker 在该线程上同步执行任务的执行器
+ */
+void GPUContext::setOwner(std::thread::id owner, Invoker invoker) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    owner_ = owner;
+    invoker_ = std::move(invoker);
+}
+
+/**
+ * @brief 清除所属线程，之后 GPU 调用直接在调用线程执行
+ *
+ * 尚未释放的任务保留在队列中，由交还上下文的线程调用 drainReleases() 执行
+ */
+void GPUContext::clearOwner() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    owner_ = std::thread::id();
+    invoker_ = nullptr;
+}
+
+/**
+ * @brief 调用线程能否直接发出 GPU 调用
+ * @return 未设置所属线程或调用线程即所属线程时返回true
+ */
+bool GPUContext::isOwnerThread() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return owner_ == std::thread::id() || owner_ == std::this_thread::get_id();
+}
+
+/**
+ * @brief 在所属线程上执行任务并等待完成
+ * @param task 发出 GPU 调用的任务
+ *
+ * 执行器在锁外调用，任务内可以再次调用 runOnOwner()/releaseOnOwner()
+ */
+void GPUContext::runOnOwner(const std::function<void()>& task) {
+    Invoker invoker;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (owner_ != std::thread::id() &&
+            owner_ != std::this_thread::get_id()) {
+            invoker = invoker_;
+        }
+    }
+    if (invoker) {
+        invoker(task);
+    } else {
+        task();
+    }
+}
+
+/**
+ * @brief 释放 GPU 对象，非所属线程上排队
+ * @param release 释放任务
+ */
+void GPUContext::releaseOnOwner(std::function<void()> release) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (owner_ != std::thread::id() &&
+            owner_ != std::this_thread::get_id()) {
+            pendingReleases_.push_back(std::move(release));
+            return;
+        }
+    }
+    release();
+}
+
+/**
+ * @brief 执行排队的释放任务
+ *
+ * 在锁外执行，期间其他线程排队的任务留到下次调用
+ */
+void GPUContext::drainReleases() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (pendingReleases_.empty()) {
+            return;
+        }
+        drainingReleases_.swap(pendingReleases_);
+    }
+    for (auto& release : drainingReleases_) {
+        release();
+    }
+    drainingReleases_.clear();
+}
+
 } // namespace extra2d
@@ -1,4 +1,6 @@
+#include <extra2d/graphics/gpu_context.h>
 #include <extra2d/graphics/opengl/gl_font_atlas.h>
+#include <extra2d/graphics/opengl/gl_state_cache.h>
 #include <extra2d/utils/logger.h>
 #include <fstream>
 #define STB_TRUETYPE_IMPLEMENTATION
@@ -216,12 +218,7 @@ void GLFontAtlas::cacheGlyph(char32_t codepoint) const {
       glyphRgbaCache_[i * 4 + 3] = alpha; // A - SDF 值存储在 Alpha 通道
     }
 
-    // 直接设置像素对齐为 4，无需查询当前状态
-    glBindTexture(GL_TEXTURE_2D, texture_->getTextureID());
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
-    // OpenGL纹理坐标原点在左下角，需要将Y坐标翻转
-    glTexSubImage2D(GL_TEXTURE_2D, 0, atlasX, ATLAS_HEIGHT - atlasY - h, w, h,
-                    GL_RGBA, GL_UNSIGNED_BYTE, glyphRgbaCache_.data());
+    uploadGlyph(atlasX, ATLAS_HEIGHT - atlasY - h, w, h);
 
     stbtt_FreeSDF(sdf, nullptr);
     return;
@@ -298,12 +295,30 @@ void GLFontAtlas::cacheGlyph(char32_t codepoint) const {
   }
 
   // 更新纹理 - 将字形数据上传到图集的指定位置
-  // 直接设置像素对齐为 4，无需查询当前状态
-  glBindTexture(GL_TEXTURE_2D, texture_->getTextureID());
-  glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
   // OpenGL纹理坐标原点在左下角，需要将Y坐标翻转
-  glTexSubImage2D(GL_TEXTURE_2D, 0, atlasX, ATLAS_HEIGHT - atlasY - h, w, h,
-                  GL_RGBA, GL_UNSIGNED_BYTE, glyphRgbaCache_.data());
+  uploadGlyph(atlasX, ATLAS_HEIGHT - atlasY - h, w, h);
+}
+
+// ============================================================================
+// 上传字形 - 将 RGBA 字形缓冲写入图集纹理
+// ============================================================================
+/**
+ * @brief 将 glyphRgbaCache_ 上传到图集纹理的指定区域
+ * @param x 纹理坐标系（左下角为原点）中的X
+ * @param y 纹理坐标系（左下角为原点）中的Y
+ * @param w 宽度
+ * @param h 高度
+ *
+ * 字形在首次测量或绘制时缓存，可能发生在非上下文线程，上传交给上下文所属线程
+ */
+void GLFontAtlas::uploadGlyph(int x, int y, int w, int h) const {
+  GPUContext::get().runOnOwner([&] {
+    // 直接设置像素对齐为 4，无需查询当前状态
+    GLStateCache::get().bindTexture(0, texture_->getTextureID());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE,
+                    glyphRgbaCache_.data());
+  });
 }
 
 } // namespace extra2d
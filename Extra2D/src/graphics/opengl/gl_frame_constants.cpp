@@ -0,0 +1,146 @@
+#include <extra2d/graphics/opengl/gl_frame_constants.h>
+#include <extra2d/graphics/opengl/gl_state_cache.h>
+#include <extra2d/graphics/vram_manager.h>
+#include <extra2d/utils/logger.h>
+#include <glm/geometric.hpp>
+
+namespace extra2d {
+
+const char *const GLFrameConstants::GLSL_BLOCK = R"(
+layout(std140) uniform FrameConstants {
+    mat4 u_viewProjection;
+    vec2 u_viewportSize;
+    float u_time;
+    float u_pixelScale;
+};
+)";
+
+/**
+ * @brief 由视图投影与视口尺寸换算每世界单位的像素数
+ *
+ * NDC 跨度为 2，世界 X 轴投影后乘以半个视口即为像素长度
+ */
+static float computePixelScale(const glm::mat4 &viewProjection,
+                               const glm::vec2 &viewportSize) {
+  glm::vec2 axis(viewProjection[0][0], viewProjection[0][1]);
+  float scale = glm::length(axis * viewportSize * 0.5f);
+  return scale > 0.0f ? scale : 1.0f;
+}
+
+/**
+ * @brief 构造函数，初始为单位矩阵、像素缩放 1
+ */
+GLFrameConstants::GLFrameConstants()
+    : ubo_(0), data_{glm::mat4(1.0f), glm::vec2(0.0f), 0.0f, 1.0f},
+      dirty_(true), uploadCount_(0) {}
+
+/**
+ * @brief 获取GLFrameConstants单例实例
+ * @return GLFrameConstants单例的引用
+ */
+GLFrameConstants &GLFrameConstants::get() {
+  static GLFrameConstants instance;
+  return instance;
+}
+
+/**
+ * @brief 创建 uniform 缓冲并绑定到 BINDING
+ * @return 创建成功返回true
+ */
+bool GLFrameConstants::init() {
+  if (ubo_ != 0) {
+    return true;
+  }
+
+  glGenBuffers(1, &ubo_);
+  if (ubo_ == 0) {
+    E2D_LOG_ERROR("Failed to create frame constants uniform buffer");
+    return false;
+  }
+  GLStateCache::get().bindBuffer(GL_UNIFORM_BUFFER, ubo_);
+  glBufferData(GL_UNIFORM_BUFFER, sizeof(Data), nullptr, GL_DYNAMIC_DRAW);
+  glBindBufferBase(GL_UNIFORM_BUFFER, BINDING, ubo_);
+  VRAMMgr::get().allocBuffer(sizeof(Data));
+
+  // 新缓冲区内容未定义，首次绘制前必须上传
+  dirty_ = true;
+  return true;
+}
+
+/**
+ * @brief 释放 uniform 缓冲
+ */
+void GLFrameConstants::shutdown() {
+  if (ubo_ == 0) {
+    return;
+  }
+  GLStateCache::get().onBufferDeleted(ubo_);
+  glDeleteBuffers(1, &ubo_);
+  VRAMMgr::get().freeBuffer(sizeof(Data));
+  ubo_ = 0;
+}
+
+/**
+ * @brief 设置视图投影矩阵
+ */
+void GLFrameConstants::setViewProjection(const glm::mat4 &viewProjection) {
+  if (data_.viewProjection == viewProjection) {
+    return;
+  }
+  data_.viewProjection = viewProjection;
+  data_.pixelScale = computePixelScale(viewProjection, data_.viewportSize);
+  dirty_ = true;
+}
+
+/**
+ * @brief 设置视口尺寸（像素）
+ */
+void GLFrameConstants::setViewportSize(float width, float height) {
+  glm::vec2 size(width, height);
+  if (data_.viewportSize == size) {
+    return;
+  }
+  data_.viewportSize = size;
+  data_.pixelScale = computePixelScale(data_.viewProjection, size);
+  dirty_ = true;
+}
+
+/**
+ * @brief 设置时间（秒）
+ */
+void GLFrameConstants::setTime(float seconds) {
+  if (data_.time == seconds) {
+    return;
+  }
+  data_.time = seconds;
+  dirty_ = true;
+}
+
+/**
+ * @brief 有变化时上传整个常量块
+ */
+void GLFrameConstants::upload() {
+  if (!dirty_ || ubo_ == 0) {
+    return;
+  }
+  GLStateCache::get().bindBuffer(GL_UNIFORM_BUFFER, ubo_);
+  glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(Data), &data_);
+  dirty_ = false;
+  uploadCount_++;
+}
+
+/**
+ * @brief 将程序中的 FrameConstants 块绑定到 BINDING
+ * @param program 已链接的程序对象
+ */
+void GLFrameConstants::bindProgram(GLuint program) {
+  if (program == 0) {
+    return;
+  }
+  GLuint index = glGetUniformBlockIndex(program, BLOCK_NAME);
+  if (index != GL_INVALID_INDEX) {
+    glUniformBlockBinding(program, index, BINDING);
+  }
+}
+
+} // namespace extra2d
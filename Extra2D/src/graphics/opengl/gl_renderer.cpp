@@ -4,7 +4,9 @@
 #include <cstring>
 #include <extra2d/graphics/gpu_context.h>
 #include <extra2d/graphics/opengl/gl_font_atlas.h>
+#include <extra2d/graphics/opengl/gl_frame_constants.h>
 #include <extra2d/graphics/opengl/gl_renderer.h>
+#include <extra2d/graphics/opengl/gl_state_cache.h>
 #include <extra2d/graphics/opengl/gl_texture.h>
 #include <extra2d/graphics/shader_manager.h>
 #include <extra2d/graphics/vram_manager.h>
@@ -36,20 +38,22 @@ static constexpr BlendState BLEND_STATES[] = {
 static constexpr size_t BLEND_STATE_COUNT =
     sizeof(BLEND_STATES) / sizeof(BLEND_STATES[0]);
 
+/**
+ * @brief 将 [0, 1] 浮点量化为 unorm8
+ */
+static inline uint8_t toUnorm8(float value) {
+  value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+  return static_cast<uint8_t>(value * 255.0f + 0.5f);
+}
+
 /**
  * @brief 构造函数，初始化OpenGL渲染器成员变量
  */
 GLRenderer::GLRenderer()
-    : window_(nullptr), shapeVao_(0), shapeVbo_(0), lineVao_(0), lineVbo_(0),
-      vsync_(true), shapeVertexCount_(0), currentShapeMode_(GL_TRIANGLES),
-      lineVertexCount_(0), currentLineWidth_(1.0f) {
+    : window_(nullptr), shapeVao_(0), shapeVbo_(0), viewProjection_(1.0f),
+      vsync_(true),
+      shapeVertexCount_(0), currentShapeMode_(GL_TRIANGLES) {
   resetStats();
-  for (auto &v : shapeVertexCache_) {
-    v = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
-  }
-  for (auto &v : lineVertexCache_) {
-    v = {0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
-  }
 }
 
 /**
@@ -67,8 +71,17 @@ bool GLRenderer::init(IWindow *window) {
 
   // Switch: GL 上下文已通过 SDL2 + EGL 初始化，无需 glewInit()
 
+  // 新上下文的绑定状态未知，清空状态缓存
+  GLStateCache::get().invalidate();
+
+  // 帧常量块：所有内置批次与效果着色器共享的视图投影等常量
+  if (!GLFrameConstants::get().init()) {
+    return false;
+  }
+  GLFrameConstants::get().setViewProjection(viewProjection_);
+
   // 初始化精灵批渲染器
-  if (!spriteBatch_.init()) {
+  if (!spriteBatch_.init(spriteBatchConfig_)) {
     E2D_LOG_ERROR("Failed to initialize sprite batch");
     return false;
   }
@@ -76,9 +89,24 @@ bool GLRenderer::init(IWindow *window) {
   // 初始化形状渲染
   initShapeRendering();
 
+  // SDF 形状批次初始化失败时，形状节点退回三角化路径
+  if (spriteBatchConfig_.sdfShapes) {
+    sdfShapesEnabled_ = sdfShapes_.init(spriteBatchConfig_.streamMode);
+    if (!sdfShapesEnabled_) {
+      E2D_LOG_WARN("SDF shape batch unavailable, using tessellated shapes");
+    }
+  }
+
+  shapesInSpriteBatch_ =
+      spriteBatchConfig_.batchShapes && spriteBatch_.supportsSolidShapes();
+  if (spriteBatchConfig_.batchShapes && !shapesInSpriteBatch_) {
+    E2D_LOG_WARN("Shape batching requires non-instanced sprite batch, "
+                 "using separate shape batch");
+  }
+
   // 设置 OpenGL 状态
-  glEnable(GL_BLEND);
-  glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  GLStateCache::get().setBlend(true, GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+  cachedBlendMode_ = BlendMode::Alpha;
 
   // 标记 GPU 上下文为有效
   GPUContext::get().markValid();
@@ -99,25 +127,26 @@ void GLRenderer::shutdown() {
   GPUContext::get().markInvalid();
 
   spriteBatch_.shutdown();
+  sdfShapes_.shutdown();
+  sdfShapesEnabled_ = false;
+  GLFrameConstants::get().shutdown();
 
-  if (lineVbo_ != 0) {
-    glDeleteBuffers(1, &lineVbo_);
-    VRAMMgr::get().freeBuffer(MAX_LINE_VERTICES * sizeof(ShapeVertex));
-    lineVbo_ = 0;
-  }
-  if (lineVao_ != 0) {
-    glDeleteVertexArrays(1, &lineVao_);
-    lineVao_ = 0;
-  }
   if (shapeVbo_ != 0) {
+    GLStateCache::get().onBufferDeleted(shapeVbo_);
     glDeleteBuffers(1, &shapeVbo_);
     VRAMMgr::get().freeBuffer(MAX_SHAPE_VERTICES * sizeof(ShapeVertex));
     shapeVbo_ = 0;
   }
   if (shapeVao_ != 0) {
+    GLStateCache::get().onVertexArrayDeleted(shapeVao_);
     glDeleteVertexArrays(1, &shapeVao_);
     shapeVao_ = 0;
   }
+
+  shapeVertexCache_.clear();
+  shapeVertexCache_.shrink_to_fit();
+  solidScratch_.clear();
+  solidScratch_.shrink_to_fit();
 }
 
 /**
@@ -125,6 +154,12 @@ void GLRenderer::shutdown() {
  * @param clearColor 清屏颜色
  */
 void GLRenderer::beginFrame(const Color &clearColor) {
+#ifdef E2D_DEBUG
+  // 流水线模式下渲染器只能由渲染线程使用，其他线程须录制命令
+  if (!GPUContext::get().isOwnerThread()) {
+    E2D_LOG_ERROR("GLRenderer used off the graphics context thread");
+  }
+#endif
   glClearColor(clearColor.r, clearColor.g, clearColor.b, clearColor.a);
   glClear(GL_COLOR_BUFFER_BIT);
   resetStats();
@@ -134,10 +169,9 @@ void GLRenderer::beginFrame(const Color &clearColor) {
  * @brief 结束当前帧，刷新所有待处理的渲染批次
  */
 void GLRenderer::endFrame() {
-  // 刷新所有待处理的形状批次
+  // 刷新所有待处理的形状批次（包含三角化后的线条）
+  flushSDFShapes();
   flushShapeBatch();
-  // 刷新所有待处理的线条批次
-  flushLineBatch();
 }
 
 /**
@@ -148,7 +182,14 @@ void GLRenderer::endFrame() {
  * @param height 视口高度
  */
 void GLRenderer::setViewport(int x, int y, int width, int height) {
-  glViewport(x, y, width, height);
+  GLStateCache::get().setViewport(x, y, width, height);
+  GLFrameConstants::get().setViewportSize(static_cast<float>(width),
+                                          static_cast<float>(height));
+  // 记录视口尺寸，供圆的自动 LOD 换算像素半径
+  cachedViewportX_ = x;
+  cachedViewportY_ = y;
+  cachedViewportWidth_ = width;
+  cachedViewportHeight_ = height;
 }
 
 /**
@@ -161,6 +202,14 @@ void GLRenderer::setVSync(bool enabled) {
   SDL_GL_SetSwapInterval(enabled ? 1 : 0);
 }
 
+/**
+ * @brief 设置着色器可见的运行时间
+ * @param seconds 运行时间（秒）
+ */
+void GLRenderer::setFrameTime(float seconds) {
+  GLFrameConstants::get().setTime(seconds);
+}
+
 /**
  * @brief 设置混合模式
  * @param mode 混合模式枚举值
@@ -179,18 +228,7 @@ void GLRenderer::setBlendMode(BlendMode mode) {
   }
 
   const BlendState &state = BLEND_STATES[index];
-  if (state.enable) {
-    if (!blendEnabled_) {
-      glEnable(GL_BLEND);
-      blendEnabled_ = true;
-    }
-    glBlendFunc(state.srcFactor, state.dstFactor);
-  } else {
-    if (blendEnabled_) {
-      glDisable(GL_BLEND);
-      blendEnabled_ = false;
-    }
-  }
+  GLStateCache::get().setBlend(state.enable, state.srcFactor, state.dstFactor);
 }
 
 /**
@@ -198,14 +236,24 @@ void GLRenderer::setBlendMode(BlendMode mode) {
  * @param matrix 4x4视图投影矩阵
  */
 void GLRenderer::setViewProjection(const glm::mat4 &matrix) {
+  if (matrix == viewProjection_) {
+    return;
+  }
+  // 已排队的几何按旧矩阵提交，先刷新再更新帧常量
+  flushPendingSDFShapes();
+  flushShapeBatch();
+  if (spriteBatchActive_) {
+    spriteBatch_.end();
+  }
   viewProjection_ = matrix;
+  GLFrameConstants::get().setViewProjection(matrix);
 }
 
 /**
- * @brief 压入变换矩阵到变换栈
- * @param transform 变换矩阵
+ * @brief 压入变换到变换栈
+ * @param transform 相对当前栈顶的仿射变换
  */
-void GLRenderer::pushTransform(const glm::mat4 &transform) {
+void GLRenderer::pushTransform(const Affine2D &transform) {
   if (transformStack_.empty()) {
     transformStack_.push_back(transform);
   } else {
@@ -214,7 +262,7 @@ void GLRenderer::pushTransform(const glm::mat4 &transform) {
 }
 
 /**
- * @brief 从变换栈弹出顶部变换矩阵
+ * @brief 从变换栈弹出顶部变换
  */
 void GLRenderer::popTransform() {
   if (!transformStack_.empty()) {
@@ -223,15 +271,10 @@ void GLRenderer::popTransform() {
 }
 
 /**
- * @brief 获取当前累积的变换矩阵
- * @return 当前变换矩阵，如果栈为空则返回单位矩阵
+ * @brief 获取当前累积的变换
+ * @return 当前仿射变换，如果栈为空则返回单位变换
  */
-glm::mat4 GLRenderer::getCurrentTransform() const {
-  if (transformStack_.empty()) {
-    return glm::mat4(1.0f);
-  }
-  return transformStack_.back();
-}
+Affine2D GLRenderer::getCurrentTransform() const { return currentAffine(); }
 
 /**
  * @brief 创建纹理对象
@@ -258,7 +301,10 @@ Ptr<Texture> GLRenderer::loadTexture(const std::string &filepath) {
 /**
  * @brief 开始精灵批处理
  */
-void GLRenderer::beginSpriteBatch() { spriteBatch_.begin(viewProjection_); }
+void GLRenderer::beginSpriteBatch() {
+  spriteBatch_.begin(viewProjection_);
+  spriteBatchActive_ = true;
+}
 
 /**
  * @brief 绘制精灵（带完整参数）
@@ -294,6 +340,7 @@ void GLRenderer::drawSprite(const Texture &texture, const Rect &destRect,
   data.anchor = glm::vec2(anchor.x, anchor.y);
   data.isSDF = false;
 
+  flushPendingSDFShapes();
   spriteBatch_.draw(texture, data);
 }
 
@@ -312,12 +359,48 @@ void GLRenderer::drawSprite(const Texture &texture, const Vec2 &position,
   drawSprite(texture, destRect, srcRect, tint, 0.0f, Vec2(0, 0));
 }
 
+/**
+ * @brief 绘制精灵（仿射变换版本）
+ * @param texture 纹理引用
+ * @param transform 局部到世界的 2x3 仿射变换
+ * @param size 精灵局部尺寸
+ * @param srcRect 源矩形（纹理坐标），宽高为负表示翻转
+ * @param tint 着色颜色
+ * @param anchor 锚点位置（0-1范围）
+ */
+void GLRenderer::drawSprite(const Texture &texture, const Affine2D &transform,
+                            const Size &size, const Rect &srcRect,
+                            const Color &tint, const Vec2 &anchor) {
+  GLSpriteBatch::AffineSpriteData data;
+  data.transform = transform;
+  data.size = glm::vec2(size.width, size.height);
+
+  float texW = static_cast<float>(texture.getWidth());
+  float texH = static_cast<float>(texture.getHeight());
+
+  // 不对纹理坐标取 min/max，负宽高的源矩形保留翻转
+  data.texCoordMin = glm::vec2(srcRect.origin.x / texW, srcRect.origin.y / texH);
+  data.texCoordMax =
+      glm::vec2((srcRect.origin.x + srcRect.size.width) / texW,
+                (srcRect.origin.y + srcRect.size.height) / texH);
+
+  data.color = glm::vec4(tint.r, tint.g, tint.b, tint.a);
+  data.anchor = glm::vec2(anchor.x, anchor.y);
+  data.isSDF = false;
+
+  flushPendingSDFShapes();
+  spriteBatch_.draw(texture, data);
+}
+
 /**
  * @brief 结束精灵批处理并提交绘制
  */
 void GLRenderer::endSpriteBatch() {
   spriteBatch_.end();
+  spriteBatchActive_ = false;
   stats_.drawCalls += spriteBatch_.getDrawCallCount();
+  stats_.flushesAvoided += spriteBatch_.getFlushesAvoided();
+  stats_.batchFlushes += spriteBatch_.getFlushCount();
 }
 
 /**
@@ -329,42 +412,28 @@ void GLRenderer::endSpriteBatch() {
  */
 void GLRenderer::drawLine(const Vec2 &start, const Vec2 &end,
                           const Color &color, float width) {
-  // 如果线宽改变，需要先刷新线条批次
-  if (width != currentLineWidth_) {
-    flushLineBatch();
-    currentLineWidth_ = width;
-  }
-
-  // 添加两个顶点到线条缓冲区
-  addLineVertex(start.x, start.y, color);
-  addLineVertex(end.x, end.y, color);
+  glm::vec2 a = transformPoint(start.x, start.y);
+  glm::vec2 b = transformPoint(end.x, end.y);
+  tessellator_.clear();
+  tessellator_.tessellateSegment(Vec2(a.x, a.y), Vec2(b.x, b.y),
+                                 pixelsToWorld(width));
+  submitTessellatedQuads(color);
 }
 
+/**
+ * @brief 绘制矩形边框
+ * @param rect 矩形区域
+ * @param color 边框颜色
+ * @param width 线条宽度
+ */
 void GLRenderer::drawRect(const Rect &rect, const Color &color, float width) {
-  // 如果线宽改变，需要先刷新线条批次
-  if (width != currentLineWidth_) {
-    flushLineBatch();
-    currentLineWidth_ = width;
-  }
-
   float x1 = rect.origin.x;
   float y1 = rect.origin.y;
   float x2 = rect.origin.x + rect.size.width;
   float y2 = rect.origin.y + rect.size.height;
 
-  // 4条线段 = 8个顶点
-  // 上边
-  addLineVertex(x1, y1, color);
-  addLineVertex(x2, y1, color);
-  // 右边
-  addLineVertex(x2, y1, color);
-  addLineVertex(x2, y2, color);
-  // 下边
-  addLineVertex(x2, y2, color);
-  addLineVertex(x1, y2, color);
-  // 左边
-  addLineVertex(x1, y2, color);
-  addLineVertex(x1, y1, color);
+  const Vec2 corners[4] = {{x1, y1}, {x2, y1}, {x2, y2}, {x1, y2}};
+  strokePolyline(corners, 4, color, width, true, LineJoin::Miter);
 }
 
 /**
@@ -373,15 +442,24 @@ void GLRenderer::drawRect(const Rect &rect, const Color &color, float width) {
  * @param color 填充颜色
  */
 void GLRenderer::fillRect(const Rect &rect, const Color &color) {
-  // 提交当前批次（如果模式不同）
-  submitShapeBatch(GL_TRIANGLES);
-
-  // 添加两个三角形组成矩形（6个顶点）
   float x1 = rect.origin.x;
   float y1 = rect.origin.y;
   float x2 = rect.origin.x + rect.size.width;
   float y2 = rect.origin.y + rect.size.height;
 
+  if (useSpriteBatchForShapes()) {
+    flushPendingSDFShapes();
+    spriteBatch_.drawSolidQuad(transformPoint(x1, y1), transformPoint(x2, y1),
+                               transformPoint(x2, y2), transformPoint(x1, y2),
+                               glm::vec4(color.r, color.g, color.b, color.a));
+    return;
+  }
+
+  // 提交当前批次（如果模式不同）
+  submitShapeBatch(GL_TRIANGLES);
+
+  // 添加两个三角形组成矩形（6个顶点）
+
   // 三角形1: (x1,y1), (x2,y1), (x2,y2)
   addShapeVertex(x1, y1, color);
   addShapeVertex(x2, y1, color);
@@ -398,34 +476,23 @@ void GLRenderer::fillRect(const Rect &rect, const Color &color) {
  * @param center 圆心坐标
  * @param radius 半径
  * @param color 边框颜色
- * @param segments 分段数
+ * @param segments 分段数，<= 0 时自动选择
  * @param width 线条宽度
  */
 void GLRenderer::drawCircle(const Vec2 &center, float radius,
                             const Color &color, int segments, float width) {
-  // 限制段数不超过缓存大小
-  if (segments > static_cast<int>(MAX_CIRCLE_SEGMENTS)) {
-    segments = static_cast<int>(MAX_CIRCLE_SEGMENTS);
-  }
-
-  // 如果线宽改变，需要先刷新线条批次
-  if (width != currentLineWidth_) {
-    flushLineBatch();
-    currentLineWidth_ = width;
+  segments = resolveCircleSegments(radius, segments);
+  if (segments < 3) {
+    return;
   }
 
-  // 使用线条批处理绘制圆形
+  const Vec2 *unit = unitCircles_.get(segments);
+  linePoints_.clear();
   for (int i = 0; i < segments; ++i) {
-    float angle1 =
-        2.0f * 3.14159f * static_cast<float>(i) / static_cast<float>(segments);
-    float angle2 = 2.0f * 3.14159f * static_cast<float>(i + 1) /
-                   static_cast<float>(segments);
-
-    addLineVertex(center.x + radius * cosf(angle1),
-                  center.y + radius * sinf(angle1), color);
-    addLineVertex(center.x + radius * cosf(angle2),
-                  center.y + radius * sinf(angle2), color);
+    linePoints_.push_back(center + unit[i] * radius);
   }
+  strokePolyline(linePoints_.data(), linePoints_.size(), color, width, true,
+                 LineJoin::Miter);
 }
 
 /**
@@ -433,33 +500,132 @@ void GLRenderer::drawCircle(const Vec2 &center, float radius,
  * @param center 圆心坐标
  * @param radius 半径
  * @param color 填充颜色
- * @param segments 分段数
+ * @param segments 分段数，<= 0 时自动选择
  */
 void GLRenderer::fillCircle(const Vec2 &center, float radius,
                             const Color &color, int segments) {
-  // 限制段数不超过缓存大小
-  if (segments > static_cast<int>(MAX_CIRCLE_SEGMENTS)) {
-    segments = static_cast<int>(MAX_CIRCLE_SEGMENTS);
+  segments = resolveCircleSegments(radius, segments);
+  if (segments < 3) {
+    return;
+  }
+
+  // 边缘点只变换一次，相邻三角形共用
+  const Vec2 *unit = unitCircles_.get(segments);
+  solidScratch_.clear();
+  solidScratch_.push_back(transformPoint(center.x, center.y));
+  for (int i = 0; i <= segments; ++i) {
+    Vec2 p = center + unit[i] * radius;
+    solidScratch_.push_back(transformPoint(p.x, p.y));
+  }
+
+  if (useSpriteBatchForShapes()) {
+    flushPendingSDFShapes();
+    // 中心 + 闭合的边缘点，按扇形每两个三角形打包为一个四边形
+    spriteBatch_.drawSolidFan(solidScratch_.data(), solidScratch_.size(),
+                              glm::vec4(color.r, color.g, color.b, color.a));
+    return;
   }
 
   // 提交当前批次（如果模式不同）
   submitShapeBatch(GL_TRIANGLES);
 
-  // 使用三角形扇形填充圆
-  // 中心点 + 边缘点
-  for (int i = 0; i < segments; ++i) {
-    float angle1 =
-        2.0f * 3.14159f * static_cast<float>(i) / static_cast<float>(segments);
-    float angle2 = 2.0f * 3.14159f * static_cast<float>(i + 1) /
-                   static_cast<float>(segments);
+  // 每个三角形：中心 -> 边缘点1 -> 边缘点2
+  for (int i = 1; i <= segments; ++i) {
+    // 保证一个三角形的顶点不会被刷新拆开
+    if (shapeVertexCount_ + 3 > MAX_SHAPE_VERTICES) {
+      flushShapeBatch();
+    }
+    pushShapeVertex(solidScratch_[0], color);
+    pushShapeVertex(solidScratch_[i], color);
+    pushShapeVertex(solidScratch_[i + 1], color);
+  }
+}
 
-    // 每个三角形：中心 -> 边缘点1 -> 边缘点2
-    addShapeVertex(center.x, center.y, color);
-    addShapeVertex(center.x + radius * cosf(angle1),
-                   center.y + radius * sinf(angle1), color);
-    addShapeVertex(center.x + radius * cosf(angle2),
-                   center.y + radius * sinf(angle2), color);
+/**
+ * @brief 以 SDF 绘制圆形或圆环
+ * @param center 圆心坐标
+ * @param radius 半径
+ * @param color 颜色
+ * @param thickness 描边宽度（屏幕像素），0 为填充
+ */
+void GLRenderer::drawCircleSDF(const Vec2 &center, float radius,
+                               const Color &color, float thickness) {
+  if (radius <= 0.0f) {
+    return;
   }
+
+  GLSDFShapeBatch::InstanceData inst;
+  Affine2D m = currentAffine();
+  inst.center = m.transformPoint(center).toGlm();
+  inst.axisX = glm::vec2(m.a, m.b);
+  inst.axisY = glm::vec2(m.c, m.d);
+  inst.halfSize = glm::vec2(radius, radius);
+  inst.radius = radius;
+  inst.thickness = pixelsToLocal(std::max(thickness, 0.0f), m);
+  submitSDFShape(SDFShapeKind::Circle, color, inst);
+}
+
+/**
+ * @brief 以 SDF 绘制圆角矩形
+ * @param rect 矩形区域
+ * @param cornerRadius 圆角半径（限制在半宽、半高以内）
+ * @param color 颜色
+ * @param thickness 描边宽度（屏幕像素），0 为填充
+ */
+void GLRenderer::drawRoundedRectSDF(const Rect &rect, float cornerRadius,
+                                    const Color &color, float thickness) {
+  glm::vec2 halfSize(std::abs(rect.size.width) * 0.5f,
+                     std::abs(rect.size.height) * 0.5f);
+  if (halfSize.x <= 0.0f || halfSize.y <= 0.0f) {
+    return;
+  }
+
+  GLSDFShapeBatch::InstanceData inst;
+  Affine2D m = currentAffine();
+  Vec2 center(rect.origin.x + rect.size.width * 0.5f,
+              rect.origin.y + rect.size.height * 0.5f);
+  inst.center = m.transformPoint(center).toGlm();
+  inst.axisX = glm::vec2(m.a, m.b);
+  inst.axisY = glm::vec2(m.c, m.d);
+  inst.halfSize = halfSize;
+  inst.radius =
+      std::clamp(cornerRadius, 0.0f, std::min(halfSize.x, halfSize.y));
+  inst.thickness = pixelsToLocal(std::max(thickness, 0.0f), m);
+  submitSDFShape(SDFShapeKind::RoundedRect, color, inst);
+}
+
+/**
+ * @brief 以 SDF 绘制胶囊（两端为半圆的粗线段）
+ * @param start 起点
+ * @param end 终点
+ * @param radius 半宽
+ * @param color 颜色
+ * @param thickness 描边宽度（屏幕像素），0 为填充
+ */
+void GLRenderer::drawCapsuleSDF(const Vec2 &start, const Vec2 &end,
+                                float radius, const Color &color,
+                                float thickness) {
+  if (radius <= 0.0f) {
+    return;
+  }
+  Vec2 dir = end - start;
+  float length = dir.length();
+  if (length < 1e-6f) {
+    drawCircleSDF(start, radius, color, thickness);
+    return;
+  }
+
+  // 局部 X 轴沿线段方向，再经变换栈映射到世界空间
+  Vec2 u = dir / length;
+  GLSDFShapeBatch::InstanceData inst;
+  Affine2D m = currentAffine();
+  inst.center = m.transformPoint((start + end) * 0.5f).toGlm();
+  inst.axisX = glm::vec2(m.a * u.x + m.c * u.y, m.b * u.x + m.d * u.y);
+  inst.axisY = glm::vec2(-m.a * u.y + m.c * u.x, -m.b * u.y + m.d * u.x);
+  inst.halfSize = glm::vec2(length * 0.5f + radius, radius);
+  inst.radius = radius;
+  inst.thickness = pixelsToLocal(std::max(thickness, 0.0f), m);
+  submitSDFShape(SDFShapeKind::Capsule, color, inst);
 }
 
 /**
@@ -472,9 +638,8 @@ void GLRenderer::fillCircle(const Vec2 &center, float radius,
  */
 void GLRenderer::drawTriangle(const Vec2 &p1, const Vec2 &p2, const Vec2 &p3,
                               const Color &color, float width) {
-  drawLine(p1, p2, color, width);
-  drawLine(p2, p3, color, width);
-  drawLine(p3, p1, color, width);
+  const Vec2 points[3] = {p1, p2, p3};
+  strokePolyline(points, 3, color, width, true, LineJoin::Miter);
 }
 
 /**
@@ -486,6 +651,15 @@ void GLRenderer::drawTriangle(const Vec2 &p1, const Vec2 &p2, const Vec2 &p3,
  */
 void GLRenderer::fillTriangle(const Vec2 &p1, const Vec2 &p2, const Vec2 &p3,
                               const Color &color) {
+  if (useSpriteBatchForShapes()) {
+    flushPendingSDFShapes();
+    spriteBatch_.drawSolidTriangle(
+        transformPoint(p1.x, p1.y), transformPoint(p2.x, p2.y),
+        transformPoint(p3.x, p3.y),
+        glm::vec4(color.r, color.g, color.b, color.a));
+    return;
+  }
+
   submitShapeBatch(GL_TRIANGLES);
 
   addShapeVertex(p1.x, p1.y, color);
@@ -504,39 +678,95 @@ void GLRenderer::drawPolygon(const std::vector<Vec2> &points,
   if (points.size() < 2)
     return;
 
-  // 如果线宽改变，需要先刷新线条批次
-  if (width != currentLineWidth_) {
-    flushLineBatch();
-    currentLineWidth_ = width;
-  }
+  strokePolyline(points.data(), points.size(), color, width, true,
+                 LineJoin::Miter);
+}
 
-  // 绘制所有边
-  for (size_t i = 0; i < points.size(); ++i) {
-    const Vec2 &p1 = points[i];
-    const Vec2 &p2 = points[(i + 1) % points.size()];
-    addLineVertex(p1.x, p1.y, color);
-    addLineVertex(p2.x, p2.y, color);
-  }
+/**
+ * @brief 绘制折线
+ * @param points 顶点数组
+ * @param color 线条颜色
+ * @param width 线条宽度
+ * @param closed 是否首尾相连
+ * @param join 拐角连接方式
+ */
+void GLRenderer::drawPolyline(const std::vector<Vec2> &points,
+                              const Color &color, float width, bool closed,
+                              LineJoin join) {
+  if (points.size() < 2)
+    return;
+
+  strokePolyline(points.data(), points.size(), color, width, closed, join);
 }
 
 /**
  * @brief 填充多边形
  * @param points 顶点数组
  * @param color 填充颜色
+ *
+ * 每次调用即时做耳切剖分，支持凹多边形；顶点不变的多边形应缓存剖分结果
+ * 并使用 fillPolygonMesh
  */
 void GLRenderer::fillPolygon(const std::vector<Vec2> &points,
                              const Color &color) {
   if (points.size() < 3)
     return;
 
+  PolygonTriangulator::triangulate(points, polygonIndices_);
+  fillPolygonMesh(points.data(), points.size(), polygonIndices_.data(),
+                  polygonIndices_.size(), color);
+}
+
+/**
+ * @brief 填充预先剖分的多边形
+ * @param points 顶点数组
+ * @param pointCount 顶点数量
+ * @param indices 三角形索引（每 3 个一组）
+ * @param indexCount 索引数量
+ * @param color 填充颜色
+ */
+void GLRenderer::fillPolygonMesh(const Vec2 *points, size_t pointCount,
+                                 const uint32_t *indices, size_t indexCount,
+                                 const Color &color) {
+  if (pointCount < 3 || indexCount < 3)
+    return;
+
+  // 顶点只变换一次，由各三角形按索引共享
+  solidScratch_.clear();
+  for (size_t i = 0; i < pointCount; ++i) {
+    solidScratch_.push_back(transformPoint(points[i].x, points[i].y));
+  }
+  indexCount -= indexCount % 3;
+
+  if (useSpriteBatchForShapes()) {
+    flushPendingSDFShapes();
+    glm::vec4 c(color.r, color.g, color.b, color.a);
+    for (size_t k = 0; k < indexCount; k += 3) {
+      if (indices[k] >= pointCount || indices[k + 1] >= pointCount ||
+          indices[k + 2] >= pointCount) {
+        continue;
+      }
+      spriteBatch_.drawSolidTriangle(solidScratch_[indices[k]],
+                                     solidScratch_[indices[k + 1]],
+                                     solidScratch_[indices[k + 2]], c);
+    }
+    return;
+  }
+
   submitShapeBatch(GL_TRIANGLES);
 
-  // 使用三角形扇形填充
-  // 从第一个点开始，每两个相邻点组成一个三角形
-  for (size_t i = 1; i < points.size() - 1; ++i) {
-    addShapeVertex(points[0].x, points[0].y, color);
-    addShapeVertex(points[i].x, points[i].y, color);
-    addShapeVertex(points[i + 1].x, points[i + 1].y, color);
+  for (size_t k = 0; k < indexCount; k += 3) {
+    if (indices[k] >= pointCount || indices[k + 1] >= pointCount ||
+        indices[k + 2] >= pointCount) {
+      continue;
+    }
+    // 保证一个三角形的顶点不会被刷新拆开
+    if (shapeVertexCount_ + 3 > MAX_SHAPE_VERTICES) {
+      flushShapeBatch();
+    }
+    pushShapeVertex(solidScratch_[indices[k]], color);
+    pushShapeVertex(solidScratch_[indices[k + 1]], color);
+    pushShapeVertex(solidScratch_[indices[k + 2]], color);
   }
 }
 
@@ -619,6 +849,7 @@ void GLRenderer::drawText(const FontAtlas &font, const std::string &text,
 
   // 使用批处理绘制所有字符
   if (!sprites.empty()) {
+    flushPendingSDFShapes();
     spriteBatch_.drawBatch(*font.getTexture(), sprites);
   }
 }
@@ -626,7 +857,27 @@ void GLRenderer::drawText(const FontAtlas &font, const std::string &text,
 /**
  * @brief 重置渲染统计信息
  */
-void GLRenderer::resetStats() { stats_ = Stats{}; }
+void GLRenderer::resetStats() {
+  stats_ = Stats{};
+  GLStateCache::get().resetCounters();
+  GLFrameConstants::get().resetUploadCount();
+}
+
+/**
+ * @brief 获取渲染统计信息
+ * @return 渲染器统计与状态缓存记录的实际绑定次数
+ */
+RenderBackend::Stats GLRenderer::getStats() const {
+  Stats stats = stats_;
+  const auto &counters = GLStateCache::get().getCounters();
+  stats.textureBinds = counters.textureBinds;
+  stats.shaderBinds = counters.shaderBinds;
+  stats.vertexArrayBinds = counters.vertexArrayBinds;
+  stats.bufferBinds = counters.bufferBinds;
+  stats.redundantBindsSkipped = counters.redundantSkipped;
+  stats.frameConstantUploads = GLFrameConstants::get().getUploadCount();
+  return stats;
+}
 
 /**
  * @brief 初始化形状渲染所需的OpenGL资源（VAO、VBO、着色器）
@@ -641,12 +892,16 @@ void GLRenderer::initShapeRendering() {
     }
   }
 
+  // 分配 CPU 端顶点缓存
+  shapeVertexCache_.assign(MAX_SHAPE_VERTICES, ShapeVertex{});
+  solidScratch_.reserve(MAX_CIRCLE_SEGMENTS + 2);
+
   // 创建形状 VAO 和 VBO
   glGenVertexArrays(1, &shapeVao_);
   glGenBuffers(1, &shapeVbo_);
 
-  glBindVertexArray(shapeVao_);
-  glBindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
+  GLStateCache::get().bindVertexArray(shapeVao_);
+  GLStateCache::get().bindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
   glBufferData(GL_ARRAY_BUFFER, MAX_SHAPE_VERTICES * sizeof(ShapeVertex),
                nullptr, GL_DYNAMIC_DRAW);
 
@@ -660,32 +915,24 @@ void GLRenderer::initShapeRendering() {
   glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(ShapeVertex),
                         reinterpret_cast<void *>(offsetof(ShapeVertex, r)));
 
-  glBindVertexArray(0);
-
-  // 创建线条专用 VAO 和 VBO
-  glGenVertexArrays(1, &lineVao_);
-  glGenBuffers(1, &lineVbo_);
-
-  glBindVertexArray(lineVao_);
-  glBindBuffer(GL_ARRAY_BUFFER, lineVbo_);
-  glBufferData(GL_ARRAY_BUFFER, MAX_LINE_VERTICES * sizeof(ShapeVertex),
-               nullptr, GL_DYNAMIC_DRAW);
-
-  // 位置属性 (location = 0)
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(ShapeVertex),
-                        reinterpret_cast<void *>(offsetof(ShapeVertex, x)));
-
-  // 颜色属性 (location = 1)
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, sizeof(ShapeVertex),
-                        reinterpret_cast<void *>(offsetof(ShapeVertex, r)));
-
-  glBindVertexArray(0);
+  GLStateCache::get().bindVertexArray(0);
 
   // VRAM 跟踪
   VRAMMgr::get().allocBuffer(MAX_SHAPE_VERTICES * sizeof(ShapeVertex));
-  VRAMMgr::get().allocBuffer(MAX_LINE_VERTICES * sizeof(ShapeVertex));
+}
+
+/**
+ * @brief 用变换栈顶矩阵变换一个点
+ * @param x X坐标
+ * @param y Y坐标
+ * @return 变换后的坐标
+ */
+glm::vec2 GLRenderer::transformPoint(float x, float y) const {
+  if (transformStack_.empty()) {
+    return glm::vec2(x, y);
+  }
+  Vec2 pos = transformStack_.back().transformPoint(Vec2(x, y));
+  return glm::vec2(pos.x, pos.y);
 }
 
 /**
@@ -695,15 +942,20 @@ void GLRenderer::initShapeRendering() {
  * @param color 顶点颜色
  */
 void GLRenderer::addShapeVertex(float x, float y, const Color &color) {
+  pushShapeVertex(transformPoint(x, y), color);
+}
+
+/**
+ * @brief 添加已变换的形状顶点到缓存
+ * @param pos 世界坐标
+ * @param color 顶点颜色
+ */
+void GLRenderer::pushShapeVertex(const glm::vec2 &pos, const Color &color) {
+  flushPendingSDFShapes();
   if (shapeVertexCount_ >= MAX_SHAPE_VERTICES) {
     flushShapeBatch();
   }
 
-  glm::vec4 pos(x, y, 0.0f, 1.0f);
-  if (!transformStack_.empty()) {
-    pos = transformStack_.back() * pos;
-  }
-
   ShapeVertex &v = shapeVertexCache_[shapeVertexCount_++];
   v.x = pos.x;
   v.y = pos.y;
@@ -714,28 +966,142 @@ void GLRenderer::addShapeVertex(float x, float y, const Color &color) {
 }
 
 /**
- * @brief 添加线条顶点到缓存
- * @param x X坐标
- * @param y Y坐标
- * @param color 顶点颜色
+ * @brief 变换并三角化折线，写入当前形状批次
+ * @param points 顶点数组
+ * @param count 顶点数量
+ * @param color 线条颜色
+ * @param width 线宽（屏幕像素，不受变换栈与相机缩放影响）
+ * @param closed 是否首尾相连
+ * @param join 拐角连接方式
  */
-void GLRenderer::addLineVertex(float x, float y, const Color &color) {
-  if (lineVertexCount_ >= MAX_LINE_VERTICES) {
-    flushLineBatch();
+void GLRenderer::strokePolyline(const Vec2 *points, size_t count,
+                                const Color &color, float width, bool closed,
+                                LineJoin join) {
+  // 先变换再三角化，线宽按视图投影换算为世界单位，与原 GL_LINES 一样
+  // 以像素计
+  const Vec2 *source = points;
+  if (!transformStack_.empty()) {
+    if (source == linePoints_.data()) {
+      for (auto &p : linePoints_) {
+        glm::vec2 t = transformPoint(p.x, p.y);
+        p = Vec2(t.x, t.y);
+      }
+    } else {
+      linePoints_.clear();
+      for (size_t i = 0; i < count; ++i) {
+        glm::vec2 t = transformPoint(points[i].x, points[i].y);
+        linePoints_.push_back(Vec2(t.x, t.y));
+      }
+      source = linePoints_.data();
+    }
   }
 
-  glm::vec4 pos(x, y, 0.0f, 1.0f);
-  if (!transformStack_.empty()) {
-    pos = transformStack_.back() * pos;
+  tessellator_.clear();
+  tessellator_.tessellate(source, count, pixelsToWorld(width), closed, join);
+  submitTessellatedQuads(color);
+}
+
+/**
+ * @brief 将三角化结果写入精灵批次（统一批次模式）或形状批次
+ * @param color 线条颜色
+ */
+void GLRenderer::submitTessellatedQuads(const Color &color) {
+  const auto &quads = tessellator_.getQuads();
+  if (quads.empty()) {
+    return;
   }
 
-  ShapeVertex &v = lineVertexCache_[lineVertexCount_++];
-  v.x = pos.x;
-  v.y = pos.y;
-  v.r = color.r;
-  v.g = color.g;
-  v.b = color.b;
-  v.a = color.a;
+  if (useSpriteBatchForShapes()) {
+    flushPendingSDFShapes();
+    glm::vec4 c(color.r, color.g, color.b, color.a);
+    for (const auto &q : quads) {
+      spriteBatch_.drawSolidQuad(q.p[0].toGlm(), q.p[1].toGlm(),
+                                 q.p[2].toGlm(), q.p[3].toGlm(), c);
+    }
+    return;
+  }
+
+  submitShapeBatch(GL_TRIANGLES);
+  for (const auto &q : quads) {
+    // 保证一个四边形的顶点不会被刷新拆开
+    if (shapeVertexCount_ + 6 > MAX_SHAPE_VERTICES) {
+      flushShapeBatch();
+    }
+    pushShapeVertex(q.p[0].toGlm(), color);
+    pushShapeVertex(q.p[1].toGlm(), color);
+    pushShapeVertex(q.p[2].toGlm(), color);
+    // 退化四边形只含一个三角形
+    if (q.p[3] != q.p[2]) {
+      pushShapeVertex(q.p[0].toGlm(), color);
+      pushShapeVertex(q.p[2].toGlm(), color);
+      pushShapeVertex(q.p[3].toGlm(), color);
+    }
+  }
+}
+
+/**
+ * @brief 将像素线宽换算为世界单位
+ * @param pixels 像素宽度
+ * @return 世界单位宽度，视口未知时原样返回
+ *
+ * 顶点已经过变换栈，只需按视图投影的缩放换算；非等比缩放时取两轴
+ * 缩放的几何平均
+ */
+float GLRenderer::pixelsToWorld(float pixels) const {
+  if (cachedViewportWidth_ <= 0 || cachedViewportHeight_ <= 0) {
+    return pixels;
+  }
+  // 世界单位轴投影到像素空间（NDC 跨度为 2，乘以半个视口）
+  Affine2D vp = Affine2D::fromMat4(viewProjection_);
+  float pixelArea = std::abs(vp.determinant()) *
+                    static_cast<float>(cachedViewportWidth_) * 0.5f *
+                    static_cast<float>(cachedViewportHeight_) * 0.5f;
+  if (pixelArea <= 0.0f) {
+    return pixels;
+  }
+  return pixels / std::sqrt(pixelArea);
+}
+
+/**
+ * @brief 将像素宽度换算为形状局部单位
+ * @param pixels 像素宽度
+ * @param local 局部到世界的变换（当前变换栈）
+ * @return 局部单位宽度
+ *
+ * SDF 形状的距离在局部空间计算，描边宽度须先换算到世界单位，再除以
+ * 变换栈的缩放（非等比缩放时取几何平均，与 pixelsToWorld 一致）
+ */
+float GLRenderer::pixelsToLocal(float pixels, const Affine2D &local) const {
+  float world = pixelsToWorld(pixels);
+  float scale = std::sqrt(std::abs(local.determinant()));
+  return scale > 0.0f ? world / scale : world;
+}
+
+/**
+ * @brief 确定圆的分段数
+ * @param radius 局部半径
+ * @param segments 调用方给出的分段数，<= 0 表示自动
+ * @return 实际分段数
+ *
+ * 自动模式下将半径经变换栈与视图投影投影到屏幕，按像素半径估算分段数
+ */
+int GLRenderer::resolveCircleSegments(float radius, int segments) const {
+  if (segments > 0) {
+    return std::min(segments, MAX_CIRCLE_SEGMENTS);
+  }
+  if (cachedViewportWidth_ <= 0 || cachedViewportHeight_ <= 0) {
+    return DEFAULT_CIRCLE_SEGMENTS;
+  }
+
+  // 局部单位轴经变换栈与视图投影的二维部分投影到像素空间
+  // （NDC 跨度为 2，乘以半个视口）
+  Affine2D m = Affine2D::fromMat4(viewProjection_) * currentAffine();
+  glm::vec2 toPixels(static_cast<float>(cachedViewportWidth_) * 0.5f,
+                     static_cast<float>(cachedViewportHeight_) * 0.5f);
+  float scaleX = glm::length(glm::vec2(m.a, m.b) * toPixels);
+  float scaleY = glm::length(glm::vec2(m.c, m.d) * toPixels);
+  return UnitCircleCache::segmentsForRadius(std::abs(radius) *
+                                            std::max(scaleX, scaleY));
 }
 
 /**
@@ -754,56 +1120,84 @@ void GLRenderer::submitShapeBatch(GLenum mode) {
 }
 
 /**
- * @brief 刷新形状批次，执行实际的OpenGL绘制调用
+ * @brief 提交一个 SDF 形状
+ * @param kind 形状种类
+ * @param color 颜色
+ * @param inst 已填写几何参数的形状记录（颜色与种类在此填写）
+ *
+ * 统一批次模式下写入精灵批次，与精灵、纯色形状交错时不刷新；
+ * 否则追加到独立 SDF 批次，先提交精灵批次与三角形批次中已排队的内容，
+ * 保证 SDF 形状按调用顺序叠放
  */
-void GLRenderer::flushShapeBatch() {
-  if (shapeVertexCount_ == 0)
+void GLRenderer::submitSDFShape(SDFShapeKind kind, const Color &color,
+                                GLSDFShapeBatch::InstanceData &inst) {
+  inst.color[0] = toUnorm8(color.r);
+  inst.color[1] = toUnorm8(color.g);
+  inst.color[2] = toUnorm8(color.b);
+  inst.color[3] = toUnorm8(color.a);
+  inst.kind = static_cast<uint8_t>(kind);
+  inst.padding[0] = inst.padding[1] = inst.padding[2] = 0;
+
+  if (useSpriteBatchForShapes() && spriteBatch_.supportsSDFShapes()) {
+    flushPendingSDFShapes();
+    spriteBatch_.drawSDFShape(inst);
+    stats_.sdfShapes++;
     return;
-
-  if (shapeShader_) {
-    shapeShader_->bind();
-    shapeShader_->setMat4("u_viewProjection", viewProjection_);
   }
 
-  glBindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
-  glBufferSubData(GL_ARRAY_BUFFER, 0, shapeVertexCount_ * sizeof(ShapeVertex),
-                  shapeVertexCache_.data());
+  if (spriteBatchActive_) {
+    // 只提交已排队的精灵，精灵批处理本身保持进行中
+    spriteBatch_.end();
+  }
+  flushShapeBatch();
+  if (sdfShapes_.isFull()) {
+    flushSDFShapes();
+  }
 
-  glBindVertexArray(shapeVao_);
-  glDrawArrays(currentShapeMode_, 0, static_cast<GLsizei>(shapeVertexCount_));
+  auto *dst = sdfShapes_.append();
+  if (dst) {
+    *dst = inst;
+  }
+}
 
+/**
+ * @brief 刷新 SDF 形状批次
+ */
+void GLRenderer::flushSDFShapes() {
+  size_t drawn = sdfShapes_.flush();
+  if (drawn == 0) {
+    return;
+  }
   stats_.drawCalls++;
-  stats_.triangleCount += static_cast<uint32_t>(shapeVertexCount_ / 3);
-
-  shapeVertexCount_ = 0;
+  stats_.batchFlushes++;
+  stats_.triangleCount += static_cast<uint32_t>(drawn * 2);
+  stats_.sdfShapes += static_cast<uint32_t>(drawn);
 }
 
 /**
- * @brief 刷新线条批次，执行实际的OpenGL绘制调用
+ * @brief 刷新形状批次，执行实际的OpenGL绘制调用
  */
-void GLRenderer::flushLineBatch() {
-  if (lineVertexCount_ == 0)
+void GLRenderer::flushShapeBatch() {
+  if (shapeVertexCount_ == 0)
     return;
 
-  // 先刷新形状批次
-  flushShapeBatch();
-
-  glLineWidth(currentLineWidth_);
+  GLFrameConstants::get().upload();
   if (shapeShader_) {
     shapeShader_->bind();
-    shapeShader_->setMat4("u_viewProjection", viewProjection_);
   }
 
-  glBindBuffer(GL_ARRAY_BUFFER, lineVbo_);
-  glBufferSubData(GL_ARRAY_BUFFER, 0, lineVertexCount_ * sizeof(ShapeVertex),
-                  lineVertexCache_.data());
+  GLStateCache::get().bindBuffer(GL_ARRAY_BUFFER, shapeVbo_);
+  glBufferSubData(GL_ARRAY_BUFFER, 0, shapeVertexCount_ * sizeof(ShapeVertex),
+                  shapeVertexCache_.data());
 
-  glBindVertexArray(lineVao_);
-  glDrawArrays(GL_LINES, 0, static_cast<GLsizei>(lineVertexCount_));
+  GLStateCache::get().bindVertexArray(shapeVao_);
+  glDrawArrays(currentShapeMode_, 0, static_cast<GLsizei>(shapeVertexCount_));
 
   stats_.drawCalls++;
+  stats_.batchFlushes++;
+  stats_.triangleCount += static_cast<uint32_t>(shapeVertexCount_ / 3);
 
-  lineVertexCount_ = 0;
+  shapeVertexCount_ = 0;
 }
 
 } // namespace extra2d
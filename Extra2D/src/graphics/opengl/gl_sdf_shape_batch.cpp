@@ -0,0 +1,215 @@
+#include <extra2d/graphics/opengl/gl_frame_constants.h>
+#include <extra2d/graphics/opengl/gl_sdf_shape_batch.h>
+#include <extra2d/graphics/opengl/gl_state_cache.h>
+#include <extra2d/utils/logger.h>
+#include <string>
+
+namespace extra2d {
+
+// 顶点着色器 (GLES 3.2)
+// 由 gl_VertexID 生成三角形带角点 (-1,-1) (1,-1) (-1,1) (1,1)，按局部外包尺寸展开；
+// 外包尺寸 = 半尺寸 + 半描边宽 + 抗锯齿余量（按帧常量中的像素缩放留 2 个像素）
+static const char *SDF_SHAPE_VERTEX_SHADER = R"(
+precision highp float;
+layout(location = 0) in vec4 aCenterAxisX;
+layout(location = 1) in vec4 aAxisYHalfSize;
+layout(location = 2) in vec2 aRadiusThickness;
+layout(location = 3) in vec4 aColor;
+layout(location = 4) in float aKind;
+
+out vec2 vLocal;
+out vec4 vColor;
+flat out vec4 vParams;
+flat out int vKind;
+
+void main() {
+    vec2 axisX = aCenterAxisX.zw;
+    vec2 axisY = aAxisYHalfSize.xy;
+    vec2 axisLen = vec2(length(axisX), length(axisY)) * u_pixelScale;
+    vec2 pad = 2.0 / max(axisLen, vec2(1e-4));
+    vec2 extent = aAxisYHalfSize.zw + aRadiusThickness.y * 0.5 + pad;
+    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1)) * 2.0 - 1.0;
+    vLocal = corner * extent;
+    vec2 world = aCenterAxisX.xy + axisX * vLocal.x + axisY * vLocal.y;
+    gl_Position = u_viewProjection * vec4(world, 0.0, 1.0);
+    vColor = aColor;
+    vParams = vec4(aAxisYHalfSize.zw, aRadiusThickness);
+    vKind = int(aKind + 0.5);
+}
+)";
+
+// 覆盖率函数：距离以局部单位计算，fwidth 折算到屏幕像素，因此缩放与旋转下
+// 边缘宽度一致；params = (halfSize.xy, radius, thickness)，kind 对应 SDFShapeKind
+const char *const GLSDFShapeBatch::GLSL_COVERAGE = R"(
+float sdfShapeCoverage(vec2 p, vec4 params, int kind) {
+    vec2 halfSize = params.xy;
+    float r = params.z;
+    float d;
+    if (kind == 0) {
+        d = length(p) - r;
+    } else if (kind == 1) {
+        vec2 q = abs(p) - halfSize + r;
+        d = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - r;
+    } else {
+        float a = halfSize.x - r;
+        d = length(vec2(p.x - clamp(p.x, -a, a), p.y)) - r;
+    }
+    if (params.w > 0.0) {
+        d = abs(d) - params.w * 0.5;
+    }
+    return clamp(0.5 - d / max(fwidth(d), 1e-4), 0.0, 1.0);
+}
+)";
+
+// 片段着色器 (GLES 3.2) - 头部
+static const char *SDF_SHAPE_FRAGMENT_SHADER_HEAD = R"(#version 300 es
+precision highp float;
+in vec2 vLocal;
+in vec4 vColor;
+flat in vec4 vParams;
+flat in int vKind;
+
+out vec4 fragColor;
+)";
+
+// 片段着色器 (GLES 3.2) - 主体，接在覆盖率函数之后
+static const char *SDF_SHAPE_FRAGMENT_SHADER = R"(
+void main() {
+    float alpha = sdfShapeCoverage(vLocal, vParams, vKind);
+    if (alpha <= 0.0) {
+        discard;
+    }
+    fragColor = vec4(vColor.rgb, vColor.a * alpha);
+}
+)";
+
+/**
+ * @brief 构造函数，初始化成员变量
+ */
+GLSDFShapeBatch::GLSDFShapeBatch() : vao_(0), instances_(nullptr), count_(0) {}
+
+/**
+ * @brief 析构函数，调用shutdown释放资源
+ */
+GLSDFShapeBatch::~GLSDFShapeBatch() { shutdown(); }
+
+/**
+ * @brief 编译着色器并创建实例流缓冲区与VAO
+ * @param streamMode 实例数据上传方式（与精灵批次一致）
+ * @return 初始化成功返回true，失败返回false
+ */
+bool GLSDFShapeBatch::init(VertexStreamMode streamMode) {
+  std::string vertexSource = "#version 300 es\n";
+  vertexSource += GLFrameConstants::GLSL_BLOCK;
+  vertexSource += SDF_SHAPE_VERTEX_SHADER;
+  std::string fragmentSource = SDF_SHAPE_FRAGMENT_SHADER_HEAD;
+  fragmentSource += GLSL_COVERAGE;
+  fragmentSource += SDF_SHAPE_FRAGMENT_SHADER;
+  if (!shader_.compileFromSource(vertexSource.c_str(),
+                                 fragmentSource.c_str())) {
+    E2D_LOG_ERROR("Failed to compile SDF shape shader");
+    return false;
+  }
+
+  if (!instanceStream_.init(GL_ARRAY_BUFFER, MAX_SHAPES * sizeof(InstanceData),
+                            streamMode)) {
+    E2D_LOG_ERROR("Failed to create SDF shape instance stream");
+    return false;
+  }
+
+  glGenVertexArrays(1, &vao_);
+  GLStateCache::get().bindVertexArray(vao_);
+  for (GLuint loc = 0; loc <= 4; ++loc) {
+    glEnableVertexAttribArray(loc);
+    glVertexAttribDivisor(loc, 1);
+  }
+  bindInstanceAttributes(0);
+  GLStateCache::get().bindVertexArray(0);
+
+  E2D_LOG_INFO("GLSDFShapeBatch initialized with capacity for {} shapes "
+               "({}-byte instances)",
+               MAX_SHAPES, sizeof(InstanceData));
+  return true;
+}
+
+/**
+ * @brief 释放OpenGL资源
+ */
+void GLSDFShapeBatch::shutdown() {
+  instanceStream_.shutdown();
+  instances_ = nullptr;
+  count_ = 0;
+
+  if (vao_ != 0) {
+    GLStateCache::get().onVertexArrayDeleted(vao_);
+    glDeleteVertexArrays(1, &vao_);
+    vao_ = 0;
+  }
+}
+
+/**
+ * @brief 获取下一条实例记录的写入位置
+ * @return 实例记录指针，批次已满或映射失败返回 nullptr
+ *
+ * 首次写入时从流缓冲区预留整批容量，刷新后释放
+ */
+GLSDFShapeBatch::InstanceData *GLSDFShapeBatch::append() {
+  if (count_ >= MAX_SHAPES) {
+    return nullptr;
+  }
+  if (instances_ == nullptr) {
+    instances_ = static_cast<InstanceData *>(instanceStream_.map(
+        MAX_SHAPES * sizeof(InstanceData), sizeof(InstanceData)));
+    if (instances_ == nullptr) {
+      return nullptr;
+    }
+  }
+  return &instances_[count_++];
+}
+
+/**
+ * @brief 绘制所有待处理形状
+ * @return 本次绘制的形状数
+ */
+size_t GLSDFShapeBatch::flush() {
+  if (count_ == 0) {
+    return 0;
+  }
+
+  size_t drawn = count_;
+  size_t offset = instanceStream_.unmap(drawn * sizeof(InstanceData));
+  instances_ = nullptr;
+  count_ = 0;
+
+  GLFrameConstants::get().upload();
+  shader_.bind();
+
+  GLStateCache::get().bindVertexArray(vao_);
+  bindInstanceAttributes(offset);
+  glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, static_cast<GLsizei>(drawn));
+  return drawn;
+}
+
+/**
+ * @brief 将实例属性指向流缓冲区中的指定偏移
+ * @param offset 本批次实例数据的字节偏移
+ */
+void GLSDFShapeBatch::bindInstanceAttributes(size_t offset) {
+  GLsizei stride = static_cast<GLsizei>(sizeof(InstanceData));
+  auto at = [offset](size_t member) {
+    return reinterpret_cast<void *>(offset + member);
+  };
+  GLStateCache::get().bindBuffer(GL_ARRAY_BUFFER, instanceStream_.getBuffer());
+  glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, stride,
+                        at(offsetof(InstanceData, center)));
+  glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, stride,
+                        at(offsetof(InstanceData, axisY)));
+  glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, stride,
+                        at(offsetof(InstanceData, radius)));
+  glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride,
+                        at(offsetof(InstanceData, color)));
+  glVertexAttribPointer(4, 1, GL_UNSIGNED_BYTE, GL_FALSE, stride,
+                        at(offsetof(InstanceData, kind)));
+}
+
+} // namespace extra2d
@@ -1,5 +1,10 @@
+#include <extra2d/graphics/gpu_context.h>
+#include <extra2d/graphics/opengl/gl_frame_constants.h>
 #include <extra2d/graphics/opengl/gl_shader.h>
+#include <extra2d/graphics/opengl/gl_state_cache.h>
 #include <extra2d/utils/logger.h>
+#include <atomic>
+#include <cstring>
 
 namespace extra2d {
 
@@ -11,10 +16,17 @@ GLShader::GLShader() : programID_(0) {
 
 /**
  * @brief 析构函数，删除OpenGL着色器程序
+ *
+ * 可能在非上下文线程析构，删除交给上下文所属线程
  */
 GLShader::~GLShader() {
     if (programID_ != 0) {
-        glDeleteProgram(programID_);
+        GPUContext::get().releaseOnOwner([programID = programID_] {
+            if (GPUContext::get().isValid()) {
+                GLStateCache::get().onProgramDeleted(programID);
+                glDeleteProgram(programID);
+            }
+        });
         programID_ = 0;
     }
 }
@@ -23,14 +35,14 @@ GLShader::~GLShader() {
  * @brief 绑定Shader程序
  */
 void GLShader::bind() const {
-    glUseProgram(programID_);
+    GLStateCache::get().useProgram(programID_);
 }
 
 /**
  * @brief 解绑Shader程序
  */
 void GLShader::unbind() const {
-    glUseProgram(0);
+    GLStateCache::get().useProgram(0);
 }
 
 /**
@@ -39,7 +51,7 @@ void GLShader::unbind() const {
  * @param value 布尔值
  */
 void GLShader::setBool(const std::string& name, bool value) {
-    glUniform1i(getUniformLocation(name), value ? 1 : 0);
+    set(uniform(name.c_str()), value ? 1 : 0);
 }
 
 /**
@@ -48,7 +60,7 @@ void GLShader::setBool(const std::string& name, bool value) {
  * @param value 整数值
  */
 void GLShader::setInt(const std::string& name, int value) {
-    glUniform1i(getUniformLocation(name), value);
+    set(uniform(name.c_str()), value);
 }
 
 /**
@@ -57,7 +69,7 @@ void GLShader::setInt(const std::string& name, int value) {
  * @param value 浮点值
  */
 void GLShader::setFloat(const std::string& name, float value) {
-    glUniform1f(getUniformLocation(name), value);
+    set(uniform(name.c_str()), value);
 }
 
 /**
@@ -66,7 +78,7 @@ void GLShader::setFloat(const std::string& name, float value) {
  * @param value 二维向量值
  */
 void GLShader::setVec2(const std::string& name, const glm::vec2& value) {
-    glUniform2fv(getUniformLocation(name), 1, &value[0]);
+    set(uniform(name.c_str()), value);
 }
 
 /**
@@ -75,7 +87,7 @@ void GLShader::setVec2(const std::string& name, const glm::vec2& value) {
  * @param value 三维向量值
  */
 void GLShader::setVec3(const std::string& name, const glm::vec3& value) {
-    glUniform3fv(getUniformLocation(name), 1, &value[0]);
+    set(uniform(name.c_str()), value);
 }
 
 /**
@@ -84,7 +96,7 @@ void GLShader::setVec3(const std::string& name, const glm::vec3& value) {
  * @param value 四维向量值
  */
 void GLShader::setVec4(const std::string& name, const glm::vec4& value) {
-    glUniform4fv(getUniformLocation(name), 1, &value[0]);
+    set(uniform(name.c_str()), value);
 }
 
 /**
@@ -93,7 +105,7 @@ void GLShader::setVec4(const std::string& name, const glm::vec4& value) {
  * @param value 4x4矩阵值
  */
 void GLShader::setMat4(const std::string& name, const glm::mat4& value) {
-    glUniformMatrix4fv(getUniformLocation(name), 1, GL_FALSE, &value[0][0]);
+    set(uniform(name.c_str()), value);
 }
 
 /**
@@ -102,7 +114,165 @@ void GLShader::setMat4(const std::string& name, const glm::mat4& value) {
  * @param color 颜色值
  */
 void GLShader::setColor(const std::string& name, const Color& color) {
-    glUniform4f(getUniformLocation(name), color.r, color.g, color.b, color.a);
+    set(uniform(name.c_str()), color);
+}
+
+// ============================================================================
+// uniform 句柄
+// ============================================================================
+
+// 所有 GLShader 共用的构建代数，句柄用在其它程序或重建后的程序上都能识别
+static std::atomic<uint32_t> s_uniformGeneration{0};
+
+/**
+ * @brief 查找uniform句柄
+ * @param name uniform变量名
+ * @return uniform句柄，不存在时返回 INVALID_UNIFORM
+ *
+ * 句柄在程序重新编译前保持有效，调用方应在初始化时查找并保存
+ */
+UniformId GLShader::uniform(const char* name) {
+    std::string_view key(name);
+    auto it = uniformCache_.find(key);
+    if (it != uniformCache_.end()) {
+        return it->second;
+    }
+
+    UniformId id = INVALID_UNIFORM;
+    GLint location =
+        programID_ != 0 ? glGetUniformLocation(programID_, name) : -1;
+    if (location >= 0 && uniforms_.size() <= UNIFORM_INDEX_MASK) {
+        id = static_cast<UniformId>((generation_ << UNIFORM_INDEX_BITS) |
+                                    static_cast<uint32_t>(uniforms_.size()));
+        UniformSlot slot;
+        slot.location = location;
+        uniforms_.push_back(slot);
+    }
+    uniformCache_.emplace(uniformNames_.emplace_back(key), id);
+    return id;
+}
+
+/**
+ * @brief 比较并更新影子副本
+ * @param id uniform句柄
+ * @param data 新值
+ * @param size 字节数
+ * @return 需要上传返回对应槽位，值未变化或句柄无效返回nullptr
+ */
+const GLShader::UniformSlot* GLShader::updateShadow(UniformId id, const void* data,
+                                                    uint32_t size) {
+    if (id < 0) {
+        return nullptr;
+    }
+    uint32_t bits = static_cast<uint32_t>(id);
+    size_t index = bits & UNIFORM_INDEX_MASK;
+    if ((bits >> UNIFORM_INDEX_BITS) != generation_ || index >= uniforms_.size()) {
+#ifdef E2D_DEBUG
+        E2D_LOG_ERROR("Stale uniform handle {} used on shader '{}' "
+                      "(recompiled or from another shader)", id, name_);
+#endif
+        return nullptr;
+    }
+    UniformSlot& slot = uniforms_[index];
+    if (slot.size == size && std::memcmp(slot.shadow.data(), data, size) == 0) {
+        return nullptr;
+    }
+    std::memcpy(slot.shadow.data(), data, size);
+    slot.size = size;
+    return &slot;
+}
+
+/**
+ * @brief 程序重建后清空所有句柄，并取得新的构建代数
+ *
+ * 代数在 15 位内循环且跳过 0，旧句柄因代数不符被 updateShadow 拒绝
+ */
+void GLShader::resetUniforms() {
+    uniformCache_.clear();
+    uniformNames_.clear();
+    uniforms_.clear();
+    uint32_t generation = 0;
+    while (generation == 0) {
+        generation = s_uniformGeneration.fetch_add(1, std::memory_order_relaxed) &
+                     UNIFORM_GENERATION_MASK;
+    }
+    generation_ = generation;
+}
+
+/**
+ * @brief 按句柄设置uniform变量
+ * @param id uniform句柄
+ * @param value 整数值
+ */
+void GLShader::set(UniformId id, int value) {
+    if (const UniformSlot* slot = updateShadow(id, &value, sizeof(value))) {
+        glProgramUniform1i(programID_, slot->location, value);
+    }
+}
+
+/**
+ * @brief 按句柄设置uniform变量
+ * @param id uniform句柄
+ * @param value 浮点值
+ */
+void GLShader::set(UniformId id, float value) {
+    if (const UniformSlot* slot = updateShadow(id, &value, sizeof(value))) {
+        glProgramUniform1f(programID_, slot->location, value);
+    }
+}
+
+/**
+ * @brief 按句柄设置uniform变量
+ * @param id uniform句柄
+ * @param value 二维向量值
+ */
+void GLShader::set(UniformId id, const glm::vec2& value) {
+    if (const UniformSlot* slot = updateShadow(id, &value, sizeof(value))) {
+        glProgramUniform2fv(programID_, slot->location, 1, &value[0]);
+    }
+}
+
+/**
+ * @brief 按句柄设置uniform变量
+ * @param id uniform句柄
+ * @param value 三维向量值
+ */
+void GLShader::set(UniformId id, const glm::vec3& value) {
+    if (const UniformSlot* slot = updateShadow(id, &value, sizeof(value))) {
+        glProgramUniform3fv(programID_, slot->location, 1, &value[0]);
+    }
+}
+
+/**
+ * @brief 按句柄设置uniform变量
+ * @param id uniform句柄
+ * @param value 四维向量值
+ */
+void GLShader::set(UniformId id, const glm::vec4& value) {
+    if (const UniformSlot* slot = updateShadow(id, &value, sizeof(value))) {
+        glProgramUniform4fv(programID_, slot->location, 1, &value[0]);
+    }
+}
+
+/**
+ * @brief 按句柄设置uniform变量
+ * @param id uniform句柄
+ * @param value 4x4矩阵值
+ */
+void GLShader::set(UniformId id, const glm::mat4& value) {
+    if (const UniformSlot* slot = updateShadow(id, &value, sizeof(value))) {
+        glProgramUniformMatrix4fv(programID_, slot->location, 1, GL_FALSE,
+                                  &value[0][0]);
+    }
+}
+
+/**
+ * @brief 按句柄设置颜色uniform变量
+ * @param id uniform句柄
+ * @param color 颜色值
+ */
+void GLShader::set(UniformId id, const Color& color) {
+    set(id, glm::vec4(color.r, color.g, color.b, color.a));
 }
 
 /**
@@ -112,6 +282,14 @@ void GLShader::setColor(const std::string& name, const Color& color) {
  * @return 编译成功返回true，失败返回false
  */
 bool GLShader::compileFromSource(const char* vertexSource, const char* fragmentSource) {
+    // 热重载等路径可能在非上下文线程调用，转到上下文所属线程编译
+    if (!GPUContext::get().isOwnerThread()) {
+        bool result = false;
+        GPUContext::get().runOnOwner(
+            [&] { result = compileFromSource(vertexSource, fragmentSource); });
+        return result;
+    }
+
     GLuint vertexShader = compileShader(GL_VERTEX_SHADER, vertexSource);
     if (vertexShader == 0) {
         return false;
@@ -124,9 +302,10 @@ bool GLShader::compileFromSource(const char* vertexSource, const char* fragmentS
     }
 
     if (programID_ != 0) {
+        GLStateCache::get().onProgramDeleted(programID_);
         glDeleteProgram(programID_);
-        uniformCache_.clear();
     }
+    resetUniforms();
 
     programID_ = glCreateProgram();
     glAttachShader(programID_, vertexShader);
@@ -139,8 +318,12 @@ bool GLShader::compileFromSource(const char* vertexSource, const char* fragmentS
         char infoLog[512];
         glGetProgramInfoLog(programID_, 512, nullptr, infoLog);
         E2D_LOG_ERROR("Shader program linking failed: {}", infoLog);
+        GLStateCache::get().onProgramDeleted(programID_);
         glDeleteProgram(programID_);
         programID_ = 0;
+    } else {
+        // 声明了帧常量块的着色器共享同一 uniform 缓冲
+        GLFrameConstants::bindProgram(programID_);
     }
 
     glDeleteShader(vertexShader);
@@ -159,6 +342,11 @@ bool GLShader::compileFromBinary(const std::vector<uint8_t>& binary) {
         E2D_LOG_ERROR("Binary data is empty");
         return false;
     }
+    if (!GPUContext::get().isOwnerThread()) {
+        bool result = false;
+        GPUContext::get().runOnOwner([&] { result = compileFromBinary(binary); });
+        return result;
+    }
 
     GLint numFormats = 0;
     glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &numFormats);
@@ -168,9 +356,10 @@ bool GLShader::compileFromBinary(const std::vector<uint8_t>& binary) {
     }
 
     if (programID_ != 0) {
+        GLStateCache::get().onProgramDeleted(programID_);
         glDeleteProgram(programID_);
-        uniformCache_.clear();
     }
+    resetUniforms();
 
     programID_ = glCreateProgram();
 
@@ -185,11 +374,13 @@ bool GLShader::compileFromBinary(const std::vector<uint8_t>& binary) {
         char infoLog[512];
         glGetProgramInfoLog(programID_, 512, nullptr, infoLog);
         E2D_LOG_ERROR("Failed to load shader from binary: {}", infoLog);
+        GLStateCache::get().onProgramDeleted(programID_);
         glDeleteProgram(programID_);
         programID_ = 0;
         return false;
     }
 
+    GLFrameConstants::bindProgram(programID_);
     return true;
 }
 
@@ -203,6 +394,11 @@ bool GLShader::getBinary(std::vector<uint8_t>& outBinary) {
         E2D_LOG_WARN("Cannot get binary: shader program is 0");
         return false;
     }
+    if (!GPUContext::get().isOwnerThread()) {
+        bool result = false;
+        GPUContext::get().runOnOwner([&] { result = getBinary(outBinary); });
+        return result;
+    }
 
     GLint binaryLength = 0;
     glGetProgramiv(programID_, GL_PROGRAM_BINARY_LENGTH, &binaryLength);
@@ -265,22 +461,6 @@ GLuint GLShader::compileShader(GLenum type, const char* source) {
     return shader;
 }
 
-/**
- * @brief 获取uniform位置
- * @param name uniform变量名
- * @return uniform位置
- */
-GLint GLShader::getUniformLocation(const std::string& name) {
-    auto it = uniformCache_.find(name);
-    if (it != uniformCache_.end()) {
-        return it->second;
-    }
-
-    GLint location = glGetUniformLocation(programID_, name.c_str());
-    uniformCache_[name] = location;
-    return location;
-}
-
 // ============================================================================
 // GLShaderFactory 实现
 // ============================================================================
@@ -1,142 +1,335 @@
+#include <algorithm>
 #include <cstring>
+#include <extra2d/graphics/opengl/gl_frame_constants.h>
 #include <extra2d/graphics/opengl/gl_sprite_batch.h>
+#include <extra2d/graphics/opengl/gl_sprite_kernel.h>
+#include <extra2d/graphics/opengl/gl_state_cache.h>
 #include <extra2d/utils/logger.h>
+#include <extra2d/utils/thread_pool.h>
 #include <glm/gtc/matrix_transform.hpp>
+#include <string>
 
 namespace extra2d {
 
+// 索引生成函数
+/**
+ * @brief 生成 16 位四边形索引
+ * @param spriteCount 精灵数量（不超过 MAX_SPRITES_PER_DRAW）
+ * @return 索引数组
+ */
+static std::vector<uint16_t> buildIndices(size_t spriteCount) {
+  std::vector<uint16_t> indices(spriteCount * GLSpriteBatch::INDICES_PER_SPRITE);
+  for (size_t i = 0; i < spriteCount; ++i) {
+    uint16_t base =
+        static_cast<uint16_t>(i * GLSpriteBatch::VERTICES_PER_SPRITE);
+    uint16_t *dst = &indices[i * GLSpriteBatch::INDICES_PER_SPRITE];
+    dst[0] = base + 0;
+    dst[1] = base + 1;
+    dst[2] = base + 2;
+    dst[3] = base + 0;
+    dst[4] = base + 2;
+    dst[5] = base + 3;
+  }
+  return indices;
+}
+
 // ============================================================================
-// 三角函数查表 - 避免每帧重复计算 sin/cos
+// 顶点写入 - 标准格式与紧凑格式
 // ============================================================================
+// 批量路径每次交给 SIMD 内核处理的精灵数
+static constexpr size_t KERNEL_CHUNK = 64;
+
 /**
- * @brief 三角函数查表类，避免每帧重复计算sin/cos
- */
-class TrigLookup {
-public:
-  static constexpr size_t TABLE_SIZE = 360 * 4;  // 0.25度精度
-  static constexpr float INDEX_SCALE = 4.0f;      // 每度4个采样点
-  static constexpr float RAD_TO_INDEX = INDEX_SCALE * 180.0f / 3.14159265359f;
-  
-  /**
-   * @brief 查表获取sin值
-   * @param radians 弧度值
-   * @return sin值
-   */
-  static float sinRad(float radians) {
-    return table_.sinTable[normalizeIndexRad(radians)];
-  }
-  
-  /**
-   * @brief 查表获取cos值
-   * @param radians 弧度值
-   * @return cos值
-   */
-  static float cosRad(float radians) {
-    return table_.cosTable[normalizeIndexRad(radians)];
-  }
-  
-private:
-  struct Tables {
-    std::array<float, TABLE_SIZE> sinTable;
-    std::array<float, TABLE_SIZE> cosTable;
-    
-    Tables() {
-      for (size_t i = 0; i < TABLE_SIZE; ++i) {
-        float angle = static_cast<float>(i) / INDEX_SCALE * 3.14159265359f / 180.0f;
-        sinTable[i] = std::sin(angle);
-        cosTable[i] = std::cos(angle);
-      }
-    }
-  };
-  
-  static size_t normalizeIndexRad(float radians) {
-    int idx = static_cast<int>(radians * RAD_TO_INDEX) % static_cast<int>(TABLE_SIZE);
-    if (idx < 0) {
-      idx += static_cast<int>(TABLE_SIZE);
-    }
-    return static_cast<size_t>(idx);
-  }
-  
-  static const Tables table_;
-};
-
-const TrigLookup::Tables TrigLookup::table_;
-
-// 静态索引生成函数
-/**
- * @brief 获取静态索引数组，用于精灵绘制
- * @return 索引数组的常量引用
- */
-static const std::array<GLuint, GLSpriteBatch::MAX_INDICES>& getIndices() {
-  static std::array<GLuint, GLSpriteBatch::MAX_INDICES> indices = []() {
-    std::array<GLuint, GLSpriteBatch::MAX_INDICES> arr{};
-    for (size_t i = 0; i < GLSpriteBatch::MAX_SPRITES; ++i) {
-      GLuint base = static_cast<GLuint>(i * GLSpriteBatch::VERTICES_PER_SPRITE);
-      arr[i * GLSpriteBatch::INDICES_PER_SPRITE + 0] = base + 0;
-      arr[i * GLSpriteBatch::INDICES_PER_SPRITE + 1] = base + 1;
-      arr[i * GLSpriteBatch::INDICES_PER_SPRITE + 2] = base + 2;
-      arr[i * GLSpriteBatch::INDICES_PER_SPRITE + 3] = base + 0;
-      arr[i * GLSpriteBatch::INDICES_PER_SPRITE + 4] = base + 2;
-      arr[i * GLSpriteBatch::INDICES_PER_SPRITE + 5] = base + 3;
-    }
-    return arr;
-  }();
-  return indices;
+ * @brief 将 [0, 1] 浮点量化为 unorm16
+ *
+ * 超出范围的值被截断，紧凑格式与实例化模式因此不支持平铺 UV
+ *（见 SpriteBatchConfig::compactVertices）
+ */
+static inline uint16_t toUnorm16(float value) {
+  value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+  return static_cast<uint16_t>(value * 65535.0f + 0.5f);
 }
 
-// 顶点着色器 (GLES 3.2)
+/**
+ * @brief 将 [0, 1] 浮点量化为 unorm8
+ */
+static inline uint8_t toUnorm8(float value) {
+  value = value < 0.0f ? 0.0f : (value > 1.0f ? 1.0f : value);
+  return static_cast<uint8_t>(value * 255.0f + 0.5f);
+}
+
+/**
+ * @brief 写入标准格式的四个顶点
+ * @tparam Data SpriteData 或 AffineSpriteData（只读取纹理坐标与颜色）
+ */
+template <typename Data>
+static inline void writeQuad(GLSpriteBatch::Vertex *dst,
+                             const SpriteCorners &q, const Data &data,
+                             uint32_t slot) {
+  const float u[4] = {data.texCoordMin.x, data.texCoordMax.x,
+                      data.texCoordMax.x, data.texCoordMin.x};
+  const float v[4] = {data.texCoordMin.y, data.texCoordMin.y,
+                      data.texCoordMax.y, data.texCoordMax.y};
+  float texSlot = static_cast<float>(slot);
+  for (int i = 0; i < 4; ++i) {
+    dst[i].position = glm::vec2(q.x[i], q.y[i]);
+    dst[i].texCoord = glm::vec2(u[i], v[i]);
+    dst[i].color = data.color;
+    dst[i].texSlot = texSlot;
+  }
+}
+
+/**
+ * @brief 写入紧凑格式的四个顶点
+ * @tparam Data SpriteData 或 AffineSpriteData（只读取纹理坐标与颜色）
+ */
+template <typename Data>
+static inline void writeQuad(GLSpriteBatch::CompactVertex *dst,
+                             const SpriteCorners &q, const Data &data,
+                             uint32_t slot) {
+  const uint16_t u0 = toUnorm16(data.texCoordMin.x);
+  const uint16_t u1 = toUnorm16(data.texCoordMax.x);
+  const uint16_t v0 = toUnorm16(data.texCoordMin.y);
+  const uint16_t v1 = toUnorm16(data.texCoordMax.y);
+  const uint16_t u[4] = {u0, u1, u1, u0};
+  const uint16_t v[4] = {v0, v0, v1, v1};
+  uint8_t rgba[4] = {toUnorm8(data.color.r), toUnorm8(data.color.g),
+                     toUnorm8(data.color.b), toUnorm8(data.color.a)};
+  for (int i = 0; i < 4; ++i) {
+    dst[i].position = glm::vec2(q.x[i], q.y[i]);
+    dst[i].texCoord[0] = u[i];
+    dst[i].texCoord[1] = v[i];
+    std::memcpy(dst[i].color, rgba, sizeof(rgba));
+    dst[i].texSlot = static_cast<uint8_t>(slot);
+    dst[i].padding[0] = dst[i].padding[1] = dst[i].padding[2] = 0;
+  }
+}
+
+/**
+ * @brief 仿射精灵的四个角点：局部四边形直接经 2x3 矩阵变换
+ */
+static inline void affineCorners(const GLSpriteBatch::AffineSpriteData &data,
+                                 SpriteCorners &q) {
+  const Affine2D &m = data.transform;
+  float x0 = -data.size.x * data.anchor.x;
+  float y0 = -data.size.y * data.anchor.y;
+  float x1 = x0 + data.size.x;
+  float y1 = y0 + data.size.y;
+  const float lx[4] = {x0, x1, x1, x0};
+  const float ly[4] = {y0, y0, y1, y1};
+  for (int i = 0; i < 4; ++i) {
+    q.x[i] = m.a * lx[i] + m.c * ly[i] + m.tx;
+    q.y[i] = m.b * lx[i] + m.d * ly[i] + m.ty;
+  }
+}
+
+/**
+ * @brief 写入实例记录中与几何无关的部分
+ */
+template <typename Data>
+static inline void writeInstanceAttributes(GLSpriteBatch::InstanceData &inst,
+                                           const Data &data, uint32_t slot) {
+  inst.texRect[0] = toUnorm16(data.texCoordMin.x);
+  inst.texRect[1] = toUnorm16(data.texCoordMin.y);
+  inst.texRect[2] = toUnorm16(data.texCoordMax.x);
+  inst.texRect[3] = toUnorm16(data.texCoordMax.y);
+  inst.color[0] = toUnorm8(data.color.r);
+  inst.color[1] = toUnorm8(data.color.g);
+  inst.color[2] = toUnorm8(data.color.b);
+  inst.color[3] = toUnorm8(data.color.a);
+  inst.texSlot = static_cast<uint8_t>(slot);
+  inst.padding[0] = inst.padding[1] = inst.padding[2] = 0;
+}
+
+/**
+ * @brief 写入实例化模式的实例记录（旋转精灵）
+ */
+static inline void writeInstance(GLSpriteBatch::InstanceData &inst,
+                                 const GLSpriteBatch::SpriteData &data,
+                                 uint32_t slot) {
+  float s = 0.0f;
+  float c = 1.0f;
+  if (data.rotation != 0.0f) {
+    fastSinCos(data.rotation, s, c);
+  }
+  glm::vec2 axisX(c * data.size.x, s * data.size.x);
+  glm::vec2 axisY(-s * data.size.y, c * data.size.y);
+  inst.origin = data.position - axisX * data.anchor.x - axisY * data.anchor.y;
+  inst.axisX = axisX;
+  inst.axisY = axisY;
+  writeInstanceAttributes(inst, data, slot);
+}
+
+/**
+ * @brief 写入实例化模式的实例记录（仿射精灵）
+ */
+static inline void writeInstance(GLSpriteBatch::InstanceData &inst,
+                                 const GLSpriteBatch::AffineSpriteData &data,
+                                 uint32_t slot) {
+  const Affine2D &m = data.transform;
+  glm::vec2 axisX(m.a * data.size.x, m.b * data.size.x);
+  glm::vec2 axisY(m.c * data.size.y, m.d * data.size.y);
+  inst.origin = glm::vec2(m.tx, m.ty) - axisX * data.anchor.x -
+                axisY * data.anchor.y;
+  inst.axisX = axisX;
+  inst.axisY = axisY;
+  writeInstanceAttributes(inst, data, slot);
+}
+
+// 顶点着色器 (GLES 3.2)，视图投影来自 FrameConstants 块
+// SDF 形状属性（location 4/5）只在含 SDF 形状的批次启用，其余情况下不被使用
 static const char *SPRITE_VERTEX_SHADER = R"(
-#version 300 es
 precision highp float;
 layout(location = 0) in vec2 aPosition;
 layout(location = 1) in vec2 aTexCoord;
 layout(location = 2) in vec4 aColor;
-
-uniform mat4 uViewProjection;
+layout(location = 3) in float aTexSlot;
+layout(location = 4) in vec2 aShapeLocal;
+layout(location = 5) in vec4 aShapeParams;
 
 out vec2 vTexCoord;
 out vec4 vColor;
+flat out int vTexSlot;
+out vec2 vShapeLocal;
+flat out vec4 vShapeParams;
 
 void main() {
-    gl_Position = uViewProjection * vec4(aPosition, 0.0, 1.0);
+    gl_Position = u_viewProjection * vec4(aPosition, 0.0, 1.0);
     vTexCoord = aTexCoord;
     vColor = aColor;
+    vTexSlot = int(aTexSlot + 0.5);
+    vShapeLocal = aShapeLocal;
+    vShapeParams = aShapeParams;
 }
 )";
 
-// 片段着色器 (GLES 3.2)
+// 实例化顶点着色器 (GLES 3.2)
+// 由 gl_VertexID 生成三角形带角点 (0,0) (1,0) (0,1) (1,1)，沿实例的两条边向量展开
+static const char *SPRITE_INSTANCED_VERTEX_SHADER = R"(
+precision highp float;
+layout(location = 0) in vec4 aOriginAxisX;
+layout(location = 1) in vec2 aAxisY;
+layout(location = 2) in vec4 aTexRect;
+layout(location = 3) in vec4 aColor;
+layout(location = 4) in float aTexSlot;
+
+out vec2 vTexCoord;
+out vec4 vColor;
+flat out int vTexSlot;
+
+void main() {
+    vec2 corner = vec2(float(gl_VertexID & 1), float(gl_VertexID >> 1));
+    vec2 world = aOriginAxisX.xy + aOriginAxisX.zw * corner.x + aAxisY * corner.y;
+    gl_Position = u_viewProjection * vec4(world, 0.0, 1.0);
+    vTexCoord = mix(aTexRect.xy, aTexRect.zw, corner);
+    vColor = aColor;
+    vTexSlot = int(aTexSlot + 0.5);
+}
+)";
+
+// 片段着色器 (GLES 3.2) - 头部，采样器数组大小由 TEXTURE_SLOTS 宏决定
 // SDF 常量硬编码：ONEDGE_VALUE=128/255=0.502, PIXEL_DIST_SCALE=255/64=3.98
 // SDF 值存储在 Alpha 通道
-static const char *SPRITE_FRAGMENT_SHADER = R"(
-#version 300 es
+static const char *SPRITE_FRAGMENT_SHADER_HEAD = R"(
 precision highp float;
 in vec2 vTexCoord;
 in vec4 vColor;
+flat in int vTexSlot;
 
-uniform sampler2D uTexture;
+uniform sampler2D uTextures[TEXTURE_SLOTS];
 uniform int uUseSDF;
 
 out vec4 fragColor;
+)";
 
+// SDF 形状的局部坐标与参数（仅在定义 SDF_SHAPES 时声明）
+static const char *SPRITE_FRAGMENT_SHADER_SDF_INPUTS = R"(
+in vec2 vShapeLocal;
+flat in vec4 vShapeParams;
+)";
+
+// 主体：SDF 形状槽位在整个图元上一致，fwidth 所在分支对 2x2 像素块是统一的
+static const char *SPRITE_FRAGMENT_SHADER_MAIN = R"(
 void main() {
+#ifdef SDF_SHAPES
+    if (vTexSlot >= SDF_SHAPE_SLOT && vTexSlot < WHITE_TEXEL_SLOT) {
+        float alpha = sdfShapeCoverage(vShapeLocal, vShapeParams,
+                                       vTexSlot - SDF_SHAPE_SLOT);
+        fragColor = vec4(vColor.rgb, vColor.a * alpha);
+        return;
+    }
+#endif
+    vec4 texel = vTexSlot == WHITE_TEXEL_SLOT ? vec4(1.0) : sampleSlot(vTexCoord);
     if (uUseSDF == 1) {
-        float dist = texture(uTexture, vTexCoord).a;
-        float sd = (dist - 0.502) * 3.98;
+        float sd = (texel.a - 0.502) * 3.98;
         float w = fwidth(sd);
         float alpha = smoothstep(-w, w, sd);
         fragColor = vec4(vColor.rgb, vColor.a * alpha);
     } else {
-        fragColor = texture(uTexture, vTexCoord) * vColor;
+        fragColor = texel * vColor;
     }
 }
 )";
 
+/**
+ * @brief 为顶点着色器主体补上版本声明与帧常量块
+ * @param body 着色器主体
+ * @return 着色器源码
+ */
+static std::string buildVertexShader(const char *body) {
+  std::string src = "#version 300 es\n";
+  src += GLFrameConstants::GLSL_BLOCK;
+  src += body;
+  return src;
+}
+
+/**
+ * @brief 生成支持指定纹理槽位数的片段着色器
+ * @param slots 纹理槽位数
+ * @param sdfShapes 是否包含 SDF 形状分支
+ * @return 着色器源码
+ *
+ * GLSL ES 3.00 只允许以常量下标访问采样器数组，因此按槽位展开分支
+ */
+static std::string buildFragmentShader(size_t slots, bool sdfShapes) {
+  std::string src = "#version 300 es\n#define TEXTURE_SLOTS " +
+                    std::to_string(slots) + "\n#define WHITE_TEXEL_SLOT " +
+                    std::to_string(GLSpriteBatch::WHITE_TEXEL_SLOT) + "\n";
+  if (sdfShapes) {
+    src += "#define SDF_SHAPES\n#define SDF_SHAPE_SLOT " +
+           std::to_string(GLSpriteBatch::SDF_SHAPE_SLOT) + "\n";
+  }
+  src += SPRITE_FRAGMENT_SHADER_HEAD;
+  if (sdfShapes) {
+    src += SPRITE_FRAGMENT_SHADER_SDF_INPUTS;
+    src += GLSDFShapeBatch::GLSL_COVERAGE;
+  }
+  src += "vec4 sampleSlot(vec2 uv) {\n";
+  for (size_t i = 1; i < slots; ++i) {
+    std::string idx = std::to_string(i);
+    src += "    if (vTexSlot == " + idx + ") return texture(uTextures[" + idx +
+           "], uv);\n";
+  }
+  src += "    return texture(uTextures[0], uv);\n}\n";
+  src += SPRITE_FRAGMENT_SHADER_MAIN;
+  return src;
+}
+
 /**
  * @brief 构造函数，初始化精灵批处理器成员变量
  */
 GLSpriteBatch::GLSpriteBatch()
-    : vao_(0), vbo_(0), ibo_(0), vertexCount_(0), currentTexture_(nullptr),
-      currentIsSDF_(false), drawCallCount_(0), spriteCount_(0), batchCount_(0) {
+    : vao_(0), ibo_(0), vertexPtr_(nullptr), vertexCount_(0),
+      vertexStride_(sizeof(Vertex)),
+      bytesPerSprite_(sizeof(Vertex) * VERTICES_PER_SPRITE),
+      maxSprites_(MAX_SPRITES),
+      maxVertices_(MAX_SPRITES * VERTICES_PER_SPRITE), compact_(false),
+      instanced_(false), parallelThreshold_(0), shapePtr_(nullptr),
+      sdfShapes_(false), attribsOffset_(false), slotCount_(0),
+      textureSlots_(1), currentSlot_(0), lastTexture_(nullptr),
+      currentIsSDF_(false), drawCallCount_(0), spriteCount_(0), batchCount_(0),
+      flushesAvoided_(0), flushCount_(0) {
+  slotTextures_.fill(nullptr);
 }
 
 /**
@@ -145,52 +338,114 @@ GLSpriteBatch::GLSpriteBatch()
 GLSpriteBatch::~GLSpriteBatch() { shutdown(); }
 
 /**
- * @brief 初始化精灵批处理器，创建VAO、VBO、IBO和编译着色器
+ * @brief 使用默认配置初始化精灵批处理器
+ * @return 初始化成功返回true，失败返回false
+ */
+bool GLSpriteBatch::init() { return init(SpriteBatchConfig{}); }
+
+/**
+ * @brief 初始化精灵批处理器，创建VAO、顶点流缓冲区、IBO和编译着色器
+ * @param config 批处理器配置
  * @return 初始化成功返回true，失败返回false
  */
-bool GLSpriteBatch::init() {
+bool GLSpriteBatch::init(const SpriteBatchConfig &config) {
+  // 纹理槽位数受硬件纹理单元数限制
+  GLint maxUnits = 1;
+  glGetIntegerv(GL_MAX_TEXTURE_IMAGE_UNITS, &maxUnits);
+  textureSlots_ = std::max<size_t>(config.textureSlots, 1);
+  textureSlots_ = std::min(textureSlots_, MAX_TEXTURE_SLOTS);
+  textureSlots_ = std::min(textureSlots_, static_cast<size_t>(std::max(maxUnits, 1)));
+
+  instanced_ = config.instanced;
+  sdfShapes_ = config.batchShapes && config.sdfShapes && !instanced_;
+
   // 创建并编译着色器
-  if (!shader_.compileFromSource(SPRITE_VERTEX_SHADER,
-                                 SPRITE_FRAGMENT_SHADER)) {
+  std::string fragmentSource = buildFragmentShader(textureSlots_, sdfShapes_);
+  std::string vertexSource = buildVertexShader(
+      instanced_ ? SPRITE_INSTANCED_VERTEX_SHADER : SPRITE_VERTEX_SHADER);
+  if (!shader_.compileFromSource(vertexSource.c_str(),
+                                 fragmentSource.c_str())) {
     E2D_LOG_ERROR("Failed to compile sprite batch shader");
     return false;
   }
 
-  // 生成 VAO、VBO、IBO
+  // 采样器数组依次绑定到纹理单元 0..N-1；逐帧设置的 uniform 预先取得句柄
+  for (size_t i = 0; i < textureSlots_; ++i) {
+    std::string name = "uTextures[" + std::to_string(i) + "]";
+    shader_.set(shader_.uniform(name.c_str()), static_cast<int>(i));
+  }
+  useSDFUniform_ = shader_.uniform("uUseSDF");
+
+  // 生成 VAO、IBO
   glGenVertexArrays(1, &vao_);
-  glGenBuffers(1, &vbo_);
   glGenBuffers(1, &ibo_);
 
-  glBindVertexArray(vao_);
+  GLStateCache::get().bindVertexArray(vao_);
 
-  // 设置 VBO - 使用动态绘制模式
-  glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-  glBufferData(GL_ARRAY_BUFFER, MAX_VERTICES * sizeof(Vertex), nullptr,
-               GL_DYNAMIC_DRAW);
+  maxSprites_ = std::max<size_t>(config.maxSprites, 1);
+  maxVertices_ = maxSprites_ * VERTICES_PER_SPRITE;
+  // drawBatch 每次最多写入一个批次的剩余容量，阈值高于容量时并行路径永远不会触发
+  parallelThreshold_ = std::min(config.parallelThreshold, maxSprites_);
+  compact_ = config.compactVertices;
+  if (instanced_) {
+    vertexStride_ = sizeof(InstanceData);
+    bytesPerSprite_ = sizeof(InstanceData);
+  } else {
+    vertexStride_ = compact_ ? sizeof(CompactVertex) : sizeof(Vertex);
+    bytesPerSprite_ = vertexStride_ * VERTICES_PER_SPRITE;
+  }
+
+  // 创建顶点流缓冲区，属性指针绑定到该缓冲区
+  if (!vertexStream_.init(GL_ARRAY_BUFFER, maxSprites_ * bytesPerSprite_,
+                          config.streamMode)) {
+    E2D_LOG_ERROR("Failed to create sprite batch vertex stream");
+    GLStateCache::get().bindVertexArray(0);
+    return false;
+  }
+  GLStateCache::get().bindBuffer(GL_ARRAY_BUFFER, vertexStream_.getBuffer());
+
+  if (instanced_) {
+    // 实例属性每个实例前进一次，偏移在每次刷新时重新指定
+    for (GLuint loc = 0; loc <= 4; ++loc) {
+      glEnableVertexAttribArray(loc);
+      glVertexAttribDivisor(loc, 1);
+    }
+    bindInstanceAttributes(0);
+    GLStateCache::get().bindVertexArray(0);
+
+    E2D_LOG_INFO("GLSpriteBatch initialized with capacity for {} sprites "
+                 "(instanced, {}-byte instances, {} texture slots)",
+                 maxSprites_, sizeof(InstanceData), textureSlots_);
+    return true;
+  }
 
   // 设置顶点属性
-  glEnableVertexAttribArray(0);
-  glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-                        (void *)offsetof(Vertex, position));
-
-  glEnableVertexAttribArray(1);
-  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-                        (void *)offsetof(Vertex, texCoord));
-
-  glEnableVertexAttribArray(2);
-  glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, sizeof(Vertex),
-                        (void *)offsetof(Vertex, color));
-
-  // 使用编译期生成的静态索引缓冲区
-  const auto& indices = getIndices();
-  glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_);
-  glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint),
+  for (GLuint loc = 0; loc <= 3; ++loc) {
+    glEnableVertexAttribArray(loc);
+  }
+  bindVertexAttributes(0);
+
+  // SDF 形状属性流与顶点流按相同顶点序号对应，容量按顶点数计算
+  if (sdfShapes_ &&
+      !shapeStream_.init(GL_ARRAY_BUFFER, maxVertices_ * sizeof(ShapeVertex),
+                         config.streamMode)) {
+    E2D_LOG_WARN("Failed to create sprite batch shape stream, "
+                 "SDF shapes use a separate batch");
+    sdfShapes_ = false;
+  }
+
+  // 16 位索引缓冲区，最多覆盖一个子批次
+  auto indices =
+      buildIndices(std::min(maxSprites_, MAX_SPRITES_PER_DRAW));
+  GLStateCache::get().bindBuffer(GL_ELEMENT_ARRAY_BUFFER, ibo_);
+  glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(uint16_t),
                indices.data(), GL_STATIC_DRAW);
 
-  glBindVertexArray(0);
+  GLStateCache::get().bindVertexArray(0);
 
-  E2D_LOG_INFO("GLSpriteBatch initialized with capacity for {} sprites",
-               MAX_SPRITES);
+  E2D_LOG_INFO("GLSpriteBatch initialized with capacity for {} sprites "
+               "({}-byte vertices, {} texture slots)",
+               maxSprites_, vertexStride_, textureSlots_);
   return true;
 }
 
@@ -198,15 +453,21 @@ bool GLSpriteBatch::init() {
  * @brief 关闭精灵批处理器，释放OpenGL资源
  */
 void GLSpriteBatch::shutdown() {
+  vertexStream_.shutdown();
+  vertexPtr_ = nullptr;
+  vertexCount_ = 0;
+  shapeStream_.shutdown();
+  shapePtr_ = nullptr;
+  sdfShapes_ = false;
+  attribsOffset_ = false;
+
   if (vao_ != 0) {
+    GLStateCache::get().onVertexArrayDeleted(vao_);
     glDeleteVertexArrays(1, &vao_);
     vao_ = 0;
   }
-  if (vbo_ != 0) {
-    glDeleteBuffers(1, &vbo_);
-    vbo_ = 0;
-  }
   if (ibo_ != 0) {
+    GLStateCache::get().onBufferDeleted(ibo_);
     glDeleteBuffers(1, &ibo_);
     ibo_ = 0;
   }
@@ -214,16 +475,20 @@ void GLSpriteBatch::shutdown() {
 
 /**
  * @brief 开始批处理，重置状态并设置视图投影矩阵
- * @param viewProjection 视图投影矩阵
+ * @param viewProjection 视图投影矩阵（写入共享帧常量块）
  */
 void GLSpriteBatch::begin(const glm::mat4 &viewProjection) {
-  viewProjection_ = viewProjection;
+  GLFrameConstants::get().setViewProjection(viewProjection);
   vertexCount_ = 0;
-  currentTexture_ = nullptr;
+  slotCount_ = 0;
+  currentSlot_ = 0;
+  lastTexture_ = nullptr;
   currentIsSDF_ = false;
   drawCallCount_ = 0;
   spriteCount_ = 0;
   batchCount_ = 0;
+  flushesAvoided_ = 0;
+  flushCount_ = 0;
 }
 
 /**
@@ -233,69 +498,223 @@ void GLSpriteBatch::begin(const glm::mat4 &viewProjection) {
  * @return 需要刷新返回true，否则返回false
  */
 bool GLSpriteBatch::needsFlush(const Texture &texture, bool isSDF) const {
-  if (currentTexture_ == nullptr) {
+  if (slotCount_ == 0) {
     return false;
   }
 
-  // 检查是否需要刷新：纹理改变、SDF 状态改变或缓冲区已满
-  return (currentTexture_ != &texture) || (currentIsSDF_ != isSDF) ||
-         (vertexCount_ + VERTICES_PER_SPRITE > MAX_VERTICES);
+  // 检查是否需要刷新：纹理槽位用尽、SDF 状态改变或缓冲区已满
+  bool slotsFull = findSlot(texture) < 0 && slotCount_ >= textureSlots_;
+  return slotsFull || (currentIsSDF_ != isSDF) ||
+         (vertexCount_ + VERTICES_PER_SPRITE > maxVertices_);
 }
 
 /**
- * @brief 添加精灵顶点到顶点缓冲区
- * @param data 精灵数据
+ * @brief 查找纹理已占用的槽位
+ * @param texture 纹理引用
+ * @return 槽位索引，未找到返回-1
  */
-void GLSpriteBatch::addVertices(const SpriteData &data) {
-  // 计算锚点偏移
-  float anchorOffsetX = data.size.x * data.anchor.x;
-  float anchorOffsetY = data.size.y * data.anchor.y;
-
-  // 使用三角函数查表替代 cosf/sinf
-  float cosR = TrigLookup::cosRad(data.rotation);
-  float sinR = TrigLookup::sinRad(data.rotation);
-
-  glm::vec4 color(data.color.r, data.color.g, data.color.b, data.color.a);
-
-  // 直接计算变换后的位置
-  float rx0 = -anchorOffsetX;
-  float ry0 = -anchorOffsetY;
-  float rx1 = data.size.x - anchorOffsetX;
-  float ry1 = data.size.y - anchorOffsetY;
-  
-  // 预计算旋转后的偏移
-  float cosRx0 = rx0 * cosR, sinRx0 = rx0 * sinR;
-  float cosRx1 = rx1 * cosR, sinRx1 = rx1 * sinR;
-  float cosRy0 = ry0 * cosR, sinRy0 = ry0 * sinR;
-  float cosRy1 = ry1 * cosR, sinRy1 = ry1 * sinR;
-  
-  // v0: (0, 0) -> (rx0, ry0)
-  vertexBuffer_[vertexCount_++] = {
-    glm::vec2(data.position.x + cosRx0 - sinRy0, data.position.y + sinRx0 + cosRy0),
-    glm::vec2(data.texCoordMin.x, data.texCoordMin.y),
-    color
-  };
-  
-  // v1: (size.x, 0) -> (rx1, ry0)
-  vertexBuffer_[vertexCount_++] = {
-    glm::vec2(data.position.x + cosRx1 - sinRy0, data.position.y + sinRx1 + cosRy0),
-    glm::vec2(data.texCoordMax.x, data.texCoordMin.y),
-    color
+int GLSpriteBatch::findSlot(const Texture &texture) const {
+  for (size_t i = 0; i < slotCount_; ++i) {
+    if (slotTextures_[i] == &texture) {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+/**
+ * @brief 查找或分配纹理槽位
+ * @param texture 纹理引用
+ * @param isSDF 是否为SDF渲染
+ * @return 纹理所在槽位
+ *
+ * 纹理已在槽位中或仍有空闲槽位时不刷新；单纹理路径在此处必须刷新的情况
+ * 计入 flushesAvoided_
+ */
+uint32_t GLSpriteBatch::acquireSlot(const Texture &texture, bool isSDF) {
+  if (vertexCount_ > 0 && currentIsSDF_ != isSDF) {
+    flush();
+  }
+
+  int slot = findSlot(texture);
+  if (slot < 0) {
+    if (slotCount_ >= textureSlots_) {
+      flush();
+    }
+    slot = static_cast<int>(slotCount_);
+    slotTextures_[slotCount_++] = &texture;
+  }
+
+  if (vertexCount_ > 0 && lastTexture_ != &texture) {
+    flushesAvoided_++;
+  }
+
+  lastTexture_ = &texture;
+  currentIsSDF_ = isSDF;
+  currentSlot_ = static_cast<uint32_t>(slot);
+  return currentSlot_;
+}
+
+/**
+ * @brief 确保顶点写入指针有效
+ * @return 映射成功返回true
+ *
+ * 每次刷新后释放映射，下一次写入前再从流缓冲区预留整批容量
+ */
+bool GLSpriteBatch::mapVertices() {
+  if (vertexPtr_ != nullptr) {
+    return true;
+  }
+  vertexPtr_ = static_cast<uint8_t *>(
+      vertexStream_.map(maxSprites_ * bytesPerSprite_, vertexStride_));
+  return vertexPtr_ != nullptr;
+}
+
+/**
+ * @brief 将实例属性指向流缓冲区中的指定偏移
+ * @param offset 本批次实例数据的字节偏移
+ *
+ * GLES 3.2 没有 baseInstance，因此每次刷新重新设置属性指针
+ */
+void GLSpriteBatch::bindInstanceAttributes(size_t offset) {
+  GLsizei stride = static_cast<GLsizei>(sizeof(InstanceData));
+  auto at = [offset](size_t member) {
+    return reinterpret_cast<void *>(offset + member);
   };
-  
-  // v2: (size.x, size.y) -> (rx1, ry1)
-  vertexBuffer_[vertexCount_++] = {
-    glm::vec2(data.position.x + cosRx1 - sinRy1, data.position.y + sinRx1 + cosRy1),
-    glm::vec2(data.texCoordMax.x, data.texCoordMax.y),
-    color
+  GLStateCache::get().bindBuffer(GL_ARRAY_BUFFER, vertexStream_.getBuffer());
+  glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, stride,
+                        at(offsetof(InstanceData, origin)));
+  glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride,
+                        at(offsetof(InstanceData, axisY)));
+  glVertexAttribPointer(2, 4, GL_UNSIGNED_SHORT, GL_TRUE, stride,
+                        at(offsetof(InstanceData, texRect)));
+  glVertexAttribPointer(3, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride,
+                        at(offsetof(InstanceData, color)));
+  glVertexAttribPointer(4, 1, GL_UNSIGNED_BYTE, GL_FALSE, stride,
+                        at(offsetof(InstanceData, texSlot)));
+}
+
+/**
+ * @brief 将顶点属性指向流缓冲区中的指定偏移
+ * @param offset 顶点数据的字节偏移
+ *
+ * 通常保持在偏移 0 并以 baseVertex 定位批次；含 SDF 形状的批次两条流的
+ * 偏移不成比例，改为按偏移重新指定属性指针
+ */
+void GLSpriteBatch::bindVertexAttributes(size_t offset) {
+  GLsizei stride = static_cast<GLsizei>(vertexStride_);
+  auto at = [offset](size_t member) {
+    return reinterpret_cast<void *>(offset + member);
   };
-  
-  // v3: (0, size.y) -> (rx0, ry1)
-  vertexBuffer_[vertexCount_++] = {
-    glm::vec2(data.position.x + cosRx0 - sinRy1, data.position.y + sinRx0 + cosRy1),
-    glm::vec2(data.texCoordMin.x, data.texCoordMax.y),
-    color
+  GLStateCache::get().bindBuffer(GL_ARRAY_BUFFER, vertexStream_.getBuffer());
+  if (compact_) {
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride,
+                          at(offsetof(CompactVertex, position)));
+    glVertexAttribPointer(1, 2, GL_UNSIGNED_SHORT, GL_TRUE, stride,
+                          at(offsetof(CompactVertex, texCoord)));
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, stride,
+                          at(offsetof(CompactVertex, color)));
+    glVertexAttribPointer(3, 1, GL_UNSIGNED_BYTE, GL_FALSE, stride,
+                          at(offsetof(CompactVertex, texSlot)));
+  } else {
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, stride,
+                          at(offsetof(Vertex, position)));
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, stride,
+                          at(offsetof(Vertex, texCoord)));
+    glVertexAttribPointer(2, 4, GL_FLOAT, GL_FALSE, stride,
+                          at(offsetof(Vertex, color)));
+    glVertexAttribPointer(3, 1, GL_FLOAT, GL_FALSE, stride,
+                          at(offsetof(Vertex, texSlot)));
+  }
+}
+
+/**
+ * @brief 将 SDF 形状属性指向形状流中的指定偏移
+ * @param offset 形状数据的字节偏移
+ * @param enable 为 false 时禁用属性（批次不含 SDF 形状）
+ */
+void GLSpriteBatch::bindShapeAttributes(size_t offset, bool enable) {
+  if (!enable) {
+    glDisableVertexAttribArray(4);
+    glDisableVertexAttribArray(5);
+    return;
+  }
+  GLsizei stride = static_cast<GLsizei>(sizeof(ShapeVertex));
+  auto at = [offset](size_t member) {
+    return reinterpret_cast<void *>(offset + member);
   };
+  GLStateCache::get().bindBuffer(GL_ARRAY_BUFFER, shapeStream_.getBuffer());
+  glVertexAttribPointer(4, 2, GL_FLOAT, GL_FALSE, stride,
+                        at(offsetof(ShapeVertex, local)));
+  glVertexAttribPointer(5, 4, GL_FLOAT, GL_FALSE, stride,
+                        at(offsetof(ShapeVertex, params)));
+  glEnableVertexAttribArray(4);
+  glEnableVertexAttribArray(5);
+}
+
+/**
+ * @brief 添加一段精灵的顶点到顶点缓冲区
+ * @param sprites 精灵数据数组
+ * @param count 精灵数量（调用方保证缓冲区剩余空间足够）
+ *
+ * 数量达到 parallelThreshold_ 时按块分发到线程池，各线程写入互不重叠的区间；
+ * GL 调用仍只在主线程进行
+ */
+void GLSpriteBatch::addVertices(const SpriteData *sprites, size_t count) {
+  uint8_t *dst =
+      vertexPtr_ + (vertexCount_ / VERTICES_PER_SPRITE) * bytesPerSprite_;
+
+  if (parallelThreshold_ > 0 && count >= parallelThreshold_) {
+    ThreadPool::get().parallelFor(
+        count, KERNEL_CHUNK * 16, [this, sprites, dst](size_t begin, size_t end) {
+          writeSprites(sprites + begin, end - begin,
+                       dst + begin * bytesPerSprite_);
+        });
+  } else {
+    writeSprites(sprites, count, dst);
+  }
+  vertexCount_ += count * VERTICES_PER_SPRITE;
+}
+
+/**
+ * @brief 将一段精灵写入顶点（或实例）数据
+ * @param sprites 精灵数据数组
+ * @param count 精灵数量
+ * @param dst 写入起始地址
+ *
+ * 角点由 SIMD 内核按块计算，单个精灵直接走标量路径以避免分发开销
+ */
+void GLSpriteBatch::writeSprites(const SpriteData *sprites, size_t count,
+                                 uint8_t *dst) const {
+  if (instanced_) {
+    // 实例化模式：每个精灵一条记录，CPU 只折算原点与两条边向量
+    auto *inst = reinterpret_cast<InstanceData *>(dst);
+    for (size_t i = 0; i < count; ++i) {
+      writeInstance(inst[i], sprites[i], currentSlot_);
+    }
+    return;
+  }
+
+  SpriteCorners corners[KERNEL_CHUNK];
+  for (size_t base = 0; base < count; base += KERNEL_CHUNK) {
+    size_t n = std::min(KERNEL_CHUNK, count - base);
+    if (n == 1) {
+      computeSpriteCornersScalar(sprites + base, 1, corners);
+    } else {
+      computeSpriteCorners(sprites + base, n, corners);
+    }
+
+    uint8_t *out = dst + base * bytesPerSprite_;
+    for (size_t i = 0; i < n; ++i, out += bytesPerSprite_) {
+      if (compact_) {
+        writeQuad(reinterpret_cast<CompactVertex *>(out), corners[i],
+                  sprites[base + i], currentSlot_);
+      } else {
+        writeQuad(reinterpret_cast<Vertex *>(out), corners[i],
+                  sprites[base + i], currentSlot_);
+      }
+    }
+  }
 }
 
 /**
@@ -304,15 +723,51 @@ void GLSpriteBatch::addVertices(const SpriteData &data) {
  * @param data 精灵数据
  */
 void GLSpriteBatch::draw(const Texture &texture, const SpriteData &data) {
-  // 如果需要刷新，先提交当前批次
-  if (needsFlush(texture, data.isSDF)) {
+  // 缓冲区已满时先提交当前批次，纹理槽位与 SDF 状态由 acquireSlot 处理
+  if (vertexCount_ + VERTICES_PER_SPRITE > maxVertices_) {
+    flush();
+  }
+
+  acquireSlot(texture, data.isSDF);
+  if (!mapVertices()) {
+    return;
+  }
+
+  addVertices(&data, 1);
+  spriteCount_++;
+}
+
+/**
+ * @brief 绘制仿射精灵：四个角点直接由 2x3 矩阵变换得到
+ * @param texture 纹理引用
+ * @param data 仿射精灵数据
+ */
+void GLSpriteBatch::draw(const Texture &texture,
+                         const AffineSpriteData &data) {
+  if (vertexCount_ + VERTICES_PER_SPRITE > maxVertices_) {
     flush();
   }
 
-  currentTexture_ = &texture;
-  currentIsSDF_ = data.isSDF;
+  acquireSlot(texture, data.isSDF);
+  if (!mapVertices()) {
+    return;
+  }
 
-  addVertices(data);
+  uint8_t *dst =
+      vertexPtr_ + (vertexCount_ / VERTICES_PER_SPRITE) * bytesPerSprite_;
+  if (instanced_) {
+    writeInstance(*reinterpret_cast<InstanceData *>(dst), data, currentSlot_);
+  } else {
+    SpriteCorners corners;
+    affineCorners(data, corners);
+    if (compact_) {
+      writeQuad(reinterpret_cast<CompactVertex *>(dst), corners, data,
+                currentSlot_);
+    } else {
+      writeQuad(reinterpret_cast<Vertex *>(dst), corners, data, currentSlot_);
+    }
+  }
+  vertexCount_ += VERTICES_PER_SPRITE;
   spriteCount_++;
 }
 
@@ -327,31 +782,25 @@ void GLSpriteBatch::drawBatch(const Texture &texture,
     return;
   }
 
-  // 如果当前有未提交的批次且纹理不同，先刷新
-  if (currentTexture_ != nullptr && currentTexture_ != &texture) {
-    flush();
-  }
-
-  currentTexture_ = &texture;
-  currentIsSDF_ = sprites[0].isSDF; // 假设批量中的精灵 SDF 状态一致
+  bool isSDF = sprites[0].isSDF; // 假设批量中的精灵 SDF 状态一致
 
   // 分批处理，避免超过缓冲区大小
   size_t index = 0;
   while (index < sprites.size()) {
-    size_t remainingSpace = (MAX_VERTICES - vertexCount_) / VERTICES_PER_SPRITE;
+    if (vertexCount_ + VERTICES_PER_SPRITE > maxVertices_) {
+      flush();
+    }
+    acquireSlot(texture, isSDF);
+    if (!mapVertices()) {
+      return;
+    }
+    size_t remainingSpace = (maxVertices_ - vertexCount_) / VERTICES_PER_SPRITE;
     size_t batchSize = std::min(sprites.size() - index, remainingSpace);
 
-    for (size_t i = 0; i < batchSize; ++i) {
-      addVertices(sprites[index + i]);
-      spriteCount_++;
-    }
+    addVertices(sprites.data() + index, batchSize);
+    spriteCount_ += static_cast<uint32_t>(batchSize);
 
     index += batchSize;
-
-    // 如果还有更多精灵，刷新当前批次
-    if (index < sprites.size()) {
-      flush();
-    }
   }
 
   batchCount_++;
@@ -367,20 +816,178 @@ void GLSpriteBatch::drawImmediate(const Texture &texture,
   // 立即绘制，不缓存 - 用于需要立即显示的情况
   flush(); // 先提交当前批次
 
-  currentTexture_ = &texture;
-  currentIsSDF_ = data.isSDF;
-  addVertices(data);
+  acquireSlot(texture, data.isSDF);
+  if (!mapVertices()) {
+    return;
+  }
+
+  addVertices(&data, 1);
   spriteCount_++;
 
   flush(); // 立即提交
 }
 
+/**
+ * @brief 为一个纯色四边形预留空间
+ * @return 映射成功返回true
+ *
+ * 纯色形状不占用纹理槽位，只在 SDF 批次中或缓冲区已满时刷新
+ */
+bool GLSpriteBatch::reserveSolid() {
+  if (vertexCount_ > 0 && currentIsSDF_) {
+    flush();
+  }
+  if (vertexCount_ + VERTICES_PER_SPRITE > maxVertices_) {
+    flush();
+  }
+  currentIsSDF_ = false;
+  return mapVertices();
+}
+
+/**
+ * @brief 写入一个纯色四边形，索引顺序为 (0,1,2) (0,2,3)
+ * @param slot 白色纹素或 SDF 形状槽位
+ */
+void GLSpriteBatch::writeSolidQuad(const glm::vec2 &p0, const glm::vec2 &p1,
+                                   const glm::vec2 &p2, const glm::vec2 &p3,
+                                   const glm::vec4 &color, uint32_t slot) {
+  SpriteCorners q = {{p0.x, p1.x, p2.x, p3.x}, {p0.y, p1.y, p2.y, p3.y}};
+  SpriteData data;
+  data.texCoordMin = glm::vec2(0.0f, 0.0f);
+  data.texCoordMax = glm::vec2(0.0f, 0.0f);
+  data.color = color;
+
+  uint8_t *dst =
+      vertexPtr_ + (vertexCount_ / VERTICES_PER_SPRITE) * bytesPerSprite_;
+  if (compact_) {
+    writeQuad(reinterpret_cast<CompactVertex *>(dst), q, data, slot);
+  } else {
+    writeQuad(reinterpret_cast<Vertex *>(dst), q, data, slot);
+  }
+  vertexCount_ += VERTICES_PER_SPRITE;
+}
+
+/**
+ * @brief 绘制纯色四边形
+ * @param p0 角点 0
+ * @param p1 角点 1
+ * @param p2 角点 2
+ * @param p3 角点 3
+ * @param color 颜色
+ */
+void GLSpriteBatch::drawSolidQuad(const glm::vec2 &p0, const glm::vec2 &p1,
+                                  const glm::vec2 &p2, const glm::vec2 &p3,
+                                  const glm::vec4 &color) {
+  if (!supportsSolidShapes() || !reserveSolid()) {
+    return;
+  }
+  writeSolidQuad(p0, p1, p2, p3, color);
+}
+
+/**
+ * @brief 绘制纯色三角形（第四个顶点与第三个重合，第二个三角形退化）
+ * @param p0 顶点 0
+ * @param p1 顶点 1
+ * @param p2 顶点 2
+ * @param color 颜色
+ */
+void GLSpriteBatch::drawSolidTriangle(const glm::vec2 &p0, const glm::vec2 &p1,
+                                      const glm::vec2 &p2,
+                                      const glm::vec4 &color) {
+  if (!supportsSolidShapes() || !reserveSolid()) {
+    return;
+  }
+  writeSolidQuad(p0, p1, p2, p2, color);
+}
+
+/**
+ * @brief 绘制纯色三角形扇
+ * @param points 顶点数组，points[0] 为扇形中心
+ * @param count 顶点数量
+ * @param color 颜色
+ *
+ * 每个四边形 (c, p[i], p[i+1], p[i+2]) 恰好对应扇形中相邻的两个三角形
+ */
+void GLSpriteBatch::drawSolidFan(const glm::vec2 *points, size_t count,
+                                 const glm::vec4 &color) {
+  if (!supportsSolidShapes() || count < 3) {
+    return;
+  }
+  const glm::vec2 &center = points[0];
+  size_t i = 1;
+  for (; i + 2 < count; i += 2) {
+    if (!reserveSolid()) {
+      return;
+    }
+    writeSolidQuad(center, points[i], points[i + 1], points[i + 2], color);
+  }
+  if (i + 1 < count && reserveSolid()) {
+    writeSolidQuad(center, points[i], points[i + 1], points[i + 1], color);
+  }
+}
+
+/**
+ * @brief 绘制 SDF 形状
+ * @param shape 形状记录（与独立 SDF 批次的实例格式相同）
+ *
+ * 在 CPU 端展开为覆盖形状的四边形：外包尺寸 = 半尺寸 + 半描边宽 +
+ * 2 个像素的抗锯齿余量，与 GLSDFShapeBatch 的顶点着色器一致；
+ * 局部坐标与形状参数写入形状流，片段着色器按槽位计算覆盖率
+ */
+void GLSpriteBatch::drawSDFShape(const GLSDFShapeBatch::InstanceData &shape) {
+  if (!sdfShapes_ || !reserveSolid()) {
+    return;
+  }
+  if (shapePtr_ == nullptr) {
+    shapePtr_ = static_cast<ShapeVertex *>(shapeStream_.map(
+        maxVertices_ * sizeof(ShapeVertex), sizeof(ShapeVertex)));
+    if (shapePtr_ == nullptr) {
+      return;
+    }
+  }
+
+  float pixelScale = GLFrameConstants::get().getData().pixelScale;
+  float padX = 2.0f / std::max(glm::length(shape.axisX) * pixelScale, 1e-4f);
+  float padY = 2.0f / std::max(glm::length(shape.axisY) * pixelScale, 1e-4f);
+  float halfStroke = shape.thickness * 0.5f;
+  glm::vec2 extent(shape.halfSize.x + halfStroke + padX,
+                   shape.halfSize.y + halfStroke + padY);
+
+  const glm::vec2 corners[4] = {{-extent.x, -extent.y},
+                                {extent.x, -extent.y},
+                                {extent.x, extent.y},
+                                {-extent.x, extent.y}};
+  glm::vec2 world[4];
+  glm::vec4 params(shape.halfSize, shape.radius, shape.thickness);
+  ShapeVertex *dst = shapePtr_ + vertexCount_;
+  for (int i = 0; i < 4; ++i) {
+    world[i] = shape.center + shape.axisX * corners[i].x +
+               shape.axisY * corners[i].y;
+    dst[i].local = corners[i];
+    dst[i].params = params;
+  }
+
+  const float inv255 = 1.0f / 255.0f;
+  glm::vec4 color(shape.color[0] * inv255, shape.color[1] * inv255,
+                  shape.color[2] * inv255, shape.color[3] * inv255);
+  writeSolidQuad(world[0], world[1], world[2], world[3], color,
+                 SDF_SHAPE_SLOT + shape.kind);
+}
+
 /**
  * @brief 结束批处理，提交所有待绘制的精灵
  */
 void GLSpriteBatch::end() {
   if (vertexCount_ > 0) {
     flush();
+  } else if (vertexPtr_ != nullptr) {
+    // 已映射但未写入，归还预留空间
+    vertexStream_.unmap(0);
+    vertexPtr_ = nullptr;
+  }
+  if (shapePtr_ != nullptr) {
+    shapeStream_.unmap(0);
+    shapePtr_ = nullptr;
   }
 }
 
@@ -388,40 +995,79 @@ void GLSpriteBatch::end() {
  * @brief 刷新批次，执行实际的OpenGL绘制调用
  */
 void GLSpriteBatch::flush() {
-  if (vertexCount_ == 0 || currentTexture_ == nullptr) {
+  // 只含纯色形状的批次没有占用纹理槽位
+  if (vertexCount_ == 0) {
     return;
   }
 
-  // 绑定纹理
-  GLuint texID = static_cast<GLuint>(
-      reinterpret_cast<uintptr_t>(currentTexture_->getNativeHandle()));
-  glActiveTexture(GL_TEXTURE0);
-  glBindTexture(GL_TEXTURE_2D, texID);
+  // 绑定各槽位纹理，已绑定在对应单元上的纹理由状态缓存跳过
+  auto &state = GLStateCache::get();
+  for (size_t i = 0; i < slotCount_; ++i) {
+    GLuint texID = static_cast<GLuint>(
+        reinterpret_cast<uintptr_t>(slotTextures_[i]->getNativeHandle()));
+    state.bindTexture(static_cast<uint32_t>(i), texID);
+  }
 
-  // 使用着色器
+  // 视图投影由共享的帧常量块提供；uUseSDF 未变化时由影子副本跳过
+  GLFrameConstants::get().upload();
   shader_.bind();
-  shader_.setMat4("uViewProjection", viewProjection_);
-  shader_.setInt("uTexture", 0);
-  shader_.setInt("uUseSDF", currentIsSDF_ ? 1 : 0);
+  shader_.set(useSDFUniform_, currentIsSDF_ ? 1 : 0);
   // SDF 常量已硬编码到着色器中
 
-  // 更新 VBO 数据 - 只更新实际使用的部分
-  glBindBuffer(GL_ARRAY_BUFFER, vbo_);
-  glBufferSubData(GL_ARRAY_BUFFER, 0, vertexCount_ * sizeof(Vertex),
-                  vertexBuffer_.data());
+  // 提交顶点数据 - 只提交实际写入的部分，返回本批次在缓冲区中的偏移
+  size_t spriteCount = vertexCount_ / VERTICES_PER_SPRITE;
+  size_t offset = vertexStream_.unmap(spriteCount * bytesPerSprite_);
+  vertexPtr_ = nullptr;
 
-  // 绘制
-  glBindVertexArray(vao_);
-  GLsizei indexCount = static_cast<GLsizei>(
-      (vertexCount_ / VERTICES_PER_SPRITE) * INDICES_PER_SPRITE);
-  glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_INT, nullptr);
+  state.bindVertexArray(vao_);
+  if (instanced_) {
+    // 每个实例绘制一个 4 顶点三角形带
+    bindInstanceAttributes(offset);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4,
+                          static_cast<GLsizei>(spriteCount));
+    drawCallCount_++;
+  } else {
+    // 流式模式通过 baseVertex 定位本批次的顶点；含 SDF 形状的批次改为
+    // 按偏移指定两条流的属性指针，从顶点 0 开始绘制。
+    // 超过 16 位索引范围时拆分为多个子批次
+    size_t baseVertex = offset / vertexStride_;
+    if (shapePtr_ != nullptr) {
+      size_t shapeOffset =
+          shapeStream_.unmap(vertexCount_ * sizeof(ShapeVertex));
+      shapePtr_ = nullptr;
+      bindVertexAttributes(offset);
+      bindShapeAttributes(shapeOffset, true);
+      attribsOffset_ = true;
+      baseVertex = 0;
+    } else if (attribsOffset_) {
+      bindVertexAttributes(0);
+      bindShapeAttributes(0, false);
+      attribsOffset_ = false;
+    }
+    size_t drawn = 0;
+    while (drawn < vertexCount_) {
+      size_t count = std::min(vertexCount_ - drawn, MAX_VERTICES_PER_DRAW);
+      GLsizei indexCount = static_cast<GLsizei>(
+          (count / VERTICES_PER_SPRITE) * INDICES_PER_SPRITE);
+      GLint base = static_cast<GLint>(baseVertex + drawn);
+      if (base == 0) {
+        glDrawElements(GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT, nullptr);
+      } else {
+        glDrawElementsBaseVertex(GL_TRIANGLES, indexCount, GL_UNSIGNED_SHORT,
+                                 nullptr, base);
+      }
+      drawCallCount_++;
+      drawn += count;
+    }
+  }
 
-  drawCallCount_++;
   batchCount_++;
+  flushCount_++;
 
   // 重置状态
   vertexCount_ = 0;
-  currentTexture_ = nullptr;
+  slotCount_ = 0;
+  currentSlot_ = 0;
   currentIsSDF_ = false;
 }
 
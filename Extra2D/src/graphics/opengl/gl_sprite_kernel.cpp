@@ -0,0 +1,524 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <extra2d/graphics/opengl/gl_sprite_kernel.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+#define E2D_SPRITE_KERNEL_SSE2 1
+#include <emmintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define E2D_SPRITE_KERNEL_AVX2 1
+#include <immintrin.h>
+#endif
+#elif defined(__aarch64__) && defined(__ARM_NEON)
+#define E2D_SPRITE_KERNEL_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace extra2d {
+
+using SpriteData = GLSpriteBatch::SpriteData;
+
+// SIMD 路径按 16 字节整块读取 {position, size} 与 {rotation, anchor, ...}
+static_assert(offsetof(SpriteData, size) == offsetof(SpriteData, position) + 8,
+              "SpriteData::size must follow position");
+static_assert(offsetof(SpriteData, anchor) ==
+                  offsetof(SpriteData, rotation) + 4,
+              "SpriteData::anchor must follow rotation");
+static_assert(offsetof(SpriteData, rotation) + 16 <= sizeof(SpriteData),
+              "SpriteData tail must hold a 16-byte load");
+
+// ============================================================================
+// 多项式 sin/cos 常量（Cephes sinf/cosf，按 π/4 分象限）
+// ============================================================================
+static constexpr float FOUR_OVER_PI = 1.27323954473516f;
+static constexpr float DP1 = 0.78515625f;
+static constexpr float DP2 = 2.4187564849853515625e-4f;
+static constexpr float DP3 = 3.77489497744594108e-8f;
+static constexpr float SIN_P0 = -1.9515295891e-4f;
+static constexpr float SIN_P1 = 8.3321608736e-3f;
+static constexpr float SIN_P2 = -1.6666654611e-1f;
+static constexpr float COS_P0 = 2.443315711809948e-5f;
+static constexpr float COS_P1 = -1.388731625493765e-3f;
+static constexpr float COS_P2 = 4.166664568298827e-2f;
+
+// ============================================================================
+// 标量 sin/cos 查表 - 一周 4096 个采样点，取最近的采样点
+// 逐个精灵调用时比标量多项式（象限选择与位运算）快约 4 倍；线性插值
+// 会抵消大部分收益，因此不做插值。最大角度误差 π/4096 ≈ 7.7e-4 弧度，
+// 约为原 0.25 度截断查表的 1/6，64 像素的精灵角点偏差不超过 0.05 像素
+// ============================================================================
+static constexpr int32_t TRIG_TABLE_SIZE = 4096;
+static constexpr float RAD_TO_TRIG_INDEX =
+    static_cast<float>(TRIG_TABLE_SIZE) / (2.0f * 3.14159265358979f);
+// 加减 1.5 * 2^23 将浮点数舍入到最近整数（|x| < 2^22 时精确）
+static constexpr float ROUND_MAGIC = 12582912.0f;
+
+struct TrigTable {
+  // sin/cos 交错存放，一次查表只访问一条缓存行
+  float sinCos[TRIG_TABLE_SIZE][2];
+
+  TrigTable() {
+    for (int32_t i = 0; i < TRIG_TABLE_SIZE; ++i) {
+      double angle = static_cast<double>(i) * 2.0 * 3.14159265358979323846 /
+                     TRIG_TABLE_SIZE;
+      sinCos[i][0] = static_cast<float>(std::sin(angle));
+      sinCos[i][1] = static_cast<float>(std::cos(angle));
+    }
+  }
+};
+
+static const TrigTable TRIG_TABLE;
+
+/**
+ * @brief 查表 sin/cos，内联进标量内核的逐精灵循环
+ */
+static inline void tableSinCos(float radians, float &s, float &c) {
+  float nearest = (radians * RAD_TO_TRIG_INDEX + ROUND_MAGIC) - ROUND_MAGIC;
+  uint32_t idx = static_cast<uint32_t>(static_cast<int32_t>(nearest)) &
+                 (TRIG_TABLE_SIZE - 1);
+  s = TRIG_TABLE.sinCos[idx][0];
+  c = TRIG_TABLE.sinCos[idx][1];
+}
+
+/**
+ * @brief 标量 sin/cos（查表）
+ * @param radians 弧度
+ * @param s 输出 sin 值
+ * @param c 输出 cos 值
+ */
+void fastSinCos(float radians, float &s, float &c) {
+  tableSinCos(radians, s, c);
+}
+
+/**
+ * @brief 由已知 sin/cos 计算单个精灵角点
+ */
+static inline void cornersFromSinCos(const SpriteData &d, float s, float c,
+                                     SpriteCorners &out) {
+  float rx0 = -d.size.x * d.anchor.x;
+  float ry0 = -d.size.y * d.anchor.y;
+  float rx1 = d.size.x + rx0;
+  float ry1 = d.size.y + ry0;
+
+  float rx0c = rx0 * c, rx0s = rx0 * s;
+  float rx1c = rx1 * c, rx1s = rx1 * s;
+  float ry0c = ry0 * c, ry0s = ry0 * s;
+  float ry1c = ry1 * c, ry1s = ry1 * s;
+
+  out.x[0] = d.position.x + rx0c - ry0s;
+  out.y[0] = d.position.y + rx0s + ry0c;
+  out.x[1] = d.position.x + rx1c - ry0s;
+  out.y[1] = d.position.y + rx1s + ry0c;
+  out.x[2] = d.position.x + rx1c - ry1s;
+  out.y[2] = d.position.y + rx1s + ry1c;
+  out.x[3] = d.position.x + rx0c - ry1s;
+  out.y[3] = d.position.y + rx0s + ry1c;
+}
+
+/**
+ * @brief 标量实现
+ */
+void computeSpriteCornersScalar(const SpriteData *sprites, size_t count,
+                                SpriteCorners *out) {
+  for (size_t i = 0; i < count; ++i) {
+    float s = 0.0f, c = 1.0f;
+    if (sprites[i].rotation != 0.0f) {
+      tableSinCos(sprites[i].rotation, s, c);
+    }
+    cornersFromSinCos(sprites[i], s, c, out[i]);
+  }
+}
+
+#if defined(E2D_SPRITE_KERNEL_SSE2)
+// ============================================================================
+// SSE2 实现 - 每次 4 个精灵
+// ============================================================================
+/**
+ * @brief 4 路多项式 sin/cos
+ */
+static inline void sinCos4(__m128 x, __m128 &s, __m128 &c) {
+  const __m128 signMask = _mm_castsi128_ps(_mm_set1_epi32(INT32_MIN));
+  __m128 signSin = _mm_and_ps(x, signMask);
+  x = _mm_andnot_ps(signMask, x);
+
+  __m128i j = _mm_cvttps_epi32(_mm_mul_ps(x, _mm_set1_ps(FOUR_OVER_PI)));
+  j = _mm_and_si128(_mm_add_epi32(j, _mm_set1_epi32(1)), _mm_set1_epi32(~1));
+  __m128 y = _mm_cvtepi32_ps(j);
+
+  __m128i flipSin = _mm_slli_epi32(_mm_and_si128(j, _mm_set1_epi32(4)), 29);
+  __m128i flipCos = _mm_slli_epi32(
+      _mm_andnot_si128(_mm_sub_epi32(j, _mm_set1_epi32(2)), _mm_set1_epi32(4)),
+      29);
+  __m128 swap = _mm_castsi128_ps(
+      _mm_cmpeq_epi32(_mm_and_si128(j, _mm_set1_epi32(2)), _mm_set1_epi32(2)));
+
+  x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP1)));
+  x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP2)));
+  x = _mm_sub_ps(x, _mm_mul_ps(y, _mm_set1_ps(DP3)));
+  __m128 z = _mm_mul_ps(x, x);
+
+  __m128 pc = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(COS_P0), z), _mm_set1_ps(COS_P1));
+  pc = _mm_add_ps(_mm_mul_ps(pc, z), _mm_set1_ps(COS_P2));
+  pc = _mm_mul_ps(_mm_mul_ps(pc, z), z);
+  pc = _mm_sub_ps(pc, _mm_mul_ps(_mm_set1_ps(0.5f), z));
+  pc = _mm_add_ps(pc, _mm_set1_ps(1.0f));
+
+  __m128 ps = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(SIN_P0), z), _mm_set1_ps(SIN_P1));
+  ps = _mm_add_ps(_mm_mul_ps(ps, z), _mm_set1_ps(SIN_P2));
+  ps = _mm_add_ps(_mm_mul_ps(_mm_mul_ps(ps, z), x), x);
+
+  s = _mm_or_ps(_mm_and_ps(swap, pc), _mm_andnot_ps(swap, ps));
+  c = _mm_or_ps(_mm_and_ps(swap, ps), _mm_andnot_ps(swap, pc));
+  s = _mm_xor_ps(s, _mm_xor_ps(signSin, _mm_castsi128_ps(flipSin)));
+  c = _mm_xor_ps(c, _mm_castsi128_ps(flipCos));
+}
+
+/**
+ * @brief 读取 4 个精灵的几何字段并转置为按字段排列的向量
+ *
+ * 每个精灵两次 16 字节读取，代替逐字段插入
+ */
+static inline void loadSprites4(const SpriteData *p, __m128 &px, __m128 &py,
+                                __m128 &sx, __m128 &sy, __m128 &rot,
+                                __m128 &ax, __m128 &ay) {
+  px = _mm_loadu_ps(&p[0].position.x);
+  py = _mm_loadu_ps(&p[1].position.x);
+  sx = _mm_loadu_ps(&p[2].position.x);
+  sy = _mm_loadu_ps(&p[3].position.x);
+  _MM_TRANSPOSE4_PS(px, py, sx, sy);
+
+  rot = _mm_loadu_ps(&p[0].rotation);
+  ax = _mm_loadu_ps(&p[1].rotation);
+  ay = _mm_loadu_ps(&p[2].rotation);
+  __m128 tail = _mm_loadu_ps(&p[3].rotation);
+  _MM_TRANSPOSE4_PS(rot, ax, ay, tail);
+}
+
+static void computeSpriteCornersSSE2(const SpriteData *sp, size_t count,
+                                     SpriteCorners *out) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    __m128 px, py, sx, sy, rot, ax, ay;
+    loadSprites4(sp + i, px, py, sx, sy, rot, ax, ay);
+
+    // 整组无旋转时跳过 sin/cos
+    __m128 vs = _mm_setzero_ps(), vc = _mm_set1_ps(1.0f);
+    if (_mm_movemask_ps(_mm_cmpneq_ps(rot, _mm_setzero_ps())) != 0) {
+      sinCos4(rot, vs, vc);
+    }
+
+    __m128 rx0 = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(sx, ax));
+    __m128 ry0 = _mm_sub_ps(_mm_setzero_ps(), _mm_mul_ps(sy, ay));
+    __m128 rx1 = _mm_add_ps(sx, rx0);
+    __m128 ry1 = _mm_add_ps(sy, ry0);
+
+    __m128 rx0c = _mm_mul_ps(rx0, vc), rx0s = _mm_mul_ps(rx0, vs);
+    __m128 rx1c = _mm_mul_ps(rx1, vc), rx1s = _mm_mul_ps(rx1, vs);
+    __m128 ry0c = _mm_mul_ps(ry0, vc), ry0s = _mm_mul_ps(ry0, vs);
+    __m128 ry1c = _mm_mul_ps(ry1, vc), ry1s = _mm_mul_ps(ry1, vs);
+
+    __m128 x0 = _mm_sub_ps(_mm_add_ps(px, rx0c), ry0s);
+    __m128 x1 = _mm_sub_ps(_mm_add_ps(px, rx1c), ry0s);
+    __m128 x2 = _mm_sub_ps(_mm_add_ps(px, rx1c), ry1s);
+    __m128 x3 = _mm_sub_ps(_mm_add_ps(px, rx0c), ry1s);
+    __m128 y0 = _mm_add_ps(_mm_add_ps(py, rx0s), ry0c);
+    __m128 y1 = _mm_add_ps(_mm_add_ps(py, rx1s), ry0c);
+    __m128 y2 = _mm_add_ps(_mm_add_ps(py, rx1s), ry1c);
+    __m128 y3 = _mm_add_ps(_mm_add_ps(py, rx0s), ry1c);
+
+    // 转置为每个精灵的 4 个角点
+    _MM_TRANSPOSE4_PS(x0, x1, x2, x3);
+    _MM_TRANSPOSE4_PS(y0, y1, y2, y3);
+    _mm_storeu_ps(out[i].x, x0);
+    _mm_storeu_ps(out[i].y, y0);
+    _mm_storeu_ps(out[i + 1].x, x1);
+    _mm_storeu_ps(out[i + 1].y, y1);
+    _mm_storeu_ps(out[i + 2].x, x2);
+    _mm_storeu_ps(out[i + 2].y, y2);
+    _mm_storeu_ps(out[i + 3].x, x3);
+    _mm_storeu_ps(out[i + 3].y, y3);
+  }
+  computeSpriteCornersScalar(sp + i, count - i, out + i);
+}
+#endif
+
+#if defined(E2D_SPRITE_KERNEL_AVX2)
+// ============================================================================
+// AVX2 实现 - 每次 8 个精灵（运行时检测 CPU 支持后启用）
+// ============================================================================
+#define E2D_AVX2_TARGET __attribute__((target("avx2")))
+
+E2D_AVX2_TARGET static inline void sinCos8(__m256 x, __m256 &s, __m256 &c) {
+  const __m256 signMask = _mm256_castsi256_ps(_mm256_set1_epi32(INT32_MIN));
+  __m256 signSin = _mm256_and_ps(x, signMask);
+  x = _mm256_andnot_ps(signMask, x);
+
+  __m256i j =
+      _mm256_cvttps_epi32(_mm256_mul_ps(x, _mm256_set1_ps(FOUR_OVER_PI)));
+  j = _mm256_and_si256(_mm256_add_epi32(j, _mm256_set1_epi32(1)),
+                       _mm256_set1_epi32(~1));
+  __m256 y = _mm256_cvtepi32_ps(j);
+
+  __m256i flipSin =
+      _mm256_slli_epi32(_mm256_and_si256(j, _mm256_set1_epi32(4)), 29);
+  __m256i flipCos = _mm256_slli_epi32(
+      _mm256_andnot_si256(_mm256_sub_epi32(j, _mm256_set1_epi32(2)),
+                          _mm256_set1_epi32(4)),
+      29);
+  __m256 swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(
+      _mm256_and_si256(j, _mm256_set1_epi32(2)), _mm256_set1_epi32(2)));
+
+  x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(DP1)));
+  x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(DP2)));
+  x = _mm256_sub_ps(x, _mm256_mul_ps(y, _mm256_set1_ps(DP3)));
+  __m256 z = _mm256_mul_ps(x, x);
+
+  __m256 pc = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(COS_P0), z),
+                            _mm256_set1_ps(COS_P1));
+  pc = _mm256_add_ps(_mm256_mul_ps(pc, z), _mm256_set1_ps(COS_P2));
+  pc = _mm256_mul_ps(_mm256_mul_ps(pc, z), z);
+  pc = _mm256_sub_ps(pc, _mm256_mul_ps(_mm256_set1_ps(0.5f), z));
+  pc = _mm256_add_ps(pc, _mm256_set1_ps(1.0f));
+
+  __m256 ps = _mm256_add_ps(_mm256_mul_ps(_mm256_set1_ps(SIN_P0), z),
+                            _mm256_set1_ps(SIN_P1));
+  ps = _mm256_add_ps(_mm256_mul_ps(ps, z), _mm256_set1_ps(SIN_P2));
+  ps = _mm256_add_ps(_mm256_mul_ps(_mm256_mul_ps(ps, z), x), x);
+
+  s = _mm256_blendv_ps(ps, pc, swap);
+  c = _mm256_blendv_ps(pc, ps, swap);
+  s = _mm256_xor_ps(s, _mm256_xor_ps(signSin, _mm256_castsi256_ps(flipSin)));
+  c = _mm256_xor_ps(c, _mm256_castsi256_ps(flipCos));
+}
+
+/**
+ * @brief 将 8 路向量的低/高 128 位分别转置后写出
+ */
+E2D_AVX2_TARGET static inline void storeTransposed8(__m256 v0, __m256 v1,
+                                                    __m256 v2, __m256 v3,
+                                                    SpriteCorners *out,
+                                                    bool isX) {
+  __m128 l0 = _mm256_castps256_ps128(v0), h0 = _mm256_extractf128_ps(v0, 1);
+  __m128 l1 = _mm256_castps256_ps128(v1), h1 = _mm256_extractf128_ps(v1, 1);
+  __m128 l2 = _mm256_castps256_ps128(v2), h2 = _mm256_extractf128_ps(v2, 1);
+  __m128 l3 = _mm256_castps256_ps128(v3), h3 = _mm256_extractf128_ps(v3, 1);
+  _MM_TRANSPOSE4_PS(l0, l1, l2, l3);
+  _MM_TRANSPOSE4_PS(h0, h1, h2, h3);
+  __m128 rows[8] = {l0, l1, l2, l3, h0, h1, h2, h3};
+  for (int k = 0; k < 8; ++k) {
+    _mm_storeu_ps(isX ? out[k].x : out[k].y, rows[k]);
+  }
+}
+
+E2D_AVX2_TARGET static void computeSpriteCornersAVX2(const SpriteData *sp,
+                                                     size_t count,
+                                                     SpriteCorners *out) {
+  size_t i = 0;
+  for (; i + 8 <= count; i += 8) {
+    __m128 lpx, lpy, lsx, lsy, lrot, lax, lay;
+    __m128 hpx, hpy, hsx, hsy, hrot, hax, hay;
+    loadSprites4(sp + i, lpx, lpy, lsx, lsy, lrot, lax, lay);
+    loadSprites4(sp + i + 4, hpx, hpy, hsx, hsy, hrot, hax, hay);
+    __m256 px = _mm256_set_m128(hpx, lpx);
+    __m256 py = _mm256_set_m128(hpy, lpy);
+    __m256 sx = _mm256_set_m128(hsx, lsx);
+    __m256 sy = _mm256_set_m128(hsy, lsy);
+    __m256 rot = _mm256_set_m128(hrot, lrot);
+    __m256 ax = _mm256_set_m128(hax, lax);
+    __m256 ay = _mm256_set_m128(hay, lay);
+
+    // 整组无旋转时跳过 sin/cos
+    __m256 vs = _mm256_setzero_ps(), vc = _mm256_set1_ps(1.0f);
+    if (_mm256_movemask_ps(_mm256_cmp_ps(rot, _mm256_setzero_ps(),
+                                         _CMP_NEQ_UQ)) != 0) {
+      sinCos8(rot, vs, vc);
+    }
+
+    __m256 rx0 = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_mul_ps(sx, ax));
+    __m256 ry0 = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_mul_ps(sy, ay));
+    __m256 rx1 = _mm256_add_ps(sx, rx0);
+    __m256 ry1 = _mm256_add_ps(sy, ry0);
+
+    __m256 rx0c = _mm256_mul_ps(rx0, vc), rx0s = _mm256_mul_ps(rx0, vs);
+    __m256 rx1c = _mm256_mul_ps(rx1, vc), rx1s = _mm256_mul_ps(rx1, vs);
+    __m256 ry0c = _mm256_mul_ps(ry0, vc), ry0s = _mm256_mul_ps(ry0, vs);
+    __m256 ry1c = _mm256_mul_ps(ry1, vc), ry1s = _mm256_mul_ps(ry1, vs);
+
+    __m256 x0 = _mm256_sub_ps(_mm256_add_ps(px, rx0c), ry0s);
+    __m256 x1 = _mm256_sub_ps(_mm256_add_ps(px, rx1c), ry0s);
+    __m256 x2 = _mm256_sub_ps(_mm256_add_ps(px, rx1c), ry1s);
+    __m256 x3 = _mm256_sub_ps(_mm256_add_ps(px, rx0c), ry1s);
+    __m256 y0 = _mm256_add_ps(_mm256_add_ps(py, rx0s), ry0c);
+    __m256 y1 = _mm256_add_ps(_mm256_add_ps(py, rx1s), ry0c);
+    __m256 y2 = _mm256_add_ps(_mm256_add_ps(py, rx1s), ry1c);
+    __m256 y3 = _mm256_add_ps(_mm256_add_ps(py, rx0s), ry1c);
+
+    storeTransposed8(x0, x1, x2, x3, out + i, true);
+    storeTransposed8(y0, y1, y2, y3, out + i, false);
+  }
+  // 不足 8 个的尾部直接走标量查表，比再经一次 4 路多项式更快
+  computeSpriteCornersScalar(sp + i, count - i, out + i);
+}
+
+#undef E2D_AVX2_TARGET
+#endif
+
+#if defined(E2D_SPRITE_KERNEL_NEON)
+// ============================================================================
+// NEON 实现 - 每次 4 个精灵
+// ============================================================================
+static inline void sinCos4(float32x4_t x, float32x4_t &s, float32x4_t &c) {
+  uint32x4_t signSin = vandq_u32(vreinterpretq_u32_f32(x),
+                                 vdupq_n_u32(0x80000000u));
+  x = vabsq_f32(x);
+
+  int32x4_t j = vcvtq_s32_f32(vmulq_n_f32(x, FOUR_OVER_PI));
+  j = vandq_s32(vaddq_s32(j, vdupq_n_s32(1)), vdupq_n_s32(~1));
+  float32x4_t y = vcvtq_f32_s32(j);
+
+  uint32x4_t flipSin = vshlq_n_u32(
+      vreinterpretq_u32_s32(vandq_s32(j, vdupq_n_s32(4))), 29);
+  uint32x4_t flipCos = vshlq_n_u32(
+      vreinterpretq_u32_s32(
+          vbicq_s32(vdupq_n_s32(4), vsubq_s32(j, vdupq_n_s32(2)))),
+      29);
+  uint32x4_t swap = vceqq_s32(vandq_s32(j, vdupq_n_s32(2)), vdupq_n_s32(2));
+
+  x = vsubq_f32(x, vmulq_n_f32(y, DP1));
+  x = vsubq_f32(x, vmulq_n_f32(y, DP2));
+  x = vsubq_f32(x, vmulq_n_f32(y, DP3));
+  float32x4_t z = vmulq_f32(x, x);
+
+  float32x4_t pc = vaddq_f32(vmulq_n_f32(z, COS_P0), vdupq_n_f32(COS_P1));
+  pc = vaddq_f32(vmulq_f32(pc, z), vdupq_n_f32(COS_P2));
+  pc = vmulq_f32(vmulq_f32(pc, z), z);
+  pc = vsubq_f32(pc, vmulq_n_f32(z, 0.5f));
+  pc = vaddq_f32(pc, vdupq_n_f32(1.0f));
+
+  float32x4_t ps = vaddq_f32(vmulq_n_f32(z, SIN_P0), vdupq_n_f32(SIN_P1));
+  ps = vaddq_f32(vmulq_f32(ps, z), vdupq_n_f32(SIN_P2));
+  ps = vaddq_f32(vmulq_f32(vmulq_f32(ps, z), x), x);
+
+  s = vbslq_f32(swap, pc, ps);
+  c = vbslq_f32(swap, ps, pc);
+  s = vreinterpretq_f32_u32(
+      veorq_u32(vreinterpretq_u32_f32(s), veorq_u32(signSin, flipSin)));
+  c = vreinterpretq_f32_u32(veorq_u32(vreinterpretq_u32_f32(c), flipCos));
+}
+
+/**
+ * @brief 4x4 转置
+ */
+static inline void transpose4(float32x4_t v0, float32x4_t v1, float32x4_t v2,
+                              float32x4_t v3, float32x4_t &r0,
+                              float32x4_t &r1, float32x4_t &r2,
+                              float32x4_t &r3) {
+  float32x4x2_t t01 = vzipq_f32(v0, v1);
+  float32x4x2_t t23 = vzipq_f32(v2, v3);
+  r0 = vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0]));
+  r1 = vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0]));
+  r2 = vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1]));
+  r3 = vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1]));
+}
+
+/**
+ * @brief 4x4 转置后写出
+ */
+static inline void storeTransposed4(float32x4_t v0, float32x4_t v1,
+                                    float32x4_t v2, float32x4_t v3,
+                                    SpriteCorners *out, bool isX) {
+  float32x4_t r0, r1, r2, r3;
+  transpose4(v0, v1, v2, v3, r0, r1, r2, r3);
+  vst1q_f32(isX ? out[0].x : out[0].y, r0);
+  vst1q_f32(isX ? out[1].x : out[1].y, r1);
+  vst1q_f32(isX ? out[2].x : out[2].y, r2);
+  vst1q_f32(isX ? out[3].x : out[3].y, r3);
+}
+
+static void computeSpriteCornersNEON(const SpriteData *sp, size_t count,
+                                     SpriteCorners *out) {
+  size_t i = 0;
+  for (; i + 4 <= count; i += 4) {
+    const SpriteData *p = sp + i;
+    // 每个精灵两次 16 字节读取后转置
+    float32x4_t px, py, sx, sy, rot, ax, ay, tail;
+    transpose4(vld1q_f32(&p[0].position.x), vld1q_f32(&p[1].position.x),
+               vld1q_f32(&p[2].position.x), vld1q_f32(&p[3].position.x), px,
+               py, sx, sy);
+    transpose4(vld1q_f32(&p[0].rotation), vld1q_f32(&p[1].rotation),
+               vld1q_f32(&p[2].rotation), vld1q_f32(&p[3].rotation), rot, ax,
+               ay, tail);
+
+    // 整组无旋转时跳过 sin/cos
+    float32x4_t vs = vdupq_n_f32(0.0f), vc = vdupq_n_f32(1.0f);
+    if (vmaxvq_f32(vabsq_f32(rot)) != 0.0f) {
+      sinCos4(rot, vs, vc);
+    }
+
+    float32x4_t rx0 = vnegq_f32(vmulq_f32(sx, ax));
+    float32x4_t ry0 = vnegq_f32(vmulq_f32(sy, ay));
+    float32x4_t rx1 = vaddq_f32(sx, rx0);
+    float32x4_t ry1 = vaddq_f32(sy, ry0);
+
+    float32x4_t rx0c = vmulq_f32(rx0, vc), rx0s = vmulq_f32(rx0, vs);
+    float32x4_t rx1c = vmulq_f32(rx1, vc), rx1s = vmulq_f32(rx1, vs);
+    float32x4_t ry0c = vmulq_f32(ry0, vc), ry0s = vmulq_f32(ry0, vs);
+    float32x4_t ry1c = vmulq_f32(ry1, vc), ry1s = vmulq_f32(ry1, vs);
+
+    float32x4_t x0 = vsubq_f32(vaddq_f32(px, rx0c), ry0s);
+    float32x4_t x1 = vsubq_f32(vaddq_f32(px, rx1c), ry0s);
+    float32x4_t x2 = vsubq_f32(vaddq_f32(px, rx1c), ry1s);
+    float32x4_t x3 = vsubq_f32(vaddq_f32(px, rx0c), ry1s);
+    float32x4_t y0 = vaddq_f32(vaddq_f32(py, rx0s), ry0c);
+    float32x4_t y1 = vaddq_f32(vaddq_f32(py, rx1s), ry0c);
+    float32x4_t y2 = vaddq_f32(vaddq_f32(py, rx1s), ry1c);
+    float32x4_t y3 = vaddq_f32(vaddq_f32(py, rx0s), ry1c);
+
+    storeTransposed4(x0, x1, x2, x3, out + i, true);
+    storeTransposed4(y0, y1, y2, y3, out + i, false);
+  }
+  computeSpriteCornersScalar(sp + i, count - i, out + i);
+}
+#endif
+
+// ============================================================================
+// 运行时分发
+// ============================================================================
+using CornerKernelFn = void (*)(const SpriteData *, size_t, SpriteCorners *);
+
+struct CornerKernel {
+  CornerKernelFn fn;
+  const char *name;
+};
+
+/**
+ * @brief 选择当前 CPU 可用的最快实现（首次调用时确定）
+ */
+static const CornerKernel &selectKernel() {
+  static const CornerKernel kernel = []() -> CornerKernel {
+#if defined(E2D_SPRITE_KERNEL_AVX2)
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) {
+      return {computeSpriteCornersAVX2, "AVX2"};
+    }
+#endif
+#if defined(E2D_SPRITE_KERNEL_SSE2)
+    return {computeSpriteCornersSSE2, "SSE2"};
+#elif defined(E2D_SPRITE_KERNEL_NEON)
+    return {computeSpriteCornersNEON, "NEON"};
+#else
+    return {computeSpriteCornersScalar, "Scalar"};
+#endif
+  }();
+  return kernel;
+}
+
+void computeSpriteCorners(const SpriteData *sprites, size_t count,
+                          SpriteCorners *out) {
+  selectKernel().fn(sprites, count, out);
+}
+
+const char *getSpriteKernelName() { return selectKernel().name; }
+
+} // namespace extra2d
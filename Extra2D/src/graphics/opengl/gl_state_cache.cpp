@@ -0,0 +1,198 @@
+#include <extra2d/graphics/opengl/gl_state_cache.h>
+
+namespace extra2d {
+
+/**
+ * @brief 构造函数，初始状态全部视为未知
+ */
+GLStateCache::GLStateCache() { invalidate(); }
+
+/**
+ * @brief 获取GLStateCache单例实例
+ * @return GLStateCache单例的引用
+ */
+GLStateCache &GLStateCache::get() {
+  static GLStateCache instance;
+  return instance;
+}
+
+/**
+ * @brief 使用着色器程序
+ * @param program 程序对象，0 表示解绑
+ */
+void GLStateCache::useProgram(GLuint program) {
+  if (program_ == program) {
+    counters_.redundantSkipped++;
+    return;
+  }
+  glUseProgram(program);
+  program_ = program;
+  counters_.shaderBinds++;
+}
+
+/**
+ * @brief 绑定顶点数组对象
+ * @param vao VAO，0 表示解绑
+ */
+void GLStateCache::bindVertexArray(GLuint vao) {
+  if (vao_ == vao) {
+    counters_.redundantSkipped++;
+    return;
+  }
+  glBindVertexArray(vao);
+  vao_ = vao;
+  // 索引缓冲绑定记录在 VAO 内，换 VAO 后不再可知
+  elementBuffer_ = UNKNOWN;
+  counters_.vertexArrayBinds++;
+}
+
+/**
+ * @brief 绑定缓冲区对象
+ * @param target 缓冲区目标
+ * @param buffer 缓冲区，0 表示解绑
+ */
+void GLStateCache::bindBuffer(GLenum target, GLuint buffer) {
+  GLuint *cached = nullptr;
+  if (target == GL_ARRAY_BUFFER) {
+    cached = &arrayBuffer_;
+  } else if (target == GL_ELEMENT_ARRAY_BUFFER) {
+    cached = &elementBuffer_;
+  }
+
+  if (cached != nullptr && *cached == buffer) {
+    counters_.redundantSkipped++;
+    return;
+  }
+  glBindBuffer(target, buffer);
+  if (cached != nullptr) {
+    *cached = buffer;
+  }
+  counters_.bufferBinds++;
+}
+
+/**
+ * @brief 绑定二维纹理到纹理单元
+ * @param unit 纹理单元索引
+ * @param texture 纹理对象，0 表示解绑
+ */
+void GLStateCache::bindTexture(uint32_t unit, GLuint texture) {
+  bool tracked = unit < MAX_TEXTURE_UNITS;
+  if (tracked && textures_[unit] == texture) {
+    counters_.redundantSkipped++;
+    return;
+  }
+  if (activeUnit_ != unit) {
+    glActiveTexture(GL_TEXTURE0 + unit);
+    activeUnit_ = unit;
+  }
+  glBindTexture(GL_TEXTURE_2D, texture);
+  if (tracked) {
+    textures_[unit] = texture;
+  }
+  counters_.textureBinds++;
+}
+
+/**
+ * @brief 设置混合状态
+ * @param enabled 是否启用混合
+ * @param srcFactor 源因子（禁用时忽略）
+ * @param dstFactor 目标因子（禁用时忽略）
+ */
+void GLStateCache::setBlend(bool enabled, GLenum srcFactor, GLenum dstFactor) {
+  int state = enabled ? 1 : 0;
+  bool changed = false;
+  if (blendEnabled_ != state) {
+    if (enabled) {
+      glEnable(GL_BLEND);
+    } else {
+      glDisable(GL_BLEND);
+    }
+    blendEnabled_ = state;
+    changed = true;
+  }
+  if (enabled && (blendSrc_ != srcFactor || blendDst_ != dstFactor)) {
+    glBlendFunc(srcFactor, dstFactor);
+    blendSrc_ = srcFactor;
+    blendDst_ = dstFactor;
+    changed = true;
+  }
+  if (!changed) {
+    counters_.redundantSkipped++;
+  }
+}
+
+/**
+ * @brief 设置视口
+ */
+void GLStateCache::setViewport(GLint x, GLint y, GLsizei width,
+                               GLsizei height) {
+  if (viewportKnown_ && viewport_[0] == x && viewport_[1] == y &&
+      viewport_[2] == width && viewport_[3] == height) {
+    counters_.redundantSkipped++;
+    return;
+  }
+  glViewport(x, y, width, height);
+  viewport_ = {x, y, width, height};
+  viewportKnown_ = true;
+}
+
+/**
+ * @brief 程序对象被删除
+ */
+void GLStateCache::onProgramDeleted(GLuint program) {
+  if (program_ == program) {
+    program_ = 0;
+  }
+}
+
+/**
+ * @brief VAO 被删除
+ */
+void GLStateCache::onVertexArrayDeleted(GLuint vao) {
+  if (vao_ == vao) {
+    vao_ = 0;
+    elementBuffer_ = UNKNOWN;
+  }
+}
+
+/**
+ * @brief 缓冲区被删除
+ */
+void GLStateCache::onBufferDeleted(GLuint buffer) {
+  if (arrayBuffer_ == buffer) {
+    arrayBuffer_ = 0;
+  }
+  if (elementBuffer_ == buffer) {
+    elementBuffer_ = 0;
+  }
+}
+
+/**
+ * @brief 纹理被删除
+ */
+void GLStateCache::onTextureDeleted(GLuint texture) {
+  for (auto &bound : textures_) {
+    if (bound == texture) {
+      bound = 0;
+    }
+  }
+}
+
+/**
+ * @brief 令全部缓存失效
+ */
+void GLStateCache::invalidate() {
+  program_ = UNKNOWN;
+  vao_ = UNKNOWN;
+  arrayBuffer_ = UNKNOWN;
+  elementBuffer_ = UNKNOWN;
+  activeUnit_ = UNKNOWN;
+  textures_.fill(UNKNOWN);
+  blendEnabled_ = -1;
+  blendSrc_ = UNKNOWN;
+  blendDst_ = UNKNOWN;
+  viewport_ = {0, 0, 0, 0};
+  viewportKnown_ = false;
+}
+
+} // namespace extra2d
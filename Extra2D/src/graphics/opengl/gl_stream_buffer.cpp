@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <extra2d/graphics/opengl/gl_state_cache.h>
+#include <extra2d/graphics/opengl/gl_stream_buffer.h>
+#include <extra2d/graphics/vram_manager.h>
+#include <extra2d/utils/logger.h>
+
+namespace extra2d {
+
+// 围栏等待的单次超时（纳秒）
+static constexpr GLuint64 FENCE_WAIT_TIMEOUT_NS = 1000000;
+
+/**
+ * @brief 将偏移向上对齐
+ * @param value 原始偏移
+ * @param alignment 对齐值
+ * @return 对齐后的偏移
+ */
+static size_t alignUp(size_t value, size_t alignment) {
+  if (alignment <= 1) {
+    return value;
+  }
+  return (value + alignment - 1) / alignment * alignment;
+}
+
+/**
+ * @brief 获取上传模式名称（用于日志）
+ * @param mode 上传模式
+ * @return 模式名称
+ */
+static const char *streamModeName(VertexStreamMode mode) {
+  switch (mode) {
+  case VertexStreamMode::Orphan:
+    return "orphan";
+  case VertexStreamMode::RingBuffer:
+    return "ring";
+  case VertexStreamMode::SubData:
+  default:
+    return "subdata";
+  }
+}
+
+/**
+ * @brief 构造函数，初始化成员变量
+ */
+GLStreamBuffer::GLStreamBuffer()
+    : buffer_(0), target_(GL_ARRAY_BUFFER), mode_(VertexStreamMode::SubData),
+      capacity_(0), size_(0), head_(0), mapOffset_(0), mapped_(nullptr),
+      persistentPtr_(nullptr) {
+  fences_.fill(nullptr);
+  acquired_.fill(false);
+}
+
+/**
+ * @brief 析构函数，释放缓冲区
+ */
+GLStreamBuffer::~GLStreamBuffer() { shutdown(); }
+
+/**
+ * @brief 创建缓冲区并按模式分配存储
+ * @param target 缓冲区目标
+ * @param capacity 单次 map 的最大字节数，应为顶点步长的整数倍
+ * @param mode 上传模式
+ * @return 成功返回 true
+ */
+bool GLStreamBuffer::init(GLenum target, size_t capacity,
+                          VertexStreamMode mode) {
+  shutdown();
+
+  target_ = target;
+  capacity_ = capacity;
+  mode_ = mode;
+  head_ = 0;
+  acquired_.fill(false);
+
+  glGenBuffers(1, &buffer_);
+  GLStateCache::get().bindBuffer(target_, buffer_);
+
+  switch (mode_) {
+  case VertexStreamMode::SubData:
+    size_ = capacity_;
+    staging_.resize(capacity_);
+    glBufferData(target_, static_cast<GLsizeiptr>(size_), nullptr,
+                 GL_DYNAMIC_DRAW);
+    break;
+
+  case VertexStreamMode::Orphan:
+    size_ = capacity_ * RING_SECTIONS;
+    glBufferData(target_, static_cast<GLsizeiptr>(size_), nullptr,
+                 GL_STREAM_DRAW);
+    break;
+
+  case VertexStreamMode::RingBuffer:
+    size_ = capacity_ * RING_SECTIONS;
+    // 优先使用不可变存储 + 持久一致映射，写入后无需 unmap
+    if (GLAD_GL_EXT_buffer_storage && glBufferStorageEXT) {
+      GLbitfield flags =
+          GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT_EXT | GL_MAP_COHERENT_BIT_EXT;
+      glBufferStorageEXT(target_, static_cast<GLsizeiptr>(size_), nullptr,
+                         flags);
+      persistentPtr_ = static_cast<uint8_t *>(
+          glMapBufferRange(target_, 0, static_cast<GLsizeiptr>(size_), flags));
+      if (persistentPtr_ == nullptr) {
+        // 不可变存储无法重新分配，重建缓冲区后退回普通映射
+        E2D_LOG_WARN("Persistent mapping failed, falling back to "
+                     "unsynchronized mapping");
+        GLStateCache::get().onBufferDeleted(buffer_);
+        glDeleteBuffers(1, &buffer_);
+        glGenBuffers(1, &buffer_);
+        GLStateCache::get().bindBuffer(target_, buffer_);
+      }
+    }
+    if (persistentPtr_ == nullptr) {
+      glBufferData(target_, static_cast<GLsizeiptr>(size_), nullptr,
+                   GL_STREAM_DRAW);
+    }
+    break;
+  }
+
+  VRAMMgr::get().allocBuffer(size_);
+
+  E2D_LOG_INFO("GLStreamBuffer created: {} KB, mode={}{}", size_ / 1024,
+               streamModeName(mode_), persistentPtr_ ? " (persistent)" : "");
+  return true;
+}
+
+/**
+ * @brief 释放缓冲区、映射与围栏
+ */
+void GLStreamBuffer::shutdown() {
+  if (buffer_ == 0) {
+    return;
+  }
+
+  if (mapped_ != nullptr) {
+    unmap(0);
+  }
+
+  for (auto &fence : fences_) {
+    if (fence != nullptr) {
+      glDeleteSync(fence);
+      fence = nullptr;
+    }
+  }
+  acquired_.fill(false);
+
+  if (persistentPtr_ != nullptr) {
+    GLStateCache::get().bindBuffer(target_, buffer_);
+    glUnmapBuffer(target_);
+    persistentPtr_ = nullptr;
+  }
+
+  GLStateCache::get().onBufferDeleted(buffer_);
+  glDeleteBuffers(1, &buffer_);
+  buffer_ = 0;
+  VRAMMgr::get().freeBuffer(size_);
+
+  staging_.clear();
+  staging_.shrink_to_fit();
+  size_ = 0;
+  head_ = 0;
+}
+
+/**
+ * @brief 预留一段可写内存
+ * @param bytes 本次最多写入的字节数
+ * @param alignment 起始偏移对齐
+ * @return 可写内存指针，失败返回 nullptr
+ */
+void *GLStreamBuffer::map(size_t bytes, size_t alignment) {
+  if (buffer_ == 0 || bytes == 0 || bytes > capacity_) {
+    return nullptr;
+  }
+  if (mapped_ != nullptr) {
+    return mapped_;
+  }
+
+  size_t offset = 0;
+
+  switch (mode_) {
+  case VertexStreamMode::SubData:
+    mapped_ = staging_.data();
+    break;
+
+  case VertexStreamMode::Orphan: {
+    GLStateCache::get().bindBuffer(target_, buffer_);
+    offset = alignUp(head_, alignment);
+    if (offset + bytes > size_) {
+      // 缓冲区写满：孤立旧存储，驱动会在 GPU 用完后回收
+      glBufferData(target_, static_cast<GLsizeiptr>(size_), nullptr,
+                   GL_STREAM_DRAW);
+      offset = 0;
+    }
+    mapped_ = static_cast<uint8_t *>(glMapBufferRange(
+        target_, static_cast<GLintptr>(offset), static_cast<GLsizeiptr>(bytes),
+        GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+            GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT));
+    break;
+  }
+
+  case VertexStreamMode::RingBuffer: {
+    // 只预留本次可能写入的范围，unmap 后按实际写入量前移，
+    // 小批次连续排列在同一段内而不是每次占用一整段
+    offset = alignUp(head_, alignment);
+    if (offset + bytes > size_) {
+      retireSections(RING_SECTIONS);
+      offset = 0;
+    }
+    retireSections(offset / capacity_);
+    acquireSections(offset, offset + bytes);
+    if (persistentPtr_ != nullptr) {
+      mapped_ = persistentPtr_ + offset;
+    } else {
+      GLStateCache::get().bindBuffer(target_, buffer_);
+      mapped_ = static_cast<uint8_t *>(glMapBufferRange(
+          target_, static_cast<GLintptr>(offset),
+          static_cast<GLsizeiptr>(bytes),
+          GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT |
+              GL_MAP_UNSYNCHRONIZED_BIT | GL_MAP_FLUSH_EXPLICIT_BIT));
+    }
+    break;
+  }
+  }
+
+  if (mapped_ == nullptr) {
+    E2D_LOG_ERROR("GLStreamBuffer map failed ({} bytes)", bytes);
+    return nullptr;
+  }
+
+  mapOffset_ = offset;
+  return mapped_;
+}
+
+/**
+ * @brief 提交已写入的数据
+ * @param usedBytes 实际写入的字节数
+ * @return 数据在 GPU 缓冲区中的字节偏移
+ */
+size_t GLStreamBuffer::unmap(size_t usedBytes) {
+  if (mapped_ == nullptr) {
+    return 0;
+  }
+
+  switch (mode_) {
+  case VertexStreamMode::SubData:
+    if (usedBytes > 0) {
+      GLStateCache::get().bindBuffer(target_, buffer_);
+      glBufferSubData(target_, 0, static_cast<GLsizeiptr>(usedBytes),
+                      staging_.data());
+    }
+    break;
+
+  case VertexStreamMode::Orphan:
+  case VertexStreamMode::RingBuffer:
+    // 持久一致映射的写入对后续绘制直接可见
+    if (persistentPtr_ == nullptr) {
+      GLStateCache::get().bindBuffer(target_, buffer_);
+      if (usedBytes > 0) {
+        glFlushMappedBufferRange(target_, 0,
+                                 static_cast<GLsizeiptr>(usedBytes));
+      }
+      glUnmapBuffer(target_);
+    }
+    break;
+  }
+
+  mapped_ = nullptr;
+  head_ = mapOffset_ + usedBytes;
+  return mapOffset_;
+}
+
+/**
+ * @brief 为写入位置已越过的段插入围栏
+ * @param end 段索引上界（不含），小于该值且本轮已占用的段被释放
+ *
+ * 读取这些段的绘制调用都已在此前提交，围栏完成即表示 GPU 已读取完毕
+ */
+void GLStreamBuffer::retireSections(size_t end) {
+  for (size_t s = 0; s < end && s < RING_SECTIONS; ++s) {
+    if (!acquired_[s]) {
+      continue;
+    }
+    if (fences_[s] != nullptr) {
+      glDeleteSync(fences_[s]);
+    }
+    fences_[s] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+    acquired_[s] = false;
+  }
+}
+
+/**
+ * @brief 占用字节范围覆盖的段
+ * @param begin 起始偏移
+ * @param end 结束偏移（不含）
+ *
+ * 本轮首次进入某段时等待其上一轮的围栏；同一段内的后续批次不再等待
+ */
+void GLStreamBuffer::acquireSections(size_t begin, size_t end) {
+  size_t last = std::min((end - 1) / capacity_, RING_SECTIONS - 1);
+  for (size_t s = begin / capacity_; s <= last; ++s) {
+    if (!acquired_[s]) {
+      waitFence(s);
+      acquired_[s] = true;
+    }
+  }
+}
+
+/**
+ * @brief 等待指定段的围栏完成并删除
+ * @param section 段索引
+ */
+void GLStreamBuffer::waitFence(size_t section) {
+  GLsync fence = fences_[section];
+  if (fence == nullptr) {
+    return;
+  }
+
+  GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                   FENCE_WAIT_TIMEOUT_NS);
+  while (result == GL_TIMEOUT_EXPIRED) {
+    result = glClientWaitSync(fence, 0, FENCE_WAIT_TIMEOUT_NS);
+  }
+  if (result == GL_WAIT_FAILED) {
+    E2D_LOG_WARN("GLStreamBuffer fence wait failed");
+  }
+
+  glDeleteSync(fence);
+  fences_[section] = nullptr;
+}
+
+} // namespace extra2d
@@ -1,5 +1,6 @@
 #include <extra2d/graphics/opengl/gl_texture.h>
 #include <extra2d/graphics/gpu_context.h>
+#include <extra2d/graphics/opengl/gl_state_cache.h>
 #include <extra2d/graphics/vram_manager.h>
 #define STB_IMAGE_IMPLEMENTATION
 #include <cstring>
@@ -150,11 +151,14 @@ GLTexture::GLTexture(const std::string &filepath)
 
 GLTexture::~GLTexture() {
   if (textureID_ != 0) {
-    // 检查 GPU 上下文是否仍然有效
+    // 纹理可能在非上下文线程析构，删除交给上下文所属线程；
     // 如果 OpenGL 上下文已销毁，则跳过 glDeleteTextures 调用
-    if (GPUContext::get().isValid()) {
-      glDeleteTextures(1, &textureID_);
-    }
+    GPUContext::get().releaseOnOwner([textureID = textureID_] {
+      if (GPUContext::get().isValid()) {
+        GLStateCache::get().onTextureDeleted(textureID);
+        glDeleteTextures(1, &textureID);
+      }
+    });
     // VRAM 跟踪: 释放纹理显存（无论上下文是否有效都需要更新统计）
     if (dataSize_ > 0) {
       VRAMMgr::get().freeTexture(dataSize_);
@@ -163,30 +167,36 @@ GLTexture::~GLTexture() {
 }
 
 void GLTexture::setFilter(bool linear) {
-  bind();
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
-                  linear ? GL_LINEAR : GL_NEAREST);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
-                  linear ? GL_LINEAR : GL_NEAREST);
+  GPUContext::get().runOnOwner([&] {
+    bind();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER,
+                    linear ? GL_LINEAR : GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER,
+                    linear ? GL_LINEAR : GL_NEAREST);
+  });
 }
 
 void GLTexture::setWrap(bool repeat) {
-  bind();
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,
-                  repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
-                  repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE);
+  GPUContext::get().runOnOwner([&] {
+    bind();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S,
+                    repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T,
+                    repeat ? GL_REPEAT : GL_CLAMP_TO_EDGE);
+  });
 }
 
 void GLTexture::bind(unsigned int slot) const {
-  glActiveTexture(GL_TEXTURE0 + slot);
-  glBindTexture(GL_TEXTURE_2D, textureID_);
+  GLStateCache::get().bindTexture(slot, textureID_);
 }
 
 /**
  * @brief 解绑当前纹理
  */
-void GLTexture::unbind() const { glBindTexture(GL_TEXTURE_2D, 0); }
+void GLTexture::unbind() const {
+  auto &state = GLStateCache::get();
+  state.bindTexture(state.getActiveTextureUnit(), 0);
+}
 
 /**
  * @brief 创建OpenGL纹理对象并上传像素数据
@@ -213,24 +223,27 @@ void GLTexture::createTexture(const uint8_t *pixels) {
     format_ = PixelFormat::RGBA8;
   }
 
-  glGenTextures(1, &textureID_);
-  bind();
+  // 纹理可能在非上下文线程（如流水线模式下的主线程）上创建
+  GPUContext::get().runOnOwner([&] {
+    glGenTextures(1, &textureID_);
+    bind();
 
-  GLint prevUnpackAlignment = 4;
-  glGetIntegerv(GL_UNPACK_ALIGNMENT, &prevUnpackAlignment);
-  glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment);
+    GLint prevUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &prevUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, unpackAlignment);
 
-  glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width_, height_, 0, format,
-               GL_UNSIGNED_BYTE, pixels);
-  glPixelStorei(GL_UNPACK_ALIGNMENT, prevUnpackAlignment);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width_, height_, 0, format,
+                 GL_UNSIGNED_BYTE, pixels);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, prevUnpackAlignment);
 
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-  // 使用 NEAREST 过滤器，更适合像素艺术风格的精灵
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    // 使用 NEAREST 过滤器，更适合像素艺术风格的精灵
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
 
-  glGenerateMipmap(GL_TEXTURE_2D);
+    glGenerateMipmap(GL_TEXTURE_2D);
+  });
 
   // VRAM 跟踪
   dataSize_ = static_cast<size_t>(width_ * height_ * channels_);
@@ -324,27 +337,34 @@ bool GLTexture::loadKTX(const std::string &filepath) {
     return false;
   }
 
-  // 创建 GL 纹理
-  glGenTextures(1, &textureID_);
-  bind();
+  // 创建 GL 纹理（在上下文所属线程上）
+  GLenum err = GL_NO_ERROR;
+  GPUContext::get().runOnOwner([&] {
+    glGenTextures(1, &textureID_);
+    bind();
 
-  glCompressedTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width_, height_, 0,
-                         static_cast<GLsizei>(imageSize),
-                         compressedData.data());
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width_, height_,
+                           0, static_cast<GLsizei>(imageSize),
+                           compressedData.data());
+
+    err = glGetError();
+    if (err != GL_NO_ERROR) {
+      GLStateCache::get().onTextureDeleted(textureID_);
+      glDeleteTextures(1, &textureID_);
+      textureID_ = 0;
+      return;
+    }
 
-  GLenum err = glGetError();
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  });
   if (err != GL_NO_ERROR) {
     E2D_LOG_ERROR("glCompressedTexImage2D failed for KTX: {:#06x}", err);
-    glDeleteTextures(1, &textureID_);
-    textureID_ = 0;
     return false;
   }
 
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
   // VRAM 跟踪
   dataSize_ = imageSize;
   VRAMMgr::get().allocTexture(dataSize_);
@@ -428,27 +448,34 @@ bool GLTexture::loadDDS(const std::string &filepath) {
     return false;
   }
 
-  // 创建 GL 纹理
-  glGenTextures(1, &textureID_);
-  bind();
+  // 创建 GL 纹理（在上下文所属线程上）
+  GLenum err = GL_NO_ERROR;
+  GPUContext::get().runOnOwner([&] {
+    glGenTextures(1, &textureID_);
+    bind();
 
-  glCompressedTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width_, height_, 0,
-                         static_cast<GLsizei>(imageSize),
-                         compressedData.data());
+    glCompressedTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width_, height_,
+                           0, static_cast<GLsizei>(imageSize),
+                           compressedData.data());
 
-  GLenum err = glGetError();
+    err = glGetError();
+    if (err != GL_NO_ERROR) {
+      GLStateCache::get().onTextureDeleted(textureID_);
+      glDeleteTextures(1, &textureID_);
+      textureID_ = 0;
+      return;
+    }
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+  });
   if (err != GL_NO_ERROR) {
     E2D_LOG_ERROR("glCompressedTexImage2D failed for DDS: {:#06x}", err);
-    glDeleteTextures(1, &textureID_);
-    textureID_ = 0;
     return false;
   }
 
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-  glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-
   // VRAM 跟踪
   dataSize_ = imageSize;
   VRAMMgr::get().allocTexture(dataSize_);
@@ -0,0 +1,107 @@
+#include <extra2d/graphics/polygon_triangulator.h>
+#include <numeric>
+
+namespace extra2d {
+
+/**
+ * @brief 向量 oa 与 ob 的叉积（正值表示 o->a->b 逆时针，y 轴向上时）
+ */
+static inline float cross(const Vec2 &o, const Vec2 &a, const Vec2 &b) {
+  return (a.x - o.x) * (b.y - o.y) - (a.y - o.y) * (b.x - o.x);
+}
+
+/**
+ * @brief 判断点是否位于三角形内（含边界）
+ * @param sign 多边形环绕方向（+1 / -1），使三条边的叉积同号
+ */
+static inline bool insideTriangle(const Vec2 &p, const Vec2 &a, const Vec2 &b,
+                                  const Vec2 &c, float sign) {
+  return cross(a, b, p) * sign >= 0.0f && cross(b, c, p) * sign >= 0.0f &&
+         cross(c, a, p) * sign >= 0.0f;
+}
+
+/**
+ * @brief 三角剖分一个简单多边形
+ * @param points 顶点数组
+ * @param count 顶点数量
+ * @param indices 输出三角形索引
+ * @return 完整剖分返回 true，退化为扇形补齐时返回 false
+ *
+ * 耳切法：沿剩余环查找凸顶点，且该顶点与相邻两点组成的三角形内
+ * 不含其它剩余顶点，则切下该耳；凸多边形每次首个顶点即为耳，接近线性
+ */
+bool PolygonTriangulator::triangulate(const Vec2 *points, size_t count,
+                                      std::vector<uint32_t> &indices) {
+  indices.clear();
+  if (count < 3) {
+    return false;
+  }
+  indices.reserve((count - 2) * 3);
+
+  // 鞋带公式求有向面积，确定环绕方向
+  float area = 0.0f;
+  for (size_t i = 0, j = count - 1; i < count; j = i++) {
+    area += points[j].x * points[i].y - points[i].x * points[j].y;
+  }
+  const float sign = area >= 0.0f ? 1.0f : -1.0f;
+
+  std::vector<uint32_t> ring(count);
+  std::iota(ring.begin(), ring.end(), 0u);
+
+  size_t n = count;
+  size_t i = 0;
+  size_t misses = 0;
+  bool complete = true;
+
+  while (n > 3) {
+    uint32_t ia = ring[(i + n - 1) % n];
+    uint32_t ib = ring[i];
+    uint32_t ic = ring[(i + 1) % n];
+    const Vec2 &a = points[ia];
+    const Vec2 &b = points[ib];
+    const Vec2 &c = points[ic];
+
+    bool ear = cross(a, b, c) * sign > 0.0f;
+    for (size_t k = 0; ear && k < n; ++k) {
+      uint32_t iv = ring[k];
+      if (iv == ia || iv == ib || iv == ic) {
+        continue;
+      }
+      const Vec2 &v = points[iv];
+      // 与耳的顶点重合的重复点不阻挡切耳
+      if (v == a || v == b || v == c) {
+        continue;
+      }
+      ear = !insideTriangle(v, a, b, c, sign);
+    }
+
+    if (ear) {
+      indices.push_back(ia);
+      indices.push_back(ib);
+      indices.push_back(ic);
+      ring.erase(ring.begin() + static_cast<std::ptrdiff_t>(i));
+      --n;
+      if (i >= n) {
+        i = 0;
+      }
+      misses = 0;
+      continue;
+    }
+
+    // 转完一整圈仍找不到耳（自相交或全部共线），剩余部分按扇形补齐
+    if (++misses > n) {
+      complete = false;
+      break;
+    }
+    i = (i + 1) % n;
+  }
+
+  for (size_t k = 1; k + 1 < n; ++k) {
+    indices.push_back(ring[0]);
+    indices.push_back(ring[k]);
+    indices.push_back(ring[k + 1]);
+  }
+  return complete;
+}
+
+} // namespace extra2d
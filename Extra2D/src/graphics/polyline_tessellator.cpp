@@ -0,0 +1,172 @@
+#include <algorithm>
+#include <cmath>
+#include <extra2d/graphics/polyline_tessellator.h>
+
+namespace extra2d {
+
+// 视为重合点 / 共线的阈值
+static constexpr float POINT_EPSILON = 1e-6f;
+static constexpr float COLLINEAR_EPSILON = 1e-4f;
+// 圆角每段最大张角（弧度）与最大段数
+static constexpr float ROUND_JOIN_STEP = PI_F / 8.0f;
+static constexpr int MAX_ROUND_JOIN_STEPS = 16;
+
+/**
+ * @brief 左法线（方向逆时针旋转 90 度）
+ */
+static inline Vec2 perpendicular(const Vec2 &dir) { return {-dir.y, dir.x}; }
+
+/**
+ * @brief 三角化一条折线
+ * @param points 顶点数组
+ * @param count 顶点数量
+ * @param width 线宽
+ * @param closed 是否首尾相连
+ * @param join 拐角连接方式
+ * @param miterLimit 斜接限制
+ *
+ * 每条线段展开为一个四边形，相邻线段在外侧按 join 补齐拐角；
+ * 内侧重叠部分不做裁剪（不透明绘制时无差异）
+ */
+void PolylineTessellator::tessellate(const Vec2 *points, size_t count,
+                                     float width, bool closed, LineJoin join,
+                                     float miterLimit) {
+  if (points == nullptr || count < 2 || width <= 0.0f) {
+    return;
+  }
+
+  // 去除连续重复点，避免零长度线段产生无效法线
+  points_.clear();
+  for (size_t i = 0; i < count; ++i) {
+    if (points_.empty() ||
+        (points[i] - points_.back()).lengthSquared() > POINT_EPSILON) {
+      points_.push_back(points[i]);
+    }
+  }
+  if (closed && points_.size() > 2 &&
+      (points_.front() - points_.back()).lengthSquared() <= POINT_EPSILON) {
+    points_.pop_back();
+  }
+
+  size_t n = points_.size();
+  if (n < 2) {
+    return;
+  }
+  if (n < 3) {
+    closed = false;
+  }
+
+  float halfWidth = width * 0.5f;
+  size_t segmentCount = closed ? n : n - 1;
+
+  for (size_t i = 0; i < segmentCount; ++i) {
+    const Vec2 &p0 = points_[i];
+    const Vec2 &p1 = points_[(i + 1) % n];
+    Vec2 dir = (p1 - p0).normalized();
+    Vec2 offset = perpendicular(dir) * halfWidth;
+    addQuad(p0 + offset, p1 + offset, p1 - offset, p0 - offset);
+
+    // 在 p1 处连接下一条线段
+    bool hasNext = closed || i + 1 < segmentCount;
+    if (hasNext) {
+      const Vec2 &p2 = points_[(i + 2) % n];
+      Vec2 nextDir = (p2 - p1).normalized();
+      addJoin(p1, dir, nextDir, halfWidth, join, miterLimit);
+    }
+  }
+}
+
+/**
+ * @brief 三角化单条线段
+ * @param start 起点
+ * @param end 终点
+ * @param width 线宽
+ */
+void PolylineTessellator::tessellateSegment(const Vec2 &start, const Vec2 &end,
+                                            float width) {
+  Vec2 delta = end - start;
+  if (width <= 0.0f || delta.lengthSquared() <= POINT_EPSILON) {
+    return;
+  }
+  Vec2 offset = perpendicular(delta.normalized()) * (width * 0.5f);
+  addQuad(start + offset, end + offset, end - offset, start - offset);
+}
+
+/**
+ * @brief 在拐点外侧补齐两条线段之间的缺口
+ * @param pivot 拐点
+ * @param dirIn 入线段方向（单位向量）
+ * @param dirOut 出线段方向（单位向量）
+ * @param halfWidth 半线宽
+ * @param join 连接方式
+ * @param miterLimit 斜接限制
+ */
+void PolylineTessellator::addJoin(const Vec2 &pivot, const Vec2 &dirIn,
+                                  const Vec2 &dirOut, float halfWidth,
+                                  LineJoin join, float miterLimit) {
+  float turn = dirIn.cross(dirOut);
+  if (std::fabs(turn) < COLLINEAR_EPSILON && dirIn.dot(dirOut) > 0.0f) {
+    return; // 共线，无缺口
+  }
+
+  // 向左转时缺口在右侧，反之在左侧
+  float side = turn > 0.0f ? -1.0f : 1.0f;
+  Vec2 normalIn = perpendicular(dirIn) * side;
+  Vec2 normalOut = perpendicular(dirOut) * side;
+  Vec2 outerIn = pivot + normalIn * halfWidth;
+  Vec2 outerOut = pivot + normalOut * halfWidth;
+
+  switch (join) {
+  case LineJoin::Miter: {
+    Vec2 miter = (normalIn + normalOut).normalized();
+    float cosHalf = miter.dot(normalIn);
+    // 斜接长度 / 半线宽 = 1 / cos(半角)
+    if (cosHalf * miterLimit > 1.0f) {
+      Vec2 tip = pivot + miter * (halfWidth / cosHalf);
+      addQuad(pivot, outerIn, tip, outerOut);
+      return;
+    }
+    addQuad(pivot, outerIn, outerOut, outerOut);
+    return;
+  }
+
+  case LineJoin::Round: {
+    float cosAngle = std::clamp(normalIn.dot(normalOut), -1.0f, 1.0f);
+    float angle = std::acos(cosAngle);
+    int steps = static_cast<int>(std::ceil(angle / ROUND_JOIN_STEP));
+    steps = std::clamp(steps, 1, MAX_ROUND_JOIN_STEPS);
+
+    // 沿外侧短弧从 outerIn 旋转到 outerOut；180 度折返时经过入线段前方
+    float rotation = normalIn.cross(normalOut);
+    if (std::fabs(rotation) < COLLINEAR_EPSILON) {
+      rotation = normalIn.cross(dirIn);
+    }
+    float step = (rotation >= 0.0f ? angle : -angle) / static_cast<float>(steps);
+    float c = std::cos(step);
+    float s = std::sin(step);
+
+    // 扇形每两个三角形打包为一个四边形
+    Vec2 prev = normalIn * halfWidth;
+    for (int i = 0; i < steps; i += 2) {
+      Vec2 next = {prev.x * c - prev.y * s, prev.x * s + prev.y * c};
+      if (i + 1 < steps) {
+        Vec2 after = {next.x * c - next.y * s, next.x * s + next.y * c};
+        bool last = i + 2 >= steps;
+        addQuad(pivot, pivot + prev, pivot + next,
+                last ? outerOut : pivot + after);
+        prev = after;
+      } else {
+        addQuad(pivot, pivot + prev, outerOut, outerOut);
+      }
+    }
+    return;
+  }
+
+  case LineJoin::Bevel:
+  default:
+    addQuad(pivot, outerIn, outerOut, outerOut);
+    return;
+  }
+}
+
+} // namespace extra2d
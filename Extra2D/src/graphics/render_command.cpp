@@ -1,206 +1,223 @@
 #include <extra2d/graphics/render_command.h>
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <utility>
 
 namespace extra2d {
 
 // ============================================================================
-// RenderCommand 便捷构造函数
+// RenderCommandBuffer 实现
 // ============================================================================
 
 /**
- * @brief 创建精灵渲染命令
+ * @brief 默认构造函数
  *
- * 创建一个用于渲染2D精灵的RenderCommand对象，包含纹理、目标区域、源区域、
- * 着色、旋转、锚点和层级等信息
+ * 初始化渲染命令缓冲区，预留初始容量
+ */
+RenderCommandBuffer::RenderCommandBuffer() : nextOrder_(0) {
+  commands_.reserve(INITIAL_CAPACITY);
+}
+
+/**
+ * @brief 析构函数
+ *
+ * 释放渲染命令缓冲区资源
+ */
+RenderCommandBuffer::~RenderCommandBuffer() = default;
+
+/**
+ * @brief 添加精灵渲染命令
  *
  * @param tex 指向纹理对象的指针
- * @param dest 目标渲染区域
+ * @param dest 目标渲染区域（位于 transform 的局部空间）
  * @param src 源纹理区域
  * @param tint 着色颜色
  * @param rot 旋转角度（弧度）
  * @param anc 锚点位置（0.0-1.0范围）
  * @param lyr 渲染层级
- * @return 配置好的RenderCommand对象
+ * @param transform 世界变换
  */
-RenderCommand RenderCommand::makeSprite(const Texture* tex, const Rect& dest, 
-                                         const Rect& src, const Color& tint,
-                                         float rot, const Vec2& anc,
-                                         uint32_t lyr) {
-  RenderCommand cmd;
-  cmd.type = RenderCommandType::Sprite;
-  cmd.layer = lyr;
-  cmd.transform = glm::mat4(1.0f);
-  
-  SpriteCommandData data;
-  data.texture = tex;
-  data.destRect = dest;
-  data.srcRect = src;
-  data.tint = tint;
-  data.rotation = rot;
-  data.anchor = anc;
-  // 生成排序键：纹理指针的高位 + 层级的低位
-  data.sortKey = (reinterpret_cast<uintptr_t>(tex) >> 4) & 0xFFFFFFF0;
-  data.sortKey |= (lyr & 0xF);
-  
-  cmd.data = data;
-  return cmd;
+void RenderCommandBuffer::addSprite(const Texture* tex, const Rect& dest,
+                                    const Rect& src, const Color& tint,
+                                    float rot, const Vec2& anc, int32_t lyr,
+                                    const Affine2D& transform) {
+  add(RenderCommandType::Sprite, lyr, transform,
+      SpriteCommandData{tex, dest, src, tint, rot, anc});
 }
 
 /**
- * @brief 创建线段渲染命令
- *
- * 创建一个用于渲染线段的RenderCommand对象
+ * @brief 添加线段渲染命令
  *
  * @param s 线段起点坐标
  * @param e 线段终点坐标
  * @param c 线段颜色
  * @param w 线段宽度
  * @param lyr 渲染层级
- * @return 配置好的RenderCommand对象
+ * @param transform 世界变换
  */
-RenderCommand RenderCommand::makeLine(const Vec2& s, const Vec2& e, const Color& c, 
-                                       float w, uint32_t lyr) {
-  RenderCommand cmd;
-  cmd.type = RenderCommandType::Line;
-  cmd.layer = lyr;
-  cmd.transform = glm::mat4(1.0f);
-  
-  LineCommandData data;
-  data.start = s;
-  data.end = e;
-  data.color = c;
-  data.width = w;
-  
-  cmd.data = data;
-  return cmd;
+void RenderCommandBuffer::addLine(const Vec2& s, const Vec2& e, const Color& c,
+                                  float w, int32_t lyr,
+                                  const Affine2D& transform) {
+  add(RenderCommandType::Line, lyr, transform, LineCommandData{s, e, c, w});
 }
 
 /**
- * @brief 创建矩形渲染命令
- *
- * 创建一个用于渲染矩形的RenderCommand对象，可选择填充或描边模式
+ * @brief 添加矩形渲染命令，可选择填充或描边模式
  *
  * @param r 矩形区域
  * @param c 矩形颜色
  * @param w 线条宽度（仅描边模式有效）
  * @param fill 是否填充矩形
  * @param lyr 渲染层级
- * @return 配置好的RenderCommand对象
+ * @param transform 世界变换
  */
-RenderCommand RenderCommand::makeRect(const Rect& r, const Color& c, 
-                                       float w, bool fill, uint32_t lyr) {
-  RenderCommand cmd;
-  cmd.type = fill ? RenderCommandType::FilledRect : RenderCommandType::Rect;
-  cmd.layer = lyr;
-  cmd.transform = glm::mat4(1.0f);
-  
-  RectCommandData data;
-  data.rect = r;
-  data.color = c;
-  data.width = w;
-  data.filled = fill;
-  
-  cmd.data = data;
-  return cmd;
+void RenderCommandBuffer::addRect(const Rect& r, const Color& c, float w,
+                                  bool fill, int32_t lyr,
+                                  const Affine2D& transform) {
+  add(fill ? RenderCommandType::FilledRect : RenderCommandType::Rect, lyr,
+      transform, RectCommandData{r, c, w, fill});
 }
 
-// ============================================================================
-// RenderCommandBuffer 实现
-// ============================================================================
-
 /**
- * @brief 默认构造函数
+ * @brief 追加另一缓冲区的全部命令
  *
- * 初始化渲染命令缓冲区，预留初始容量
+ * 命令头按 other 的提交顺序追加并重新编号，负载不拷贝
+ *
+ * @param other 来源缓冲区
  */
-RenderCommandBuffer::RenderCommandBuffer() : nextOrder_(0) {
-  commands_.reserve(INITIAL_CAPACITY);
+void RenderCommandBuffer::append(const RenderCommandBuffer& other) {
+  commands_.reserve(commands_.size() + other.commands_.size());
+  for (const RenderCommand& cmd : other.commands_) {
+    commands_.push_back(cmd);
+    commands_.back().order = nextOrder_++;
+  }
+  cullStats_ += other.cullStats_;
+  retained_.insert(retained_.end(), other.retained_.begin(),
+                   other.retained_.end());
+  sortedOrder_.clear();
 }
 
 /**
- * @brief 析构函数
- *
- * 释放渲染命令缓冲区资源
+ * @brief 将顶点拷贝到帧内存
+ * @param points 顶点数组
+ * @param count 顶点数
+ * @return 帧内存中的顶点，clear() 前有效
  */
-RenderCommandBuffer::~RenderCommandBuffer() = default;
+const Vec2* RenderCommandBuffer::copyPoints(const Vec2* points, size_t count) {
+  Vec2* dst = allocatePoints(count);
+  std::copy(points, points + count, dst);
+  return dst;
+}
 
 /**
- * @brief 添加渲染命令（左值引用版本）
- *
- * 将渲染命令以拷贝方式添加到缓冲区，自动分配顺序号
- *
- * @param cmd 要添加的渲染命令
+ * @brief 在帧内存中分配顶点
+ * @param count 顶点数
+ * @return 未初始化的顶点数组，clear() 前有效
  */
-void RenderCommandBuffer::addCommand(const RenderCommand& cmd) {
-  if (commands_.size() >= MAX_CAPACITY) {
-    // 缓冲区已满，可能需要立即刷新
-    return;
-  }
-  
-  RenderCommand copy = cmd;
-  copy.order = nextOrder_++;
-  commands_.push_back(std::move(copy));
+Vec2* RenderCommandBuffer::allocatePoints(size_t count) {
+  return arena_.allocateArray<Vec2>(count);
 }
 
 /**
- * @brief 添加渲染命令（右值引用版本）
- *
- * 将渲染命令以移动方式添加到缓冲区，自动分配顺序号
- *
- * @param cmd 要添加的渲染命令（右值引用）
+ * @brief 将索引拷贝到帧内存
+ * @param indices 索引数组
+ * @param count 索引数
+ * @return 帧内存中的索引，clear() 前有效
  */
-void RenderCommandBuffer::addCommand(RenderCommand&& cmd) {
-  if (commands_.size() >= MAX_CAPACITY) {
-    return;
-  }
-  
-  cmd.order = nextOrder_++;
-  commands_.push_back(std::move(cmd));
+const uint32_t* RenderCommandBuffer::copyIndices(const uint32_t* indices,
+                                                 size_t count) {
+  uint32_t* dst = arena_.allocateArray<uint32_t>(count);
+  std::copy(indices, indices + count, dst);
+  return dst;
 }
 
 /**
- * @brief 原地构造渲染命令
- *
- * 在缓冲区中直接构造一个渲染命令对象，避免额外的拷贝或移动操作
- *
- * @return 新构造的渲染命令对象的引用
+ * @brief 将文字拷贝到帧内存
+ * @param text 文字内容
+ * @return 以 '\0' 结尾的字符串，clear() 前有效
  */
-RenderCommand& RenderCommandBuffer::emplaceCommand() {
-  if (commands_.size() >= MAX_CAPACITY) {
-    // 如果已满，返回一个虚拟命令（不应该发生）
-    static RenderCommand dummy;
-    return dummy;
-  }
-  
-  commands_.emplace_back();
-  commands_.back().order = nextOrder_++;
-  return commands_.back();
+const char* RenderCommandBuffer::copyText(const std::string& text) {
+  char* dst = arena_.allocateArray<char>(text.size() + 1);
+  std::memcpy(dst, text.c_str(), text.size() + 1);
+  return dst;
 }
 
 /**
  * @brief 对渲染命令进行排序
  *
- * 按层级、命令类型、纹理/材质和提交顺序对命令进行排序，
- * 以优化渲染性能和批处理效率
+ * 先为每条命令生成 64 位排序键，对 (键, 下标) 对做 LSD 基数排序，
+ * 结果写入 sortedOrder_；排序只读取命令头，不比较、不搬移命令本身。
+ * 基数排序是稳定的，相同键的命令保持提交顺序
  */
 void RenderCommandBuffer::sortCommands() {
-  // 按以下优先级排序：
-  // 1. 层级 (layer) - 低层级先渲染
-  // 2. 命令类型 - 精灵类命令优先批处理
-  // 3. 纹理/材质 - 相同纹理的精灵连续渲染
-  // 4. 提交顺序 - 保证稳定性
-  
-  std::sort(commands_.begin(), commands_.end(), compareCommands);
+  const size_t count = commands_.size();
+  sortedOrder_.resize(count);
+  if (count < 2) {
+    if (count == 1) {
+      sortedOrder_[0] = 0;
+    }
+    return;
+  }
+
+  sortEntries_.resize(count);
+  sortScratch_.resize(count);
+
+  // 先生成键并求出在各命令间有差异的位：恒定的位（未使用的字段、
+  // 单一层级等）不参与排序，每趟 8 位的窗口从最低的有差异位开始
+  uint64_t firstKey = RenderSortKey::fromCommand(commands_[0]);
+  uint64_t varyingBits = 0;
+  for (size_t i = 0; i < count; ++i) {
+    uint64_t key = RenderSortKey::fromCommand(commands_[i]);
+    sortEntries_[i] = {key, static_cast<uint32_t>(i)};
+    varyingBits |= key ^ firstKey;
+  }
+
+  SortEntry *src = sortEntries_.data();
+  SortEntry *dst = sortScratch_.data();
+  uint32_t histogram[256];
+  int shift = 0;
+  while (varyingBits != 0) {
+    while (((varyingBits >> shift) & 1) == 0) {
+      ++shift;
+    }
+    varyingBits &= shift < 56 ? ~(0xFFull << shift) : ((1ull << shift) - 1);
+
+    std::memset(histogram, 0, sizeof(histogram));
+    for (size_t i = 0; i < count; ++i) {
+      histogram[(src[i].key >> shift) & 0xFF]++;
+    }
+    uint32_t offset = 0;
+    for (int digit = 0; digit < 256; ++digit) {
+      uint32_t n = histogram[digit];
+      histogram[digit] = offset;
+      offset += n;
+    }
+    for (size_t i = 0; i < count; ++i) {
+      dst[histogram[(src[i].key >> shift) & 0xFF]++] = src[i];
+    }
+    std::swap(src, dst);
+  }
+
+  for (size_t i = 0; i < count; ++i) {
+    sortedOrder_[i] = src[i].index;
+  }
 }
 
 /**
  * @brief 清空缓冲区
  *
- * 移除所有渲染命令并重置顺序计数器
+ * 移除所有渲染命令与排序结果并回退帧内存，重置顺序计数器，
+ * 释放 retain() 持有的资源；命令头平凡可析构，不逐条析构
  */
 void RenderCommandBuffer::clear() {
   commands_.clear();
+  sortedOrder_.clear();
+  arena_.reset();
   nextOrder_ = 0;
+  retained_.clear();
+  lastRetained_ = nullptr;
+  cullStats_ = CullStats{};
 }
 
 /**
@@ -211,56 +228,50 @@ void RenderCommandBuffer::clear() {
  * @param capacity 要预留的容量大小
  */
 void RenderCommandBuffer::reserve(size_t capacity) {
-  if (capacity <= MAX_CAPACITY) {
-    commands_.reserve(capacity);
+  commands_.reserve(capacity);
+}
+
+// ============================================================================
+// RenderSortKey 实现
+// ============================================================================
+
+/**
+ * @brief 组合排序键
+ * @param layer 渲染层级（可为负，超出 16 位时截断到边界）
+ * @param pass 渲染阶段（4 位）
+ * @param blend 混合模式（4 位）
+ * @param shader 着色器/管线（8 位）
+ * @param texture 纹理排序 ID
+ * @param depth 同层内深度
+ * @return 64 位排序键
+ */
+uint64_t RenderSortKey::make(int32_t layer, uint8_t pass, uint8_t blend,
+                             uint8_t shader, uint16_t texture, uint16_t depth) {
+  if (layer < INT16_MIN) {
+    layer = INT16_MIN;
+  } else if (layer > INT16_MAX) {
+    layer = INT16_MAX;
   }
+  // 加偏移后按无符号比较即为有符号顺序
+  uint64_t biasedLayer = static_cast<uint16_t>(layer - INT16_MIN);
+  return (biasedLayer << LAYER_SHIFT) |
+         (static_cast<uint64_t>(pass & 0xF) << PASS_SHIFT) |
+         (static_cast<uint64_t>(blend & 0xF) << BLEND_SHIFT) |
+         (static_cast<uint64_t>(shader) << SHADER_SHIFT) |
+         (static_cast<uint64_t>(texture) << TEXTURE_SHIFT) | depth;
 }
 
 /**
- * @brief 渲染命令比较函数
- *
- * 用于排序的比较函数，按层级、类型、纹理和顺序进行比较
+ * @brief 由命令头生成排序键
  *
- * @param a 第一个渲染命令
- * @param b 第二个渲染命令
- * @return 如果a应排在b前面返回true，否则返回false
+ * 命令当前不携带混合模式，blend 位为 0；着色器位取命令类型，
+ * 同类命令走同一条后端管线
  */
-bool RenderCommandBuffer::compareCommands(const RenderCommand& a, const RenderCommand& b) {
-  // 首先按层级排序
-  if (a.layer != b.layer) {
-    return a.layer < b.layer;
-  }
-  
-  // 然后按类型排序（精灵类命令放在一起以便批处理）
-  if (a.type != b.type) {
-    // 精灵和文本命令优先（需要纹理）
-    bool aIsSprite = (a.type == RenderCommandType::Sprite || 
-                      a.type == RenderCommandType::Text);
-    bool bIsSprite = (b.type == RenderCommandType::Sprite || 
-                      b.type == RenderCommandType::Text);
-    
-    if (aIsSprite != bIsSprite) {
-      return aIsSprite > bIsSprite; // 精灵类命令在前
-    }
-    
-    return static_cast<uint8_t>(a.type) < static_cast<uint8_t>(b.type);
-  }
-  
-  // 对于精灵命令，按纹理排序
-  if (a.type == RenderCommandType::Sprite && b.type == RenderCommandType::Sprite) {
-    const auto& dataA = std::get<SpriteCommandData>(a.data);
-    const auto& dataB = std::get<SpriteCommandData>(b.data);
-    if (dataA.texture != dataB.texture) {
-      return dataA.texture < dataB.texture;
-    }
-    // 相同纹理时按 sortKey 排序
-    if (dataA.sortKey != dataB.sortKey) {
-      return dataA.sortKey < dataB.sortKey;
-    }
-  }
-  
-  // 最后按提交顺序排序（保证稳定性）
-  return a.order < b.order;
+uint64_t RenderSortKey::fromCommand(const RenderCommand &cmd) {
+  bool textured = cmd.type == RenderCommandType::Sprite ||
+                  cmd.type == RenderCommandType::Text;
+  return make(cmd.layer, textured ? 0 : 1, 0, static_cast<uint8_t>(cmd.type),
+              cmd.textureSortId);
 }
 
 } // namespace extra2d
@@ -0,0 +1,291 @@
+#include <extra2d/graphics/font.h>
+#include <extra2d/graphics/render_backend.h>
+#include <extra2d/graphics/render_command_executor.h>
+
+namespace extra2d {
+
+/**
+ * @brief 判断变换是否为单位变换
+ */
+static bool isIdentity(const Affine2D &t) { return t == Affine2D::identity(); }
+
+/**
+ * @brief 执行命令缓冲区中的全部命令
+ *
+ * 已排序时按 getSortedOrder() 的下标顺序执行，否则按提交顺序
+ *
+ * @param renderer 渲染后端
+ * @param buffer 命令缓冲区
+ */
+void RenderCommandExecutor::execute(RenderBackend &renderer,
+                                    const RenderCommandBuffer &buffer) {
+  if (!buffer.isSorted()) {
+    execute(renderer, buffer.getCommands());
+    return;
+  }
+
+  beginExecute();
+  const auto &commands = buffer.getCommands();
+  for (uint32_t index : buffer.getSortedOrder()) {
+    executeCommand(renderer, commands[index]);
+  }
+  restoreTransform(renderer);
+}
+
+/**
+ * @brief 按顺序执行命令列表
+ * @param renderer 渲染后端
+ * @param commands 已排序的命令列表
+ */
+void RenderCommandExecutor::execute(RenderBackend &renderer,
+                                    const std::vector<RenderCommand> &commands) {
+  beginExecute();
+  for (const auto &cmd : commands) {
+    executeCommand(renderer, cmd);
+  }
+  restoreTransform(renderer);
+}
+
+/**
+ * @brief 重置统计与连续段状态
+ */
+void RenderCommandExecutor::beginExecute() {
+  stats_ = Stats{};
+  runKind_ = RunKind::None;
+  runTexture_ = nullptr;
+}
+
+/**
+ * @brief 按类型分发单条命令
+ */
+void RenderCommandExecutor::executeCommand(RenderBackend &renderer,
+                                           const RenderCommand &cmd) {
+  switch (cmd.type) {
+  case RenderCommandType::Sprite:
+    drawSprite(renderer, cmd);
+    break;
+
+  case RenderCommandType::Text:
+    drawText(renderer, cmd);
+    break;
+
+  case RenderCommandType::None:
+  case RenderCommandType::Custom:
+    stats_.skipped++;
+    break;
+
+  default:
+    if (!drawShape(renderer, cmd)) {
+      stats_.skipped++;
+    }
+    break;
+  }
+}
+
+/**
+ * @brief 记录连续段的切换
+ * @param kind 当前命令所属的段类型
+ * @param texture 精灵段的纹理（其它段为 nullptr）
+ */
+void RenderCommandExecutor::beginRun(RunKind kind, const Texture *texture) {
+  stats_.commands++;
+  if (kind == runKind_ && texture == runTexture_) {
+    return;
+  }
+  runKind_ = kind;
+  runTexture_ = texture;
+  switch (kind) {
+  case RunKind::Sprite:
+    stats_.spriteRuns++;
+    break;
+  case RunKind::Shape:
+    stats_.shapeRuns++;
+    break;
+  case RunKind::Text:
+    stats_.textRuns++;
+    break;
+  case RunKind::None:
+    break;
+  }
+}
+
+/**
+ * @brief 使后端变换栈顶为指定变换
+ *
+ * 与上一次压入的变换相同时不做任何操作；单位矩阵不压栈
+ */
+void RenderCommandExecutor::applyTransform(RenderBackend &renderer,
+                                           const Affine2D &transform) {
+  if (transformPushed_) {
+    if (pushedTransform_ == transform) {
+      return;
+    }
+    renderer.popTransform();
+    transformPushed_ = false;
+  }
+  if (isIdentity(transform)) {
+    return;
+  }
+  renderer.pushTransform(transform);
+  pushedTransform_ = transform;
+  transformPushed_ = true;
+  stats_.transformPushes++;
+}
+
+/**
+ * @brief 弹出执行器压入的变换
+ */
+void RenderCommandExecutor::restoreTransform(RenderBackend &renderer) {
+  if (transformPushed_) {
+    renderer.popTransform();
+    transformPushed_ = false;
+  }
+}
+
+/**
+ * @brief 执行精灵命令
+ *
+ * 命令按仿射方式绘制（目标矩形位于局部空间），负宽高的源矩形保留翻转；
+ * 只有带旋转角的单位变换命令（addSprite 的 rot 参数）按目标矩形与旋转角绘制
+ */
+void RenderCommandExecutor::drawSprite(RenderBackend &renderer,
+                                       const RenderCommand &cmd) {
+  const auto &data = cmd.getData<SpriteCommandData>();
+  if (data.texture == nullptr) {
+    stats_.skipped++;
+    return;
+  }
+  beginRun(RunKind::Sprite, data.texture);
+
+  const Affine2D &transform = cmd.getTransform();
+  if (data.rotation != 0.0f && isIdentity(transform)) {
+    renderer.drawSprite(*data.texture, data.destRect, data.srcRect, data.tint,
+                        data.rotation, data.anchor);
+    return;
+  }
+
+  Affine2D world = transform;
+  const Vec2 &origin = data.destRect.origin;
+  if (origin.x != 0.0f || origin.y != 0.0f) {
+    world = world * Affine2D(1.0f, 0.0f, 0.0f, 1.0f, origin.x, origin.y);
+  }
+  renderer.drawSprite(*data.texture, world, data.destRect.size, data.srcRect,
+                      data.tint, data.anchor);
+}
+
+/**
+ * @brief 执行形状命令
+ * @return 命令数据与类型匹配并已提交返回true
+ */
+bool RenderCommandExecutor::drawShape(RenderBackend &renderer,
+                                      const RenderCommand &cmd) {
+  switch (cmd.type) {
+  case RenderCommandType::Line:
+  case RenderCommandType::Rect:
+  case RenderCommandType::FilledRect:
+  case RenderCommandType::Circle:
+  case RenderCommandType::FilledCircle:
+  case RenderCommandType::Triangle:
+  case RenderCommandType::FilledTriangle:
+  case RenderCommandType::Polygon:
+  case RenderCommandType::FilledPolygon:
+  case RenderCommandType::FilledPolygonMesh:
+    break;
+  default:
+    return false;
+  }
+
+  beginRun(RunKind::Shape, nullptr);
+  applyTransform(renderer, cmd.getTransform());
+
+  switch (cmd.type) {
+  case RenderCommandType::Line: {
+    const auto &line = cmd.getData<LineCommandData>();
+    renderer.drawLine(line.start, line.end, line.color, line.width);
+    break;
+  }
+
+  case RenderCommandType::Rect:
+  case RenderCommandType::FilledRect: {
+    const auto &rect = cmd.getData<RectCommandData>();
+    if (cmd.type == RenderCommandType::FilledRect) {
+      renderer.fillRect(rect.rect, rect.color);
+    } else {
+      renderer.drawRect(rect.rect, rect.color, rect.width);
+    }
+    break;
+  }
+
+  case RenderCommandType::Circle:
+  case RenderCommandType::FilledCircle: {
+    const auto &circle = cmd.getData<CircleCommandData>();
+    bool filled = cmd.type == RenderCommandType::FilledCircle;
+    if (renderer.supportsShapeSDF()) {
+      renderer.drawCircleSDF(circle.center, circle.radius, circle.color,
+                             filled ? 0.0f : circle.width);
+    } else if (filled) {
+      renderer.fillCircle(circle.center, circle.radius, circle.color,
+                          circle.segments);
+    } else {
+      renderer.drawCircle(circle.center, circle.radius, circle.color,
+                          circle.segments, circle.width);
+    }
+    break;
+  }
+
+  case RenderCommandType::Triangle:
+  case RenderCommandType::FilledTriangle: {
+    const auto &tri = cmd.getData<TriangleCommandData>();
+    if (cmd.type == RenderCommandType::FilledTriangle) {
+      renderer.fillTriangle(tri.p1, tri.p2, tri.p3, tri.color);
+    } else {
+      renderer.drawTriangle(tri.p1, tri.p2, tri.p3, tri.color, tri.width);
+    }
+    break;
+  }
+
+  case RenderCommandType::Polygon:
+  case RenderCommandType::FilledPolygon: {
+    // 后端接口接收 vector，经复用的暂存数组转交，预热后不再分配
+    const auto &poly = cmd.getData<PolygonCommandData>();
+    scratchPoints_.assign(poly.points, poly.points + poly.pointCount);
+    if (cmd.type == RenderCommandType::FilledPolygon) {
+      renderer.fillPolygon(scratchPoints_, poly.color);
+    } else {
+      renderer.drawPolygon(scratchPoints_, poly.color, poly.width);
+    }
+    break;
+  }
+
+  case RenderCommandType::FilledPolygonMesh: {
+    const auto &mesh = cmd.getData<PolygonMeshCommandData>();
+    renderer.fillPolygonMesh(mesh.points, mesh.pointCount, mesh.indices,
+                             mesh.indexCount, mesh.color);
+    break;
+  }
+
+  default:
+    break;
+  }
+  return true;
+}
+
+/**
+ * @brief 执行文字命令
+ *
+ * 文字接口不经变换栈，起点按命令变换换算到世界坐标
+ */
+void RenderCommandExecutor::drawText(RenderBackend &renderer,
+                                     const RenderCommand &cmd) {
+  const auto &text = cmd.getData<TextCommandData>();
+  if (text.font == nullptr || text.text == nullptr) {
+    stats_.skipped++;
+    return;
+  }
+  beginRun(RunKind::Text, nullptr);
+  Vec2 position = cmd.getTransform().transformPoint(text.position);
+  scratchText_.assign(text.text, text.length);
+  renderer.drawText(*text.font, scratchText_, position, text.color);
+}
+
+} // namespace extra2d
@@ -1,5 +1,6 @@
 #include <extra2d/graphics/render_module.h>
 #include <extra2d/config/module_registry.h>
+#include <extra2d/graphics/opengl/gl_renderer.h>
 #include <extra2d/graphics/opengl/gl_shader.h>
 #include <extra2d/graphics/shader_manager.h>
 #include <extra2d/platform/iwindow.h>
@@ -13,6 +14,21 @@ namespace extra2d {
 
 static ModuleId s_renderModuleId = INVALID_MODULE_ID;
 
+static const char* streamModeToString(VertexStreamMode mode) {
+    switch (mode) {
+        case VertexStreamMode::Orphan: return "orphan";
+        case VertexStreamMode::RingBuffer: return "ring";
+        case VertexStreamMode::SubData:
+        default: return "subdata";
+    }
+}
+
+static VertexStreamMode streamModeFromString(const std::string& str) {
+    if (str == "orphan") return VertexStreamMode::Orphan;
+    if (str == "ring") return VertexStreamMode::RingBuffer;
+    return VertexStreamMode::SubData;
+}
+
 ModuleId get_render_module_id() {
     return s_renderModuleId;
 }
@@ -31,6 +47,20 @@ bool RenderModuleConfig::validate() const {
         return false;
     }
     
+    if (spriteTextureSlots < 1 || spriteTextureSlots > 16) {
+        return false;
+    }
+    
+    // 单次写入不超过批次容量，更大的阈值不会生效
+    if (spriteParallelThreshold < 0 ||
+        spriteParallelThreshold > spriteBatchSize) {
+        return false;
+    }
+    
+    if (renderThreadFrames < 2 || renderThreadFrames > 3) {
+        return false;
+    }
+    
     return true;
 }
 
@@ -58,7 +88,16 @@ void RenderModuleConfig::resetToDefaults() {
     targetFPS = 60;
     multisamples = 0;
     sRGBFramebuffer = false;
-    spriteBatchSize = 1000;
+    spriteBatchSize = 10000;
+    spriteStreamMode = VertexStreamMode::SubData;
+    spriteCompactVertices = false;
+    spriteTextureSlots = 1;
+    spriteInstanced = false;
+    spriteParallelThreshold = 8192;
+    spriteBatchShapes = false;
+    sdfShapes = true;
+    renderThread = false;
+    renderThreadFrames = 2;
 }
 
 bool RenderModuleConfig::loadFromJson(const void* jsonData) {
@@ -94,6 +133,42 @@ bool RenderModuleConfig::loadFromJson(const void* jsonData) {
             spriteBatchSize = j["spriteBatchSize"].get<int>();
         }
         
+        if (j.contains("spriteStreamMode")) {
+            spriteStreamMode = streamModeFromString(j["spriteStreamMode"].get<std::string>());
+        }
+        
+        if (j.contains("spriteCompactVertices")) {
+            spriteCompactVertices = j["spriteCompactVertices"].get<bool>();
+        }
+        
+        if (j.contains("spriteTextureSlots")) {
+            spriteTextureSlots = j["spriteTextureSlots"].get<int>();
+        }
+        
+        if (j.contains("spriteInstanced")) {
+            spriteInstanced = j["spriteInstanced"].get<bool>();
+        }
+        
+        if (j.contains("spriteParallelThreshold")) {
+            spriteParallelThreshold = j["spriteParallelThreshold"].get<int>();
+        }
+        
+        if (j.contains("spriteBatchShapes")) {
+            spriteBatchShapes = j["spriteBatchShapes"].get<bool>();
+        }
+        
+        if (j.contains("sdfShapes")) {
+            sdfShapes = j["sdfShapes"].get<bool>();
+        }
+        
+        if (j.contains("renderThread")) {
+            renderThread = j["renderThread"].get<bool>();
+        }
+        
+        if (j.contains("renderThreadFrames")) {
+            renderThreadFrames = j["renderThreadFrames"].get<int>();
+        }
+        
         return true;
     } catch (...) {
         return false;
@@ -111,6 +186,15 @@ bool RenderModuleConfig::saveToJson(void* jsonData) const {
         j["multisamples"] = multisamples;
         j["sRGBFramebuffer"] = sRGBFramebuffer;
         j["spriteBatchSize"] = spriteBatchSize;
+        j["spriteStreamMode"] = streamModeToString(spriteStreamMode);
+        j["spriteCompactVertices"] = spriteCompactVertices;
+        j["spriteTextureSlots"] = spriteTextureSlots;
+        j["spriteInstanced"] = spriteInstanced;
+        j["spriteParallelThreshold"] = spriteParallelThreshold;
+        j["spriteBatchShapes"] = spriteBatchShapes;
+        j["sdfShapes"] = sdfShapes;
+        j["renderThread"] = renderThread;
+        j["renderThreadFrames"] = renderThreadFrames;
         return true;
     } catch (...) {
         return false;
@@ -163,6 +247,19 @@ bool RenderModuleInitializer::initialize(const IModuleConfig* config) {
         return false;
     }
     
+    if (auto* glRenderer = dynamic_cast<GLRenderer*>(renderer_.get())) {
+        SpriteBatchConfig batchConfig;
+        batchConfig.streamMode = renderConfig->spriteStreamMode;
+        batchConfig.maxSprites = static_cast<size_t>(renderConfig->spriteBatchSize);
+        batchConfig.compactVertices = renderConfig->spriteCompactVertices;
+        batchConfig.textureSlots = static_cast<size_t>(renderConfig->spriteTextureSlots);
+        batchConfig.instanced = renderConfig->spriteInstanced;
+        batchConfig.parallelThreshold = static_cast<size_t>(renderConfig->spriteParallelThreshold);
+        batchConfig.batchShapes = renderConfig->spriteBatchShapes;
+        batchConfig.sdfShapes = renderConfig->sdfShapes;
+        glRenderer->setSpriteBatchConfig(batchConfig);
+    }
+    
     if (!renderer_->init(window_)) {
         E2D_LOG_ERROR("Failed to initialize renderer");
         renderer_.reset();
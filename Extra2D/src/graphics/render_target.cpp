@@ -1,4 +1,6 @@
 #include <glad/glad.h>
+#include <extra2d/graphics/gpu_context.h>
+#include <extra2d/graphics/opengl/gl_state_cache.h>
 #include <extra2d/graphics/opengl/gl_texture.h>
 #include <extra2d/graphics/render_target.h>
 #include <extra2d/utils/logger.h>
@@ -83,6 +85,13 @@ RenderTarget &RenderTarget::operator=(RenderTarget &&other) noexcept {
  * 根据指定的配置参数创建帧缓冲对象
  */
 bool RenderTarget::create(const RenderTargetConfig &config) {
+  // 可能在非上下文线程调用，转到上下文所属线程创建
+  if (!GPUContext::get().isOwnerThread()) {
+    bool result = false;
+    GPUContext::get().runOnOwner([&] { result = create(config); });
+    return result;
+  }
+
   destroy();
 
   width_ = config.width;
@@ -116,6 +125,12 @@ bool RenderTarget::createFromTexture(Ptr<Texture> texture, bool hasDepth) {
     E2D_ERROR("无效的颜色纹理");
     return false;
   }
+  if (!GPUContext::get().isOwnerThread()) {
+    bool result = false;
+    GPUContext::get().runOnOwner(
+        [&] { result = createFromTexture(texture, hasDepth); });
+    return result;
+  }
 
   destroy();
 
@@ -189,7 +204,7 @@ void RenderTarget::bind() {
   }
 
   glBindFramebuffer(GL_FRAMEBUFFER, fbo_);
-  glViewport(0, 0, width_, height_);
+  GLStateCache::get().setViewport(0, 0, width_, height_);
 }
 
 /**
@@ -241,7 +256,7 @@ void RenderTarget::setViewport(int x, int y, int width, int height) {
   }
 
   bind();
-  glViewport(x, y, width, height);
+  GLStateCache::get().setViewport(x, y, width, height);
 }
 
 /**
@@ -347,9 +362,12 @@ bool RenderTarget::saveToFile(const std::string &filepath) {
   // 读取像素数据
   std::vector<uint8_t> pixels(width_ * height_ * 4);
 
-  bind();
-  glReadPixels(0, 0, width_, height_, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
-  unbind();
+  GPUContext::get().runOnOwner([&] {
+    bind();
+    glReadPixels(0, 0, width_, height_, GL_RGBA, GL_UNSIGNED_BYTE,
+                 pixels.data());
+    unbind();
+  });
 
   // 翻转Y轴（OpenGL坐标系原点在左下角，PNG需要左上角原点）
   std::vector<uint8_t> flipped(width_ * height_ * 4);
@@ -477,18 +495,26 @@ bool RenderTarget::createFBO() {
 /**
  * @brief 删除帧缓冲对象
  *
- * 内部方法，删除FBO和渲染缓冲对象
+ * 内部方法，删除FBO和渲染缓冲对象；可能在非上下文线程调用，
+ * 删除交给上下文所属线程
  */
 void RenderTarget::deleteFBO() {
-  if (rbo_ != 0) {
-    glDeleteRenderbuffers(1, &rbo_);
-    rbo_ = 0;
-  }
-
-  if (fbo_ != 0) {
-    glDeleteFramebuffers(1, &fbo_);
-    fbo_ = 0;
+  if (rbo_ == 0 && fbo_ == 0) {
+    return;
   }
+  GPUContext::get().releaseOnOwner([rbo = rbo_, fbo = fbo_] {
+    if (!GPUContext::get().isValid()) {
+      return;
+    }
+    if (rbo != 0) {
+      glDeleteRenderbuffers(1, &rbo);
+    }
+    if (fbo != 0) {
+      glDeleteFramebuffers(1, &fbo);
+    }
+  });
+  rbo_ = 0;
+  fbo_ = 0;
 }
 
 // ============================================================================
@@ -505,6 +531,13 @@ void RenderTarget::deleteFBO() {
  * 创建支持多重采样抗锯齿的渲染目标
  */
 bool MultisampleRenderTarget::create(int width, int height, int samples) {
+  if (!GPUContext::get().isOwnerThread()) {
+    bool result = false;
+    GPUContext::get().runOnOwner(
+        [&] { result = create(width, height, samples); });
+    return result;
+  }
+
   // 先销毁现有的
   destroy();
 
@@ -559,7 +592,11 @@ bool MultisampleRenderTarget::create(int width, int height, int samples) {
 void MultisampleRenderTarget::destroy() {
   // 删除颜色渲染缓冲
   if (colorRBO_ != 0) {
-    glDeleteRenderbuffers(1, &colorRBO_);
+    GPUContext::get().releaseOnOwner([colorRBO = colorRBO_] {
+      if (GPUContext::get().isValid()) {
+        glDeleteRenderbuffers(1, &colorRBO);
+      }
+    });
     colorRBO_ = 0;
   }
 
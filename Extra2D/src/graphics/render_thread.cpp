@@ -0,0 +1,268 @@
+#include <algorithm>
+#include <chrono>
+#include <extra2d/graphics/gpu_context.h>
+#include <extra2d/graphics/render_backend.h>
+#include <extra2d/graphics/render_thread.h>
+#include <extra2d/platform/iwindow.h>
+#include <extra2d/utils/logger.h>
+
+namespace extra2d {
+
+/**
+ * @brief 计算自 start 起经过的毫秒数
+ */
+static double elapsedMs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+/**
+ * @brief 析构时停止线程
+ */
+RenderThread::~RenderThread() { stop(); }
+
+/**
+ * @brief 启动渲染线程并移交图形上下文
+ * @param window 持有上下文的窗口
+ * @param renderer 渲染后端
+ * @param frameCount 帧槽数
+ * @return 渲染线程取得上下文返回true
+ */
+bool RenderThread::start(IWindow *window, RenderBackend *renderer,
+                         size_t frameCount) {
+  if (isRunning() || window == nullptr || renderer == nullptr) {
+    return false;
+  }
+
+  window_ = window;
+  renderer_ = renderer;
+  frameCount = std::clamp(frameCount, MIN_FRAMES, MAX_FRAMES);
+  frames_.clear();
+  for (size_t i = 0; i < frameCount; ++i) {
+    frames_.push_back(std::make_unique<Frame>());
+  }
+  frameBusy_.assign(frameCount, false);
+  nextFrame_ = 0;
+  pendingFrame_ = nullptr;
+  queue_.clear();
+  completedItems_ = 0;
+  queuedItems_ = 0;
+  stopping_ = false;
+  contextReady_ = false;
+  stats_ = Stats{};
+
+  // 上下文须先在主线程解绑，渲染线程才能绑定
+  if (!window_->makeContextCurrent(false)) {
+    return false;
+  }
+  thread_ = std::thread(&RenderThread::threadMain, this);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  doneCond_.wait(lock, [this] { return contextReady_ || stopping_; });
+  if (!contextReady_) {
+    lock.unlock();
+    thread_.join();
+    window_->makeContextCurrent(true);
+    E2D_LOG_ERROR("Render thread failed to acquire the graphics context");
+    return false;
+  }
+
+  // 之后其他线程上的资源创建经 invoke() 转到渲染线程，释放排队到帧完成后
+  GPUContext::get().setOwner(
+      thread_.get_id(),
+      [this](const std::function<void()> &task) { invoke(task); });
+
+  E2D_LOG_INFO("Render thread started with {} frame(s) in flight", frameCount);
+  return true;
+}
+
+/**
+ * @brief 执行完已提交的帧后停止，上下文交还调用线程
+ */
+void RenderThread::stop() {
+  if (!isRunning()) {
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  itemCond_.notify_one();
+  thread_.join();
+  window_->makeContextCurrent(true);
+  // 上下文已回到调用线程，执行渲染线程退出后才排队的释放
+  GPUContext::get().clearOwner();
+  GPUContext::get().drainReleases();
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    contextReady_ = false;
+  }
+  doneCond_.notify_all(); // 唤醒停止期间调用 invoke() 的线程
+  E2D_LOG_INFO("Render thread stopped after {} frame(s)",
+               stats_.framesExecuted);
+}
+
+/**
+ * @brief 获取下一个空闲帧槽
+ *
+ * 帧槽按轮转顺序使用；该槽的上一帧仍在执行时等待
+ */
+RenderThread::Frame &RenderThread::beginFrame() {
+  auto waitStart = std::chrono::steady_clock::now();
+  std::unique_lock<std::mutex> lock(mutex_);
+  doneCond_.wait(lock, [this] { return !frameBusy_[nextFrame_]; });
+  stats_.producerWaitMs += elapsedMs(waitStart);
+
+  Frame &frame = *frames_[nextFrame_];
+  frameBusy_[nextFrame_] = true;
+  nextFrame_ = (nextFrame_ + 1) % frames_.size();
+  pendingFrame_ = &frame;
+  lock.unlock();
+
+  // 该槽已空闲，渲染线程不再读取其命令与帧内存
+  frame.commands.clear();
+  return frame;
+}
+
+/**
+ * @brief 提交 beginFrame() 返回的帧
+ */
+void RenderThread::submitFrame() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (pendingFrame_ == nullptr) {
+      return;
+    }
+    Item item;
+    item.frame = pendingFrame_;
+    queue_.push_back(item);
+    queuedItems_++;
+    pendingFrame_ = nullptr;
+    stats_.framesSubmitted++;
+  }
+  itemCond_.notify_one();
+}
+
+/**
+ * @brief 在渲染线程上执行任务并等待完成
+ * @param task 任务
+ *
+ * 渲染线程正在停止时不再取新条目，此时等待 stop() 交还上下文后在调用
+ * 线程直接执行，与未启动时一致
+ */
+void RenderThread::invoke(const std::function<void()> &task) {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (stopping_) {
+    doneCond_.wait(lock, [this] { return !contextReady_; });
+  }
+  if (!contextReady_) {
+    lock.unlock();
+    task();
+    return;
+  }
+  Item item;
+  item.task = &task;
+  queue_.push_back(item);
+  uint64_t ticket = ++queuedItems_;
+  itemCond_.notify_one();
+  doneCond_.wait(lock, [this, ticket] { return completedItems_ >= ticket; });
+}
+
+/**
+ * @brief 等待已提交的帧全部执行完毕
+ */
+void RenderThread::sync() {
+  if (!isRunning()) {
+    return;
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+  uint64_t ticket = queuedItems_;
+  doneCond_.wait(lock, [this, ticket] { return completedItems_ >= ticket; });
+}
+
+/**
+ * @brief 获取统计信息快照
+ */
+RenderThread::Stats RenderThread::getStats() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return stats_;
+}
+
+/**
+ * @brief 渲染线程主循环：按提交顺序执行帧与同步任务
+ */
+void RenderThread::threadMain() {
+  bool acquired = window_->makeContextCurrent(true);
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    contextReady_ = acquired;
+    if (!acquired) {
+      stopping_ = true;
+    }
+  }
+  doneCond_.notify_all();
+  if (!acquired) {
+    return;
+  }
+
+  for (;;) {
+    Item item;
+    {
+      auto waitStart = std::chrono::steady_clock::now();
+      std::unique_lock<std::mutex> lock(mutex_);
+      itemCond_.wait(lock, [this] { return !queue_.empty() || stopping_; });
+      stats_.consumerWaitMs += elapsedMs(waitStart);
+      if (queue_.empty()) {
+        break; // 停止且已无待执行条目
+      }
+      item = queue_.front();
+      queue_.pop_front();
+    }
+
+    if (item.frame != nullptr) {
+      executeFrame(*item.frame);
+    } else {
+      (*item.task)();
+    }
+    // 之前的帧均已执行完毕，其他线程析构的 GPU 对象可以安全删除
+    GPUContext::get().drainReleases();
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (item.frame != nullptr) {
+        size_t index = 0;
+        while (frames_[index].get() != item.frame) {
+          ++index;
+        }
+        frameBusy_[index] = false;
+        stats_.framesExecuted++;
+      }
+      completedItems_++;
+    }
+    doneCond_.notify_all();
+  }
+
+  window_->makeContextCurrent(false);
+}
+
+/**
+ * @brief 执行一帧：设置帧状态、回放命令并交换缓冲区
+ */
+void RenderThread::executeFrame(Frame &frame) {
+  RenderBackend &renderer = *renderer_;
+  renderer.setFrameTime(frame.time);
+  renderer.setViewport(frame.viewportX, frame.viewportY, frame.viewportWidth,
+                       frame.viewportHeight);
+  renderer.setViewProjection(frame.viewProjection);
+
+  renderer.beginFrame(frame.clearColor);
+  renderer.beginSpriteBatch();
+  executor_.execute(renderer, frame.commands);
+  renderer.endSpriteBatch();
+  renderer.endFrame();
+
+  window_->swap();
+}
+
+} // namespace extra2d
@@ -16,9 +16,9 @@ Ptr<IShader> ShaderPreset::Water(const WaterParams &params) {
     return nullptr;
   }
 
-  shader->setFloat("u_waveSpeed", params.waveSpeed);
-  shader->setFloat("u_waveAmplitude", params.waveAmplitude);
-  shader->setFloat("u_waveFrequency", params.waveFrequency);
+  shader->set(shader->uniform("u_waveSpeed"), params.waveSpeed);
+  shader->set(shader->uniform("u_waveAmplitude"), params.waveAmplitude);
+  shader->set(shader->uniform("u_waveFrequency"), params.waveFrequency);
 
   return shader;
 }
@@ -35,9 +35,8 @@ Ptr<IShader> ShaderPreset::Outline(const OutlineParams &params) {
     return nullptr;
   }
 
-  shader->setVec4("u_outlineColor", glm::vec4(params.color.r, params.color.g,
-                                              params.color.b, params.color.a));
-  shader->setFloat("u_thickness", params.thickness);
+  shader->set(shader->uniform("u_outlineColor"), params.color);
+  shader->set(shader->uniform("u_thickness"), params.thickness);
 
   return shader;
 }
@@ -54,8 +53,8 @@ Ptr<IShader> ShaderPreset::Distortion(const DistortionParams &params) {
     return nullptr;
   }
 
-  shader->setFloat("u_distortionAmount", params.distortionAmount);
-  shader->setFloat("u_timeScale", params.timeScale);
+  shader->set(shader->uniform("u_distortionAmount"), params.distortionAmount);
+  shader->set(shader->uniform("u_timeScale"), params.timeScale);
 
   return shader;
 }
@@ -72,7 +71,7 @@ Ptr<IShader> ShaderPreset::Pixelate(const PixelateParams &params) {
     return nullptr;
   }
 
-  shader->setFloat("u_pixelSize", params.pixelSize);
+  shader->set(shader->uniform("u_pixelSize"), params.pixelSize);
 
   return shader;
 }
@@ -89,7 +88,7 @@ Ptr<IShader> ShaderPreset::Invert(const InvertParams &params) {
     return nullptr;
   }
 
-  shader->setFloat("u_strength", params.strength);
+  shader->set(shader->uniform("u_strength"), params.strength);
 
   return shader;
 }
@@ -106,7 +105,7 @@ Ptr<IShader> ShaderPreset::Grayscale(const GrayscaleParams &params) {
     return nullptr;
   }
 
-  shader->setFloat("u_intensity", params.intensity);
+  shader->set(shader->uniform("u_intensity"), params.intensity);
 
   return shader;
 }
@@ -123,7 +122,7 @@ Ptr<IShader> ShaderPreset::Blur(const BlurParams &params) {
     return nullptr;
   }
 
-  shader->setFloat("u_radius", params.radius);
+  shader->set(shader->uniform("u_radius"), params.radius);
 
   return shader;
 }
@@ -148,11 +147,9 @@ ShaderPreset::GrayscaleOutline(const GrayscaleParams &grayParams,
     return nullptr;
   }
 
-  shader->setFloat("u_grayIntensity", grayParams.intensity);
-  shader->setVec4("u_outlineColor",
-                  glm::vec4(outlineParams.color.r, outlineParams.color.g,
-                            outlineParams.color.b, outlineParams.color.a));
-  shader->setFloat("u_thickness", outlineParams.thickness);
+  shader->set(shader->uniform("u_grayIntensity"), grayParams.intensity);
+  shader->set(shader->uniform("u_outlineColor"), outlineParams.color);
+  shader->set(shader->uniform("u_thickness"), outlineParams.thickness);
 
   return shader;
 }
@@ -175,8 +172,8 @@ Ptr<IShader> ShaderPreset::PixelateInvert(const PixelateParams &pixParams,
     return nullptr;
   }
 
-  shader->setFloat("u_pixelSize", pixParams.pixelSize);
-  shader->setFloat("u_invertStrength", invParams.strength);
+  shader->set(shader->uniform("u_pixelSize"), pixParams.pixelSize);
+  shader->set(shader->uniform("u_invertStrength"), invParams.strength);
 
   return shader;
 }
@@ -0,0 +1,72 @@
+#include <extra2d/graphics/texture.h>
+#include <mutex>
+#include <vector>
+
+namespace extra2d {
+
+namespace {
+
+/**
+ * @brief 纹理排序 ID 分配器
+ *
+ * 纹理可能在加载线程上创建，分配与回收加锁；
+ * ID 从 1 开始递增，释放的 ID 优先复用，使其保持在 16 位范围内
+ */
+class SortIdAllocator {
+public:
+  static SortIdAllocator &get() {
+    static SortIdAllocator instance;
+    return instance;
+  }
+
+  uint16_t acquire() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!freeIds_.empty()) {
+      uint16_t id = freeIds_.back();
+      freeIds_.pop_back();
+      return id;
+    }
+    if (next_ > UINT16_MAX) {
+      // 耗尽后不再区分，只影响排序合批，不影响正确性
+      return Texture::INVALID_SORT_ID;
+    }
+    return static_cast<uint16_t>(next_++);
+  }
+
+  void release(uint16_t id) {
+    if (id == Texture::INVALID_SORT_ID) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    freeIds_.push_back(id);
+  }
+
+private:
+  std::mutex mutex_;
+  std::vector<uint16_t> freeIds_;
+  uint32_t next_ = 1;
+};
+
+} // namespace
+
+/**
+ * @brief 构造时分配排序 ID
+ */
+Texture::Texture() : sortId_(SortIdAllocator::get().acquire()) {}
+
+/**
+ * @brief 拷贝构造，副本持有独立的排序 ID
+ */
+Texture::Texture(const Texture &) : sortId_(SortIdAllocator::get().acquire()) {}
+
+/**
+ * @brief 拷贝赋值，保留自身的排序 ID
+ */
+Texture &Texture::operator=(const Texture &) { return *this; }
+
+/**
+ * @brief 析构时回收排序 ID
+ */
+Texture::~Texture() { SortIdAllocator::get().release(sortId_); }
+
+} // namespace extra2d
@@ -1,3 +1,4 @@
+#include <extra2d/graphics/opengl/gl_state_cache.h>
 #include <extra2d/graphics/texture_atlas.h>
 #include <extra2d/utils/logger.h>
 #include <algorithm>
@@ -167,9 +168,9 @@ void TextureAtlasPage::writePixels(int x, int y, int w, int h, const uint8_t* pi
   GLuint texID = static_cast<GLuint>(
       reinterpret_cast<uintptr_t>(texture_->getNativeHandle()));
   
-  glBindTexture(GL_TEXTURE_2D, texID);
+  GLStateCache::get().bindTexture(0, texID);
   glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, w, h, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
-  glBindTexture(GL_TEXTURE_2D, 0);
+  GLStateCache::get().bindTexture(0, 0);
 }
 
 /**
@@ -0,0 +1,46 @@
+#include <algorithm>
+#include <cmath>
+#include <extra2d/graphics/unit_circle.h>
+
+namespace extra2d {
+
+/**
+ * @brief 获取指定分段数的单位圆顶点
+ * @param segments 分段数
+ * @return segments + 1 个顶点，最后一个与第一个重合
+ */
+const Vec2 *UnitCircleCache::get(int segments) {
+  segments = std::clamp(segments, 1, MAX_SEGMENTS);
+  auto &table = tables_[segments];
+  if (table.empty()) {
+    table.resize(static_cast<size_t>(segments) + 1);
+    // 以 double 计算，避免大分段数时末段累积误差
+    const double step = 2.0 * 3.14159265358979323846 / segments;
+    for (int i = 0; i < segments; ++i) {
+      table[i] = Vec2(static_cast<float>(std::cos(step * i)),
+                      static_cast<float>(std::sin(step * i)));
+    }
+    table[segments] = table[0];
+  }
+  return table.data();
+}
+
+/**
+ * @brief 按屏幕空间半径估算分段数
+ * @param pixelRadius 屏幕半径（像素）
+ * @param tolerance 弦高误差上限（像素）
+ * @return 分段数
+ *
+ * 弦高 h = r * (1 - cos(theta / 2))，令 h <= tolerance 得每段最大张角
+ */
+int UnitCircleCache::segmentsForRadius(float pixelRadius, float tolerance) {
+  if (!(pixelRadius > tolerance)) {
+    return MIN_AUTO_SEGMENTS;
+  }
+  float theta = 2.0f * std::acos(1.0f - tolerance / pixelRadius);
+  int segments = static_cast<int>(std::ceil(2.0f * PI_F / theta));
+  segments = (segments + 3) & ~3;
+  return std::clamp(segments, MIN_AUTO_SEGMENTS, MAX_SEGMENTS);
+}
+
+} // namespace extra2d
@@ -151,6 +151,17 @@ void SDL2Window::swap() {
     }
 }
 
+bool SDL2Window::makeContextCurrent(bool current) {
+    if (!sdlWindow_ || !glContext_) {
+        return false;
+    }
+    if (SDL_GL_MakeCurrent(sdlWindow_, current ? glContext_ : nullptr) != 0) {
+        E2D_LOG_ERROR("SDL_GL_MakeCurrent failed: {}", SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
 bool SDL2Window::shouldClose() const {
     return shouldClose_;
 }
@@ -20,6 +20,7 @@ public:
 
     void poll() override;
     void swap() override;
+    bool makeContextCurrent(bool current) override;
     bool shouldClose() const override;
     void close() override;
 
@@ -7,19 +7,53 @@
 
 namespace extra2d {
 
+/**
+ * @brief 计算局部矩形经仿射变换后的轴对齐包围盒
+ */
+static Rect transformBounds(const Affine2D &t, const Rect &local) {
+  float hw = std::abs(local.width()) * 0.5f;
+  float hh = std::abs(local.height()) * 0.5f;
+  Vec2 c = t.transformPoint(local.center());
+  float ex = std::abs(t.a) * hw + std::abs(t.c) * hh;
+  float ey = std::abs(t.b) * hw + std::abs(t.d) * hh;
+  return Rect(c.x - ex, c.y - ey, ex * 2.0f, ey * 2.0f);
+}
+
+/**
+ * @brief 合并两个包围盒（零面积的包围盒同样参与合并）
+ */
+static Rect mergeBounds(const Rect &a, const Rect &b) {
+  float l = std::min(a.left(), b.left());
+  float t = std::min(a.top(), b.top());
+  float r = std::max(a.right(), b.right());
+  float bottom = std::max(a.bottom(), b.bottom());
+  return Rect(l, t, r - l, bottom - t);
+}
+
 /**
  * @brief 默认构造函数
  *
- * 创建一个空的节点对象
+ * 创建一个空的节点对象并在变换系统中分配槽位，
+ * 监听器有无变化时更新子树监听器计数
  */
-Node::Node() = default;
+Node::Node() : transformIndex_(transforms().allocate(this)) {
+  eventDispatcher_.setPresenceCallback([this](bool hasListeners) {
+    addSubtreeListenerNodes(hasListeners ? 1 : -1);
+  });
+}
 
 /**
  * @brief 析构函数
  *
- * 清除所有子节点
+ * 从场景空间索引中移除，清除所有子节点并归还变换槽位
  */
-Node::~Node() { clearChildren(); }
+Node::~Node() {
+  if (spatialHandle_ != SpatialIndex::INVALID_HANDLE && scene_) {
+    scene_->spatialIndex_.remove(spatialHandle_);
+  }
+  clearChildren();
+  transforms().release(transformIndex_);
+}
 
 /**
  * @brief 添加子节点
@@ -34,8 +68,11 @@ void Node::addChild(Ptr<Node> child) {
 
   child->detach();
   child->parent_ = weak_from_this();
+  child->linkTransform(this);
   children_.push_back(child);
   childrenOrderDirty_ = true;
+  child->markTransformDirty();
+  addSubtreeListenerNodes(static_cast<int32_t>(child->subtreeListenerNodes_));
 
   // 更新索引
   if (!child->getName().empty()) {
@@ -73,7 +110,10 @@ void Node::addChildren(std::vector<Ptr<Node>> &&children) {
 
     child->detach();
     child->parent_ = weak_from_this();
+    child->linkTransform(this);
     children_.push_back(child);
+    child->markTransformDirtyRecursive();
+    addSubtreeListenerNodes(static_cast<int32_t>(child->subtreeListenerNodes_));
 
     // 更新索引
     if (!child->getName().empty()) {
@@ -93,6 +133,8 @@ void Node::addChildren(std::vector<Ptr<Node>> &&children) {
 
   if (!children.empty()) {
     childrenOrderDirty_ = true;
+    subtreeBoundsDirty_ = true;
+    invalidateAncestorBounds();
   }
 }
 
@@ -120,7 +162,13 @@ void Node::removeChild(Ptr<Node> child) {
       tagIndex_.erase((*it)->getTag());
     }
     (*it)->parent_.reset();
+    (*it)->linkTransform(nullptr);
+    (*it)->markTransformDirtyRecursive();
+    addSubtreeListenerNodes(
+        -static_cast<int32_t>((*it)->subtreeListenerNodes_));
     children_.erase(it);
+    subtreeBoundsDirty_ = true;
+    invalidateAncestorBounds();
   }
 }
 
@@ -164,16 +212,25 @@ void Node::detach() {
  * 移除所有子节点并触发相应的退出回调
  */
 void Node::clearChildren() {
+  int32_t listenerNodes = 0;
   for (auto &child : children_) {
+    listenerNodes += static_cast<int32_t>(child->subtreeListenerNodes_);
     if (running_) {
       child->onDetachFromScene();
       child->onExit();
+    } else if (child->scene_) {
+      child->onDetachFromScene();
     }
     child->parent_.reset();
+    child->linkTransform(nullptr);
+    child->markTransformDirtyRecursive();
   }
   children_.clear();
   nameIndex_.clear();
   tagIndex_.clear();
+  subtreeBoundsDirty_ = true;
+  invalidateAncestorBounds();
+  addSubtreeListenerNodes(-listenerNodes);
 }
 
 /**
@@ -213,7 +270,7 @@ Ptr<Node> Node::findChildByTag(int tag) const {
  * @param pos 新的位置坐标
  */
 void Node::setPos(const Vec2 &pos) {
-  position_ = pos;
+  transforms().position(transformIndex_) = pos;
   markTransformDirty();
 }
 
@@ -229,7 +286,7 @@ void Node::setPos(float x, float y) { setPos(Vec2(x, y)); }
  * @param degrees 旋转角度（度数）
  */
 void Node::setRotation(float degrees) {
-  rotation_ = degrees;
+  transforms().rotation(transformIndex_) = degrees;
   markTransformDirty();
 }
 
@@ -238,7 +295,7 @@ void Node::setRotation(float degrees) {
  * @param scale 缩放向量
  */
 void Node::setScale(const Vec2 &scale) {
-  scale_ = scale;
+  transforms().scale(transformIndex_) = scale;
   markTransformDirty();
 }
 
@@ -276,7 +333,7 @@ void Node::setAnchor(float x, float y) { setAnchor(Vec2(x, y)); }
  * @param skew 斜切角度向量
  */
 void Node::setSkew(const Vec2 &skew) {
-  skew_ = skew;
+  transforms().skew(transformIndex_) = skew;
   markTransformDirty();
 }
 
@@ -338,9 +395,7 @@ void Node::setZOrder(int zOrder) {
  * @return 世界坐标位置
  */
 Vec2 Node::toWorld(const Vec2 &localPos) const {
-  glm::vec4 worldPos =
-      getWorldTransform() * glm::vec4(localPos.x, localPos.y, 0.0f, 1.0f);
-  return Vec2(worldPos.x, worldPos.y);
+  return getWorldTransform().transformPoint(localPos);
 }
 
 /**
@@ -349,128 +404,252 @@ Vec2 Node::toWorld(const Vec2 &localPos) const {
  * @return 本地坐标位置
  */
 Vec2 Node::toLocal(const Vec2 &worldPos) const {
-  glm::mat4 invWorld = glm::inverse(getWorldTransform());
-  glm::vec4 localPos = invWorld * glm::vec4(worldPos.x, worldPos.y, 0.0f, 1.0f);
-  return Vec2(localPos.x, localPos.y);
+  return getWorldTransform().inverse().transformPoint(worldPos);
 }
 
 /**
- * @brief 获取本地变换矩阵
- * @return 本地变换矩阵
+ * @brief 获取本地变换
+ * @return 本地仿射变换
  *
- * 计算包含位置、旋转、斜切和缩放的本地变换矩阵
+ * 包含位置、旋转、斜切和缩放，由变换系统按需计算并缓存
  */
-glm::mat4 Node::getLocalTransform() const {
-  if (transformDirty_) {
-    localTransform_ = glm::mat4(1.0f);
+Affine2D Node::getLocalTransform() const {
+  return transforms().getLocal(transformIndex_);
+}
 
-    // T - R - S order
-    localTransform_ = glm::translate(localTransform_,
-                                     glm::vec3(position_.x, position_.y, 0.0f));
+/**
+ * @brief 获取世界变换
+ * @return 世界仿射变换
+ *
+ * 为脏时由变换系统沿父索引重算，不经过父节点的弱引用
+ */
+Affine2D Node::getWorldTransform() const {
+  return transforms().getWorld(transformIndex_);
+}
 
-    if (rotation_ != 0.0f) {
-      localTransform_ = glm::rotate(localTransform_, rotation_ * DEG_TO_RAD,
-                                    glm::vec3(0.0f, 0.0f, 1.0f));
-    }
+/**
+ * @brief 标记变换为脏
+ *
+ * 标记本地变换和世界变换需要重新计算，并递归标记所有子节点的世界变换；
+ * 祖先节点的子树包围盒随之失效
+ */
+void Node::markTransformDirty() {
+  // 先递归标记：提前置脏的世界变换会让递归在本节点处提前返回
+  markTransformDirtyRecursive();
+  transforms().markLocalDirty(transformIndex_);
+  invalidateAncestorBounds();
+}
 
-    if (skew_.x != 0.0f || skew_.y != 0.0f) {
-      glm::mat4 skewMatrix(1.0f);
-      skewMatrix[1][0] = std::tan(skew_.x * DEG_TO_RAD);
-      skewMatrix[0][1] = std::tan(skew_.y * DEG_TO_RAD);
-      localTransform_ *= skewMatrix;
-    }
+/**
+ * @brief 递归标记本节点及后代的世界变换与包围盒为脏
+ */
+void Node::markTransformDirtyRecursive() {
+  // 避免重复标记，提高性能
+  TransformSystem &ts = transforms();
+  if (!ts.isWorldDirty(transformIndex_) || !worldBoundsDirty_ ||
+      !subtreeBoundsDirty_) {
+    ts.markWorldDirty(transformIndex_);
+    worldBoundsDirty_ = true;
+    subtreeBoundsDirty_ = true;
+    markSpatialDirty();
 
-    localTransform_ =
-        glm::scale(localTransform_, glm::vec3(scale_.x, scale_.y, 1.0f));
+    // 递归标记所有子节点
+    for (auto &child : children_) {
+      child->markTransformDirtyRecursive();
+    }
+  }
+}
 
-    // 注意：锚点偏移在渲染时处理，不在本地变换中处理
-    // 这样可以避免锚点偏移被父节点的缩放影响
+/**
+ * @brief 在变换系统中挂接到新的父节点
+ * @param parent 父节点，nullptr 表示成为根节点
+ *
+ * 槽位须位于父槽位之后，否则将整棵子树搬到数组末尾；
+ * 不标记变换为脏，由调用方随后递归标记
+ */
+void Node::linkTransform(Node *parent) {
+  TransformSystem::Index parentIndex =
+      parent ? parent->transformIndex_ : TransformSystem::INVALID_INDEX;
+  if (parent && transformIndex_ < parentIndex) {
+    relocateTransforms(parentIndex);
+  } else {
+    transforms().setParent(transformIndex_, parentIndex);
+  }
+}
 
-    transformDirty_ = false;
+/**
+ * @brief 按先序将子树的变换槽位搬到数组末尾
+ * @param parentIndex 新的父槽位
+ */
+void Node::relocateTransforms(TransformSystem::Index parentIndex) {
+  transformIndex_ = transforms().relocate(transformIndex_, parentIndex);
+  for (auto &child : children_) {
+    child->relocateTransforms(transformIndex_);
   }
-  return localTransform_;
 }
 
 /**
- * @brief 获取世界变换矩阵
- * @return 世界变换矩阵
- *
- * 计算从根节点到当前节点的累积变换矩阵
- */
-glm::mat4 Node::getWorldTransform() const {
-  if (worldTransformDirty_) {
-    // 使用线程局部存储的固定数组，避免每帧内存分配
-    // 限制最大深度为 256 层，足以覆盖绝大多数场景
-    thread_local std::array<const Node *, 256> nodeChainCache;
-    thread_local size_t chainCount = 0;
-
-    chainCount = 0;
-    const Node *current = this;
-    while (current && chainCount < nodeChainCache.size()) {
-      nodeChainCache[chainCount++] = current;
-      auto p = current->parent_.lock();
-      current = p.get();
-    }
+ * @brief 标记内容包围盒为脏
+ */
+void Node::markBoundsDirty() {
+  worldBoundsDirty_ = true;
+  subtreeBoundsDirty_ = true;
+  markSpatialDirty();
+  invalidateAncestorBounds();
+}
 
-    // 从根节点开始计算
-    glm::mat4 transform = glm::mat4(1.0f);
-    for (size_t i = chainCount; i > 0; --i) {
-      transform = transform * nodeChainCache[i - 1]->getLocalTransform();
-    }
-    worldTransform_ = transform;
-    worldTransformDirty_ = false;
+/**
+ * @brief 通知场景空间索引重算本节点的包围盒
+ */
+void Node::markSpatialDirty() {
+  if (spatialHandle_ != SpatialIndex::INVALID_HANDLE) {
+    scene_->spatialIndex_.markDirty(spatialHandle_);
   }
-  return worldTransform_;
 }
 
 /**
- * @brief 标记变换为脏
+ * @brief 调整本节点及全部祖先的子树监听器计数
+ * @param delta 注册了监听器的节点数变化量
+ */
+void Node::addSubtreeListenerNodes(int32_t delta) {
+  if (delta == 0) {
+    return;
+  }
+  subtreeListenerNodes_ += delta;
+  auto p = parent_.lock();
+  while (p) {
+    p->subtreeListenerNodes_ += delta;
+    p = p->parent_.lock();
+  }
+}
+
+/**
+ * @brief 使祖先节点的子树包围盒失效
  *
- * 标记本地变换和世界变换需要重新计算，并递归标记所有子节点
+ * 子树包围盒为脏的节点，其祖先必然也为脏，遇到已失效的祖先即可停止
  */
-void Node::markTransformDirty() {
-  // 避免重复标记，提高性能
-  if (!transformDirty_ || !worldTransformDirty_) {
-    transformDirty_ = true;
-    worldTransformDirty_ = true;
+void Node::invalidateAncestorBounds() {
+  auto p = parent_.lock();
+  while (p && !p->subtreeBoundsDirty_) {
+    p->subtreeBoundsDirty_ = true;
+    p = p->parent_.lock();
+  }
+}
 
-    // 递归标记所有子节点
-    for (auto &child : children_) {
-      child->markTransformDirty();
+/**
+ * @brief 获取自身内容的世界坐标包围盒
+ * @param bounds 输出包围盒
+ * @return 节点报告了内容边界返回true
+ */
+bool Node::getWorldBounds(Rect &bounds) const {
+  if (worldBoundsDirty_) {
+    Rect local;
+    hasWorldBounds_ = getLocalBounds(local);
+    if (hasWorldBounds_) {
+      worldBounds_ = transformBounds(getWorldTransform(), local);
     }
+    worldBoundsDirty_ = false;
   }
+  if (hasWorldBounds_) {
+    bounds = worldBounds_;
+  }
+  return hasWorldBounds_;
 }
 
 /**
- * @brief 批量更新变换
+ * @brief 获取节点及全部后代内容的世界坐标包围盒
+ * @param bounds 输出包围盒
+ * @return 子树中至少一个节点报告了内容边界返回true
  *
- * 从父节点到子节点依次更新世界变换矩阵
- */
-void Node::batchTransforms() {
-  // 如果本地变换脏了，先计算本地变换
-  if (transformDirty_) {
-    (void)getLocalTransform(); // 这会计算并缓存本地变换
-  }
-
-  // 如果世界变换脏了，需要重新计算
-  if (worldTransformDirty_) {
-    auto parent = parent_.lock();
-    if (parent) {
-      // 使用父节点的世界变换（确保父节点已经更新）
-      worldTransform_ = parent->getWorldTransform() * localTransform_;
-    } else {
-      // 根节点
-      worldTransform_ = localTransform_;
+ * 只重算失效的子树，未变化的分支直接使用缓存
+ */
+bool Node::getSubtreeBounds(Rect &bounds) const {
+  if (subtreeBoundsDirty_) {
+    Rect merged;
+    bool hasBounds = getWorldBounds(merged);
+    float padding = hasBounds ? getScreenPadding() : 0.0f;
+    for (const auto &child : children_) {
+      Rect childBounds;
+      if (child->getSubtreeBounds(childBounds)) {
+        merged = hasBounds ? mergeBounds(merged, childBounds) : childBounds;
+        hasBounds = true;
+        padding = std::max(padding, child->subtreePadding_);
+      }
     }
-    worldTransformDirty_ = false;
+    subtreeBounds_ = merged;
+    subtreePadding_ = padding;
+    hasSubtreeBounds_ = hasBounds;
+    subtreeBoundsDirty_ = false;
+  }
+  if (hasSubtreeBounds_) {
+    bounds = subtreeBounds_;
+  }
+  return hasSubtreeBounds_;
+}
+
+/**
+ * @brief 按屏幕像素外扩包围盒
+ * @param bounds 世界坐标包围盒
+ * @param pixels 像素宽度
+ * @param unitsPerPixel 每像素对应的世界单位
+ */
+static Rect padBounds(const Rect &bounds, float pixels, float unitsPerPixel) {
+  if (pixels <= 0.0f) {
+    return bounds;
   }
+  float pad = pixels * unitsPerPixel;
+  return Rect(bounds.origin.x - pad, bounds.origin.y - pad,
+              bounds.size.width + pad * 2.0f, bounds.size.height + pad * 2.0f);
+}
 
-  // 递归更新子节点
-  for (auto &child : children_) {
-    child->batchTransforms();
+/**
+ * @brief 子树剔除测试
+ * @param cullRect 剔除矩形（世界坐标）
+ * @param unitsPerPixel 每屏幕像素对应的世界单位
+ * @param stats 剔除统计
+ * @return 开启子树剔除且子树包围盒在剔除矩形之外返回true
+ */
+bool Node::isSubtreeCulled(const Rect &cullRect, float unitsPerPixel,
+                           CullStats &stats) const {
+  Rect bounds;
+  if (!subtreeCulling_ || !getSubtreeBounds(bounds) ||
+      padBounds(bounds, subtreePadding_, unitsPerPixel)
+          .intersects(cullRect)) {
+    return false;
+  }
+  stats.subtreesCulled++;
+  return true;
+}
+
+/**
+ * @brief 自身内容剔除测试
+ * @param cullRect 剔除矩形（世界坐标）
+ * @param unitsPerPixel 每屏幕像素对应的世界单位
+ * @param stats 剔除统计
+ * @return 内容包围盒在剔除矩形之外返回true；未报告边界的节点总是返回false
+ */
+bool Node::isContentCulled(const Rect &cullRect, float unitsPerPixel,
+                           CullStats &stats) const {
+  Rect bounds;
+  if (!getWorldBounds(bounds)) {
+    return false;
+  }
+  if (padBounds(bounds, getScreenPadding(), unitsPerPixel)
+          .intersects(cullRect)) {
+    stats.drawn++;
+    return false;
   }
+  stats.culled++;
+  return true;
 }
 
+/**
+ * @brief 批量更新变换
+ *
+ * 由变换系统按父前子后的顺序线性更新所有脏节点的世界变换矩阵
+ */
+void Node::batchTransforms() { transforms().update(); }
+
 /**
  * @brief 节点进入时的回调
  *
@@ -514,15 +693,26 @@ void Node::onUpdate(float dt) {
  * @brief 渲染回调
  * @param renderer 渲染后端引用
  *
- * 如果可见则绘制自身，然后递归渲染所有子节点
+ * 如果可见则绘制自身，然后递归渲染所有子节点；
+ * 所属场景开启剔除时跳过可见区域之外的内容与子树
  */
 void Node::onRender(RenderBackend &renderer) {
   if (!visible_)
     return;
 
+  const Rect *cullRect = scene_ ? scene_->getRenderCullRect() : nullptr;
+  const float unitsPerPixel = cullRect ? scene_->renderUnitsPerPixel_ : 0.0f;
+  if (cullRect &&
+      isSubtreeCulled(*cullRect, unitsPerPixel, scene_->cullStats_)) {
+    return;
+  }
+
   renderer.pushTransform(getLocalTransform());
   
-  onDraw(renderer);
+  if (!cullRect ||
+      !isContentCulled(*cullRect, unitsPerPixel, scene_->cullStats_)) {
+    onDraw(renderer);
+  }
 
   for (auto &child : children_) {
     child->onRender(renderer);
@@ -535,10 +725,14 @@ void Node::onRender(RenderBackend &renderer) {
  * @brief 附加到场景时的回调
  * @param scene 所属场景指针
  *
- * 设置场景引用并递归通知所有子节点
+ * 设置场景引用并递归通知所有子节点；场景开启空间索引时登记本节点
  */
 void Node::onAttachToScene(Scene *scene) {
   scene_ = scene;
+  if (scene && scene->spatialIndexing_ && static_cast<Node *>(scene) != this &&
+      spatialHandle_ == SpatialIndex::INVALID_HANDLE) {
+    spatialHandle_ = scene->spatialIndex_.insert(this);
+  }
 
   for (auto &child : children_) {
     child->onAttachToScene(scene);
@@ -548,9 +742,13 @@ void Node::onAttachToScene(Scene *scene) {
 /**
  * @brief 从场景分离时的回调
  *
- * 清除场景引用并递归通知所有子节点
+ * 从场景空间索引中移除，清除场景引用并递归通知所有子节点
  */
 void Node::onDetachFromScene() {
+  if (spatialHandle_ != SpatialIndex::INVALID_HANDLE && scene_) {
+    scene_->spatialIndex_.remove(spatialHandle_);
+  }
+  spatialHandle_ = SpatialIndex::INVALID_HANDLE;
   scene_ = nullptr;
   for (auto &child : children_) {
     child->onDetachFromScene();
@@ -563,7 +761,10 @@ void Node::onDetachFromScene() {
  *
  * 默认返回以位置为中心的空矩形，子类应重写此方法
  */
-Rect Node::getBounds() const { return Rect(position_.x, position_.y, 0, 0); }
+Rect Node::getBounds() const {
+  Vec2 position = getPosition();
+  return Rect(position.x, position.y, 0, 0);
+}
 
 /**
  * @brief 更新节点
@@ -625,26 +826,51 @@ void Node::sortChildren() {
   childrenOrderDirty_ = false;
 }
 
+/**
+ * @brief 获取按Z序排好的子节点
+ * @return 子节点列表，顺序与绘制顺序一致
+ */
+const std::vector<Ptr<Node>> &Node::getSortedChildren() {
+  if (childrenOrderDirty_) {
+    sortChildren();
+  }
+  return children_;
+}
+
 /**
  * @brief 收集渲染命令
- * @param commands 渲染命令输出向量
+ * @param commands 渲染命令缓冲区
  * @param parentZOrder 父节点的Z序
  *
- * 递归收集当前节点和所有子节点的渲染命令
+ * 递归收集当前节点和所有子节点的渲染命令；缓冲区设置了剔除矩形时
+ * 跳过可见区域之外的内容与子树
  */
-void Node::collectRenderCommands(std::vector<RenderCommand> &commands,
+void Node::collectRenderCommands(RenderCommandBuffer &commands,
                                  int parentZOrder) {
   if (!visible_)
     return;
 
+  const Rect *cullRect = commands.getCullRect();
+  const float unitsPerPixel = commands.getCullUnitsPerPixel();
+  if (cullRect &&
+      isSubtreeCulled(*cullRect, unitsPerPixel, commands.getCullStats())) {
+    return;
+  }
+
+  if (childrenOrderDirty_) {
+    sortChildren();
+  }
+
   // 计算累积 Z 序
   int accumulatedZOrder = parentZOrder + zOrder_;
 
   // 生成当前节点的渲染命令
-  generateRenderCommand(commands, accumulatedZOrder);
+  if (!cullRect ||
+      !isContentCulled(*cullRect, unitsPerPixel, commands.getCullStats())) {
+    generateRenderCommand(commands, accumulatedZOrder);
+  }
 
-  // 递归收集子节点的渲染命令
-  // 注意：这里假设子节点已经按 Z 序排序
+  // 递归收集子节点的渲染命令（子节点已按 Z 序排序）
   for (auto &child : children_) {
     child->collectRenderCommands(commands, accumulatedZOrder);
   }
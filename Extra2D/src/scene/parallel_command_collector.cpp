@@ -0,0 +1,127 @@
+#include <algorithm>
+#include <extra2d/scene/node.h>
+#include <extra2d/scene/parallel_command_collector.h>
+#include <extra2d/utils/thread_pool.h>
+
+namespace extra2d {
+
+// 每个线程（含调用线程）分到的块数，块越多负载越均衡
+static constexpr size_t CHUNKS_PER_THREAD = 4;
+
+/**
+ * @brief 并行收集渲染命令
+ * @param root 根节点
+ * @param out 输出缓冲区
+ * @param parentZOrder 根节点父级的累积 Z 序
+ *
+ * 任务按深度优先顺序排列，块是任务的连续区间，按块顺序合并即还原单线程顺序
+ */
+void ParallelCommandCollector::collect(Node &root, RenderCommandBuffer &out,
+                                       int parentZOrder) {
+  stats_ = Stats{};
+  tasks_.clear();
+  gatherTasks(root, out, parentZOrder, 0);
+  if (tasks_.empty()) {
+    return;
+  }
+
+  auto &pool = ThreadPool::get();
+  size_t chunkCount = std::min(
+      tasks_.size(), (pool.getWorkerCount() + 1) * CHUNKS_PER_THREAD);
+  auto &chunkBuffers = getChunkBuffers(out);
+  while (chunkBuffers.size() < chunkCount) {
+    chunkBuffers.push_back(std::make_unique<RenderCommandBuffer>());
+  }
+
+  // 任务均分为 chunkCount 个连续区间
+  chunkBegins_.resize(chunkCount + 1);
+  for (size_t c = 0; c <= chunkCount; ++c) {
+    chunkBegins_[c] = tasks_.size() * c / chunkCount;
+  }
+
+  pool.parallelFor(chunkCount, 1, [&](size_t begin, size_t end) {
+    for (size_t c = begin; c < end; ++c) {
+      RenderCommandBuffer &buffer = *chunkBuffers[c];
+      buffer.clear();
+      if (const Rect *cullRect = out.getCullRect()) {
+        buffer.setCullRect(*cullRect, out.getCullUnitsPerPixel());
+      } else {
+        buffer.clearCullRect();
+      }
+      for (size_t t = chunkBegins_[c]; t < chunkBegins_[c + 1]; ++t) {
+        const Task &task = tasks_[t];
+        if (task.subtree) {
+          task.node->collectRenderCommands(buffer, task.zOrder);
+        } else {
+          task.node->generateRenderCommand(buffer, task.zOrder);
+        }
+      }
+    }
+  });
+
+  for (size_t c = 0; c < chunkCount; ++c) {
+    out.append(*chunkBuffers[c]);
+  }
+  stats_.tasks = static_cast<uint32_t>(tasks_.size());
+  stats_.chunks = static_cast<uint32_t>(chunkCount);
+}
+
+/**
+ * @brief 获取输出缓冲区对应的块缓冲区组
+ * @param out 输出缓冲区
+ *
+ * 不同输出缓冲区（如渲染线程的各帧槽）使用各自的块，收集下一帧时不会
+ * 覆盖仍在途的帧所引用的帧内存
+ */
+std::vector<std::unique_ptr<RenderCommandBuffer>> &
+ParallelCommandCollector::getChunkBuffers(const RenderCommandBuffer &out) {
+  for (auto &set : chunkSets_) {
+    if (set.owner == &out) {
+      return set.buffers;
+    }
+  }
+  chunkSets_.push_back(ChunkSet{&out, {}});
+  return chunkSets_.back().buffers;
+}
+
+/**
+ * @brief 深度优先展开浅层节点，生成任务列表
+ *
+ * 可见性、剔除、子节点排序与 Z 序累积与 Node::collectRenderCommands 一致；
+ * 浅层节点的剔除在此（调用线程上）完成，统计直接计入 out
+ */
+void ParallelCommandCollector::gatherTasks(Node &node,
+                                           RenderCommandBuffer &out,
+                                           int parentZOrder, int depth) {
+  if (!node.isVisible()) {
+    return;
+  }
+
+  if (depth >= splitDepth_) {
+    tasks_.push_back({&node, parentZOrder, true});
+    stats_.subtrees++;
+    return;
+  }
+
+  const Rect *cullRect = out.getCullRect();
+  const float unitsPerPixel = out.getCullUnitsPerPixel();
+  if (cullRect &&
+      node.isSubtreeCulled(*cullRect, unitsPerPixel, out.getCullStats())) {
+    return;
+  }
+
+  if (node.childrenOrderDirty_) {
+    node.sortChildren();
+  }
+  int accumulatedZOrder = parentZOrder + node.getZOrder();
+  if (!cullRect ||
+      !node.isContentCulled(*cullRect, unitsPerPixel, out.getCullStats())) {
+    tasks_.push_back({&node, accumulatedZOrder, false});
+  }
+
+  for (const auto &child : node.getChildren()) {
+    gatherTasks(*child, out, accumulatedZOrder, depth + 1);
+  }
+}
+
+} // namespace extra2d
@@ -1,10 +1,119 @@
 #include <extra2d/graphics/render_backend.h>
-#include <extra2d/graphics/render_command.h>
 #include <extra2d/scene/scene.h>
 #include <extra2d/utils/logger.h>
 
 namespace extra2d {
 
+/**
+ * @brief 节点自身是否包含某点
+ *
+ * 报告了内容边界的节点使用世界包围盒，其余节点沿用 getBounds()
+ */
+static bool containsPointer(const Node &node, const Vec2 &worldPos) {
+  Rect bounds;
+  if (node.getWorldBounds(bounds)) {
+    return bounds.containsPoint(worldPos);
+  }
+  bounds = node.getBounds();
+  return !bounds.empty() && bounds.containsPoint(worldPos);
+}
+
+/**
+ * @brief 按绘制顺序从上到下查找命中的节点
+ *
+ * 子节点复用已按Z序排好的 children_，逆序访问；子树中没有监听器时直接返回
+ */
+static Node *hitTestTopmost(Node &node, const Vec2 &worldPos) {
+  if (!node.isVisible() || !node.hasListenersInSubtree()) {
+    return nullptr;
+  }
+
+  const auto &children = node.getSortedChildren();
+  for (auto it = children.rbegin(); it != children.rend(); ++it) {
+    if (Node *hit = hitTestTopmost(**it, worldPos)) {
+      return hit;
+    }
+  }
+
+  if (node.getEventDispatcher().hasListeners() &&
+      containsPointer(node, worldPos)) {
+    return &node;
+  }
+  return nullptr;
+}
+
+/**
+ * @brief 节点及其全部祖先是否可见
+ */
+static bool isVisibleInTree(const Node &node) {
+  if (!node.isVisible()) {
+    return false;
+  }
+  for (Ptr<Node> p = node.getParent(); p; p = p->getParent()) {
+    if (!p->isVisible()) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static int depthOf(const Node &node) {
+  int depth = 0;
+  for (Ptr<Node> p = node.getParent(); p; p = p->getParent()) {
+    ++depth;
+  }
+  return depth;
+}
+
+/**
+ * @brief 判断 a 是否在 b 之后绘制（即位于 b 之上）
+ *
+ * 后代在祖先之后绘制；否则比较两者在最近公共祖先下所属分支的子节点顺序
+ */
+static bool isDrawnAfter(Node &a, Node &b) {
+  Node *x = &a;
+  Node *y = &b;
+  int dx = depthOf(a);
+  int dy = depthOf(b);
+  while (dx > dy) {
+    Node *parent = x->getParent().get();
+    if (parent == y) {
+      return true;
+    }
+    x = parent;
+    --dx;
+  }
+  while (dy > dx) {
+    Node *parent = y->getParent().get();
+    if (parent == x) {
+      return false;
+    }
+    y = parent;
+    --dy;
+  }
+
+  Node *parent = x->getParent().get();
+  Node *otherParent = y->getParent().get();
+  while (parent != otherParent) {
+    x = parent;
+    y = otherParent;
+    parent = x->getParent().get();
+    otherParent = y->getParent().get();
+  }
+  if (!parent) {
+    return false;
+  }
+  for (const auto &child : parent->getSortedChildren()) {
+    if (child.get() == x) {
+      return false;
+    }
+    if (child.get() == y) {
+      return true;
+    }
+  }
+  return false;
+}
+
 /**
  * @brief 构造函数，初始化场景对象
  *
@@ -12,6 +121,13 @@ namespace extra2d {
  */
 Scene::Scene() { defaultCamera_ = makePtr<Camera>(); }
 
+/**
+ * @brief 析构函数
+ *
+ * 先清空空间索引并重置节点句柄，基类析构释放子节点时不再访问索引
+ */
+Scene::~Scene() { setSpatialIndexing(false); }
+
 /**
  * @brief 设置场景相机
  * @param camera 要设置的相机智能指针
@@ -42,6 +158,139 @@ void Scene::setViewportSize(const Size &size) {
   setViewportSize(size.width, size.height);
 }
 
+/**
+ * @brief 设置剔除使用的可见区域
+ * @param rect 世界坐标矩形
+ * @param unitsPerPixel 每屏幕像素对应的世界单位
+ */
+void Scene::setCullRect(const Rect &rect, float unitsPerPixel) {
+  cullRect_ = rect;
+  cullUnitsPerPixel_ = unitsPerPixel;
+  hasCullRect_ = true;
+}
+
+/**
+ * @brief 获取剔除使用的可见区域
+ * @return 已设置的可见区域，未设置时为活动相机的可见范围
+ */
+Rect Scene::getCullRect() const {
+  if (hasCullRect_) {
+    return cullRect_;
+  }
+  Camera *camera = getActiveCamera();
+  return camera ? camera->getVisibleRect() : Rect(Vec2::Zero(), viewportSize_);
+}
+
+/**
+ * @brief 获取剔除使用的每像素世界单位
+ * @return 已设置的值，未设置时按活动相机与视口尺寸计算
+ */
+float Scene::getCullUnitsPerPixel() const {
+  if (hasCullRect_) {
+    return cullUnitsPerPixel_;
+  }
+  Camera *camera = getActiveCamera();
+  return camera ? Camera::computeUnitsPerPixel(
+                      camera->getViewProjectionTransform(), viewportSize_)
+                : 1.0f;
+}
+
+/**
+ * @brief 开启或关闭空间索引
+ * @param enabled 是否开启
+ *
+ * 开启时登记已附加到本场景的全部节点，之后附加的节点自动登记；
+ * 关闭时清空索引
+ */
+void Scene::setSpatialIndexing(bool enabled) {
+  if (enabled == spatialIndexing_) {
+    return;
+  }
+  spatialIndexing_ = enabled;
+  if (enabled) {
+    registerSpatialSubtree(*this);
+  } else {
+    for (Node *node : spatialIndex_.clear()) {
+      node->spatialHandle_ = SpatialIndex::INVALID_HANDLE;
+    }
+  }
+}
+
+/**
+ * @brief 登记子树中已附加到本场景、尚未登记的节点
+ */
+void Scene::registerSpatialSubtree(Node &node) {
+  for (const auto &child : node.getChildren()) {
+    if (child->scene_ == this &&
+        child->spatialHandle_ == SpatialIndex::INVALID_HANDLE) {
+      child->spatialHandle_ = spatialIndex_.insert(child.get());
+    }
+    registerSpatialSubtree(*child);
+  }
+}
+
+/**
+ * @brief 查询包围盒与矩形相交的节点
+ * @param rect 世界坐标矩形
+ * @param out 结果（追加）
+ */
+void Scene::queryRect(const Rect &rect, std::vector<Node *> &out) {
+  spatialIndex_.refresh();
+  spatialIndex_.queryRect(rect, out);
+}
+
+/**
+ * @brief 查询包围盒包含某点的节点
+ * @param point 世界坐标
+ * @param out 结果（追加）
+ */
+void Scene::queryPoint(const Vec2 &point, std::vector<Node *> &out) {
+  spatialIndex_.refresh();
+  spatialIndex_.queryPoint(point, out);
+}
+
+/**
+ * @brief 查询包围盒与圆相交的节点
+ * @param center 圆心（世界坐标）
+ * @param radius 半径
+ * @param out 结果（追加）
+ */
+void Scene::queryRadius(const Vec2 &center, float radius,
+                        std::vector<Node *> &out) {
+  spatialIndex_.refresh();
+  spatialIndex_.queryRadius(center, radius, out);
+}
+
+/**
+ * @brief 命中测试
+ * @param worldPos 世界坐标
+ * @return 最上层命中且注册了监听器的节点，未命中返回nullptr
+ *
+ * 开启空间索引时查询包含该点的节点（复用成员缓冲区），在其中选出
+ * 绘制顺序最靠上的一个；否则从场景根按Z序逆序遍历
+ */
+Node *Scene::hitTest(const Vec2 &worldPos) {
+  if (!hasListenersInSubtree()) {
+    return nullptr;
+  }
+  if (!spatialIndexing_) {
+    return hitTestTopmost(*this, worldPos);
+  }
+
+  hitCandidates_.clear();
+  queryPoint(worldPos, hitCandidates_);
+  Node *best = nullptr;
+  for (Node *node : hitCandidates_) {
+    if (!node->getEventDispatcher().hasListeners() || !isVisibleInTree(*node)) {
+      continue;
+    }
+    if (!best || isDrawnAfter(*node, *best)) {
+      best = node;
+    }
+  }
+  return best;
+}
+
 /**
  * @brief 渲染场景
  * @param renderer 渲染后端引用
@@ -62,20 +311,71 @@ void Scene::renderScene(RenderBackend &renderer) {
  * @brief 渲染场景内容
  * @param renderer 渲染后端引用
  *
- * 批量更新节点变换，开始精灵批处理并渲染
+ * 批量更新节点变换，开始精灵批处理并渲染；延迟模式下先收集（可按子树
+ * 并行）并排序渲染命令，再由执行器回放；开启剔除时两种模式均跳过
+ * 可见区域之外的节点
+ * 剔除沿场景树按子树包围盒进行（需保持绘制顺序），不读取空间索引，
+ * 因此渲染时不刷新索引，由查询按需刷新
  * 注意：视图投影矩阵由 Application 通过 CameraService 设置
  */
 void Scene::renderContent(RenderBackend &renderer) {
   if (!isVisible())
     return;
 
-  batchTransforms();
-
   renderer.beginSpriteBatch();
-  render(renderer);
+  if (deferredRendering_) {
+    commandBuffer_.clear();
+    recordCommands(commandBuffer_);
+    commandBuffer_.sortCommands();
+    commandExecutor_.execute(renderer, commandBuffer_);
+  } else {
+    batchTransforms();
+    cullStats_ = CullStats{};
+    Rect cullRect;
+    if (culling_) {
+      cullRect = getCullRect();
+      renderCullRect_ = &cullRect;
+      renderUnitsPerPixel_ = getCullUnitsPerPixel();
+    }
+    render(renderer);
+    renderCullRect_ = nullptr;
+  }
   renderer.endSpriteBatch();
 }
 
+/**
+ * @brief 录制渲染命令
+ * @param commands 渲染命令缓冲区（追加，不清空、不排序）
+ *
+ * 先批量更新节点变换，使收集过程只读取节点；开启并行收集时按子树并行，
+ * 开启剔除时跳过可见区域之外的节点，统计见 getCullStats()
+ */
+void Scene::recordCommands(RenderCommandBuffer &commands) {
+  cullStats_ = CullStats{};
+  if (!isVisible())
+    return;
+
+  batchTransforms();
+
+  const CullStats before = commands.getCullStats();
+  if (culling_) {
+    commands.setCullRect(getCullRect(), getCullUnitsPerPixel());
+  }
+  if (parallelCollection_) {
+    commandCollector_.collect(*this, commands, 0);
+  } else {
+    collectRenderCommands(commands, 0);
+  }
+  if (culling_) {
+    commands.clearCullRect();
+  }
+
+  const CullStats &after = commands.getCullStats();
+  cullStats_.drawn = after.drawn - before.drawn;
+  cullStats_.culled = after.culled - before.culled;
+  cullStats_.subtreesCulled = after.subtreesCulled - before.subtreesCulled;
+}
+
 /**
  * @brief 更新场景
  * @param dt 帧间隔时间（秒）
@@ -104,12 +404,12 @@ void Scene::onExit() { Node::onExit(); }
 
 /**
  * @brief 收集渲染命令
- * @param commands 渲染命令输出向量
+ * @param commands 渲染命令缓冲区
  * @param parentZOrder 父节点的Z序
  *
  * 如果场景不可见则直接返回，否则从场景的子节点开始收集渲染命令
  */
-void Scene::collectRenderCommands(std::vector<RenderCommand> &commands,
+void Scene::collectRenderCommands(RenderCommandBuffer &commands,
                                   int parentZOrder) {
   if (!isVisible())
     return;
@@ -1,4 +1,3 @@
-#include <algorithm>
 #include <extra2d/app/application.h>
 #include <extra2d/graphics/render_backend.h>
 #include <extra2d/graphics/render_command.h>
@@ -10,41 +9,6 @@ namespace extra2d {
 
 namespace {
 
-/**
- * @brief 命中测试 - 从节点树中找到最上层的可交互节点
- * @param node 要测试的节点
- * @param worldPos 世界坐标位置
- * @return 命中的节点指针，未命中返回nullptr
- */
-Node *hitTestTopmost(const Ptr<Node> &node, const Vec2 &worldPos) {
-  if (!node || !node->isVisible()) {
-    return nullptr;
-  }
-
-  std::vector<Ptr<Node>> children = node->getChildren();
-  std::stable_sort(children.begin(), children.end(),
-                   [](const Ptr<Node> &a, const Ptr<Node> &b) {
-                     return a->getZOrder() < b->getZOrder();
-                   });
-
-  for (auto it = children.rbegin(); it != children.rend(); ++it) {
-    if (Node *hit = hitTestTopmost(*it, worldPos)) {
-      return hit;
-    }
-  }
-
-  if (node->getEventDispatcher().getTotalListenerCount() == 0) {
-    return nullptr;
-  }
-
-  Rect bounds = node->getBounds();
-  if (!bounds.empty() && bounds.containsPoint(worldPos)) {
-    return node.get();
-  }
-
-  return nullptr;
-}
-
 /**
  * @brief 向节点分发事件
  * @param node 目标节点
@@ -349,13 +313,13 @@ void SceneManager::render(RenderBackend &renderer) {
 
 /**
  * @brief 收集渲染命令
- * @param commands 渲染命令输出向量
+ * @param commands 渲染命令缓冲区
  *
- * 从当前场景收集所有渲染命令
+ * 从当前场景录制所有渲染命令（含变换更新与并行收集）
  */
-void SceneManager::collectRenderCommands(std::vector<RenderCommand> &commands) {
+void SceneManager::collectRenderCommands(RenderCommandBuffer &commands) {
   if (!sceneStack_.empty()) {
-    sceneStack_.top()->collectRenderCommands(commands, 0);
+    sceneStack_.top()->recordCommands(commands);
   }
 }
 
@@ -396,8 +360,7 @@ void SceneManager::dispatchPointerEvents(Scene &scene) {
     worldPos = camera->screenToWorld(screenPos);
   }
 
-  Ptr<Node> root = scene.shared_from_this();
-  Node *newHover = hitTestTopmost(root, worldPos);
+  Node *newHover = scene.hitTest(worldPos);
 
   if (newHover != hoverTarget_) {
     if (hoverTarget_) {
@@ -1,5 +1,6 @@
 #include <algorithm>
 #include <cmath>
+#include <extra2d/graphics/polygon_triangulator.h>
 #include <extra2d/graphics/render_backend.h>
 #include <extra2d/graphics/render_command.h>
 #include <extra2d/scene/shape_node.h>
@@ -90,7 +91,7 @@ Ptr<ShapeNode> ShapeNode::createFilledRect(const Rect &rect,
  * @param center 圆心坐标
  * @param radius 圆的半径
  * @param color 圆的边框颜色
- * @param segments 圆的分段数（边数）
+ * @param segments 圆的分段数（边数），CIRCLE_SEGMENTS_AUTO 为自动
  * @param width 边框线宽
  * @return 新创建的圆形形状节点智能指针
  */
@@ -114,7 +115,7 @@ Ptr<ShapeNode> ShapeNode::createCircle(const Vec2 &center, float radius,
  * @param center 圆心坐标
  * @param radius 圆的半径
  * @param color 圆的填充颜色
- * @param segments 圆的分段数（边数）
+ * @param segments 圆的分段数（边数），CIRCLE_SEGMENTS_AUTO 为自动
  * @return 新创建的填充圆形形状节点智能指针
  */
 Ptr<ShapeNode> ShapeNode::createFilledCircle(const Vec2 &center, float radius,
@@ -124,6 +125,57 @@ Ptr<ShapeNode> ShapeNode::createFilledCircle(const Vec2 &center, float radius,
   return node;
 }
 
+/**
+ * @brief 创建圆角矩形形状节点（空心）
+ * @param rect 矩形区域
+ * @param radius 圆角半径
+ * @param color 边框颜色
+ * @param width 边框线宽
+ * @return 新创建的圆角矩形形状节点智能指针
+ */
+Ptr<ShapeNode> ShapeNode::createRoundedRect(const Rect &rect, float radius,
+                                            const Color &color, float width) {
+  auto node = createRect(rect, color, width);
+  node->shapeType_ = ShapeType::RoundedRect;
+  node->cornerRadius_ = radius;
+  return node;
+}
+
+/**
+ * @brief 创建填充圆角矩形形状节点
+ * @param rect 矩形区域
+ * @param radius 圆角半径
+ * @param color 填充颜色
+ * @return 新创建的填充圆角矩形形状节点智能指针
+ */
+Ptr<ShapeNode> ShapeNode::createFilledRoundedRect(const Rect &rect,
+                                                  float radius,
+                                                  const Color &color) {
+  auto node = createRoundedRect(rect, radius, color, 0);
+  node->filled_ = true;
+  return node;
+}
+
+/**
+ * @brief 创建填充胶囊形状节点
+ * @param start 线段起点坐标
+ * @param end 线段终点坐标
+ * @param radius 胶囊半径（半宽）
+ * @param color 填充颜色
+ * @return 新创建的胶囊形状节点智能指针
+ */
+Ptr<ShapeNode> ShapeNode::createCapsule(const Vec2 &start, const Vec2 &end,
+                                        float radius, const Color &color) {
+  auto node = makePtr<ShapeNode>();
+  node->shapeType_ = ShapeType::Capsule;
+  node->color_ = color;
+  node->lineWidth_ = 0;
+  node->filled_ = true;
+  node->cornerRadius_ = radius;
+  node->points_ = {start, end};
+  return node;
+}
+
 /**
  * @brief 创建三角形形状节点（空心）
  * @param p1 三角形第一个顶点坐标
@@ -198,6 +250,8 @@ Ptr<ShapeNode> ShapeNode::createFilledPolygon(const std::vector<Vec2> &points,
  */
 void ShapeNode::setPoints(const std::vector<Vec2> &points) {
   points_ = points;
+  fillIndicesDirty_ = true;
+  markBoundsDirty();
 }
 
 /**
@@ -206,6 +260,8 @@ void ShapeNode::setPoints(const std::vector<Vec2> &points) {
  */
 void ShapeNode::addPoint(const Vec2 &point) {
   points_.push_back(point);
+  fillIndicesDirty_ = true;
+  markBoundsDirty();
 }
 
 /**
@@ -213,26 +269,54 @@ void ShapeNode::addPoint(const Vec2 &point) {
  */
 void ShapeNode::clearPoints() {
   points_.clear();
+  fillIndicesDirty_ = true;
+  markBoundsDirty();
+}
+
+/**
+ * @brief 获取填充多边形的三角形索引
+ * @return 耳切剖分结果，顶点未变化时直接复用缓存
+ */
+const std::vector<uint32_t> &ShapeNode::getFillIndices() {
+  if (fillIndicesDirty_) {
+    PolygonTriangulator::triangulate(points_, fillIndices_);
+    fillIndicesDirty_ = false;
+  }
+  return fillIndices_;
 }
 
 /**
  * @brief 获取形状的边界矩形
  * @return 包围形状的轴对齐边界矩形
  *
- * 计算形状在世界坐标系中的边界框，考虑位置偏移和线宽
+ * 局部边界按节点位置平移，不含按屏幕像素计的描边，不考虑旋转与缩放
  */
 Rect ShapeNode::getBounds() const {
-  if (points_.empty()) {
+  Rect bounds;
+  if (!getLocalBounds(bounds)) {
     return Rect();
   }
+  bounds.origin += getPosition();
+  return bounds;
+}
 
-  Vec2 offset = getPosition();
+/**
+ * @brief 获取形状在局部坐标系中的边界
+ * @param bounds 输出边界，包含胶囊半径与点的半径；描边以屏幕像素计，
+ *               不计入局部边界，见 getScreenPadding()
+ * @return 没有顶点时返回false
+ */
+bool ShapeNode::getLocalBounds(Rect &bounds) const {
+  if (points_.empty()) {
+    return false;
+  }
 
   if (shapeType_ == ShapeType::Circle && points_.size() >= 2) {
     float radius = std::abs(points_[1].x);
-    Vec2 center = points_[0] + offset;
-    return Rect(center.x - radius, center.y - radius, radius * 2.0f,
-                radius * 2.0f);
+    const Vec2 &center = points_[0];
+    bounds = Rect(center.x - radius, center.y - radius, radius * 2.0f,
+                  radius * 2.0f);
+    return true;
   }
 
   float minX = std::numeric_limits<float>::infinity();
@@ -241,26 +325,38 @@ Rect ShapeNode::getBounds() const {
   float maxY = -std::numeric_limits<float>::infinity();
 
   for (const auto &p : points_) {
-    Vec2 world = p + offset;
-    minX = std::min(minX, world.x);
-    minY = std::min(minY, world.y);
-    maxX = std::max(maxX, world.x);
-    maxY = std::max(maxY, world.y);
+    minX = std::min(minX, p.x);
+    minY = std::min(minY, p.y);
+    maxX = std::max(maxX, p.x);
+    maxY = std::max(maxY, p.y);
   }
 
+  // 点以 lineWidth 为直径、按局部单位绘制，胶囊的半宽同样是局部单位
   float inflate = 0.0f;
-  if (!filled_ &&
-      (shapeType_ == ShapeType::Line || shapeType_ == ShapeType::Rect ||
-       shapeType_ == ShapeType::Triangle || shapeType_ == ShapeType::Polygon ||
-       shapeType_ == ShapeType::Point)) {
+  if (shapeType_ == ShapeType::Capsule) {
+    inflate = std::abs(cornerRadius_);
+  } else if (shapeType_ == ShapeType::Point) {
     inflate = std::max(0.0f, lineWidth_ * 0.5f);
   }
-  if (shapeType_ == ShapeType::Point) {
-    inflate = std::max(inflate, lineWidth_ * 0.5f);
-  }
 
-  return Rect(minX - inflate, minY - inflate, (maxX - minX) + inflate * 2.0f,
-              (maxY - minY) + inflate * 2.0f);
+  bounds = Rect(minX - inflate, minY - inflate, (maxX - minX) + inflate * 2.0f,
+                (maxY - minY) + inflate * 2.0f);
+  return true;
+}
+
+/**
+ * @brief 描边超出局部边界的屏幕像素宽度
+ * @return 描边形状返回半线宽，填充形状与点返回0
+ *
+ * 描边宽度以屏幕像素计（SDF 与三角化路径一致），不随缩放变化，
+ * 因此不计入局部边界，由剔除按当前缩放换算
+ */
+float ShapeNode::getScreenPadding() const {
+  if (shapeType_ == ShapeType::Point ||
+      (filled_ && shapeType_ != ShapeType::Line)) {
+    return 0.0f;
+  }
+  return std::max(0.0f, lineWidth_ * 0.5f);
 }
 
 /**
@@ -276,10 +372,18 @@ void ShapeNode::onDraw(RenderBackend &renderer) {
     return;
   }
 
+  // 圆类形状优先走 SDF：单个四边形、边缘抗锯齿，无需 CPU 细分
+  const bool sdf = renderer.supportsShapeSDF();
+  const float stroke = filled_ ? 0.0f : lineWidth_;
+
   switch (shapeType_) {
   case ShapeType::Point:
     if (!points_.empty()) {
-      renderer.fillCircle(points_[0], lineWidth_ * 0.5f, color_, 8);
+      if (sdf) {
+        renderer.drawCircleSDF(points_[0], lineWidth_ * 0.5f, color_);
+      } else {
+        renderer.fillCircle(points_[0], lineWidth_ * 0.5f, color_, 8);
+      }
     }
     break;
 
@@ -308,7 +412,9 @@ void ShapeNode::onDraw(RenderBackend &renderer) {
   case ShapeType::Circle:
     if (points_.size() >= 2) {
       float radius = points_[1].x;
-      if (filled_) {
+      if (sdf) {
+        renderer.drawCircleSDF(points_[0], radius, color_, stroke);
+      } else if (filled_) {
         renderer.fillCircle(points_[0], radius, color_, segments_);
       } else {
         renderer.drawCircle(points_[0], radius, color_, segments_, lineWidth_);
@@ -331,117 +437,184 @@ void ShapeNode::onDraw(RenderBackend &renderer) {
   case ShapeType::Polygon:
     if (!points_.empty()) {
       if (filled_) {
-        renderer.fillPolygon(points_, color_);
+        const auto &indices = getFillIndices();
+        renderer.fillPolygonMesh(points_.data(), points_.size(),
+                                 indices.data(), indices.size(), color_);
       } else {
         renderer.drawPolygon(points_, color_, lineWidth_);
       }
     }
     break;
+
+  case ShapeType::RoundedRect:
+  case ShapeType::Capsule:
+    if (sdf) {
+      if (shapeType_ == ShapeType::Capsule && points_.size() >= 2) {
+        renderer.drawCapsuleSDF(points_[0], points_[1], cornerRadius_, color_,
+                                stroke);
+      } else if (shapeType_ == ShapeType::RoundedRect && points_.size() >= 4) {
+        Rect rect(points_[0].x, points_[0].y, points_[2].x - points_[0].x,
+                  points_[2].y - points_[0].y);
+        renderer.drawRoundedRectSDF(rect, cornerRadius_, color_, stroke);
+      }
+      break;
+    }
+    buildOutline(outline_);
+    if (outline_.size() >= 3) {
+      if (filled_) {
+        renderer.fillPolygon(outline_, color_);
+      } else {
+        renderer.drawPolygon(outline_, color_, lineWidth_);
+      }
+    }
+    break;
+  }
+}
+
+/**
+ * @brief 生成圆角矩形/胶囊的折线近似（凸多边形）
+ * @param out 输出顶点，按顺序排列
+ *
+ * 每段圆弧的分段数取 segments_ 的四分之一（自动模式按 32 段计），
+ * 供不支持 SDF 的后端与渲染命令使用
+ */
+void ShapeNode::buildOutline(std::vector<Vec2> &out) const {
+  out.clear();
+  int circleSegments = segments_ > 0 ? segments_ : 32;
+  int arcSegments = std::max(circleSegments / 4, 1);
+
+  auto appendArc = [&](const Vec2 &center, float radius, float startAngle,
+                       float sweep) {
+    for (int i = 0; i <= arcSegments; ++i) {
+      float angle = startAngle + sweep * static_cast<float>(i) /
+                                     static_cast<float>(arcSegments);
+      out.push_back(Vec2(center.x + radius * std::cos(angle),
+                         center.y + radius * std::sin(angle)));
+    }
+  };
+
+  if (shapeType_ == ShapeType::RoundedRect && points_.size() >= 4) {
+    float minX = std::min(points_[0].x, points_[2].x);
+    float maxX = std::max(points_[0].x, points_[2].x);
+    float minY = std::min(points_[0].y, points_[2].y);
+    float maxY = std::max(points_[0].y, points_[2].y);
+    float r = std::clamp(cornerRadius_, 0.0f,
+                         std::min(maxX - minX, maxY - minY) * 0.5f);
+    const float quarter = PI_F * 0.5f;
+    appendArc(Vec2(maxX - r, minY + r), r, -quarter, quarter);
+    appendArc(Vec2(maxX - r, maxY - r), r, 0.0f, quarter);
+    appendArc(Vec2(minX + r, maxY - r), r, quarter, quarter);
+    appendArc(Vec2(minX + r, minY + r), r, PI_F, quarter);
+  } else if (shapeType_ == ShapeType::Capsule && points_.size() >= 2) {
+    Vec2 dir = points_[1] - points_[0];
+    float base = std::atan2(dir.y, dir.x);
+    float r = std::abs(cornerRadius_);
+    arcSegments *= 2;
+    appendArc(points_[1], r, base - PI_F * 0.5f, PI_F);
+    appendArc(points_[0], r, base + PI_F * 0.5f, PI_F);
   }
 }
 
 /**
  * @brief 生成渲染命令
- * @param commands 渲染命令输出向量
+ * @param commands 渲染命令缓冲区
  * @param zOrder 渲染层级
  *
  * 根据形状类型生成对应的渲染命令并添加到命令列表
  */
-void ShapeNode::generateRenderCommand(std::vector<RenderCommand> &commands,
+void ShapeNode::generateRenderCommand(RenderCommandBuffer &commands,
                                       int zOrder) {
   if (points_.empty()) {
     return;
   }
 
-  Vec2 offset = getPosition();
-  RenderCommand cmd;
-  cmd.layer = zOrder;
+  // 顶点保持局部坐标，世界变换随命令携带（与 onDraw 经变换栈绘制一致）
+  const Affine2D transform = getWorldTransform();
+  const float strokeWidth = filled_ ? 0.0f : lineWidth_;
 
   switch (shapeType_) {
   case ShapeType::Point:
-    if (!points_.empty()) {
-      cmd.type = RenderCommandType::FilledCircle;
-      cmd.data =
-          CircleCommandData{points_[0] + offset, lineWidth_ * 0.5f, color_, 8, 0.0f, true};
-    }
+    commands.add(RenderCommandType::FilledCircle, zOrder, transform,
+                 CircleCommandData{points_[0], lineWidth_ * 0.5f, color_, 8,
+                                   0.0f, true});
     break;
 
   case ShapeType::Line:
     if (points_.size() >= 2) {
-      cmd.type = RenderCommandType::Line;
-      cmd.data = LineCommandData{points_[0] + offset, points_[1] + offset, color_,
-                          lineWidth_};
+      commands.add(RenderCommandType::Line, zOrder, transform,
+                   LineCommandData{points_[0], points_[1], color_, lineWidth_});
     }
     break;
 
   case ShapeType::Rect:
     if (points_.size() >= 4) {
-      if (filled_) {
-        cmd.type = RenderCommandType::FilledRect;
-        Rect rect(points_[0].x, points_[0].y, points_[2].x - points_[0].x,
-                  points_[2].y - points_[0].y);
-        cmd.data =
-            RectCommandData{Rect(rect.origin + offset, rect.size), color_, 0.0f, true};
-      } else {
-        cmd.type = RenderCommandType::Rect;
-        Rect rect(points_[0].x, points_[0].y, points_[2].x - points_[0].x,
-                  points_[2].y - points_[0].y);
-        cmd.data =
-            RectCommandData{Rect(rect.origin + offset, rect.size), color_, lineWidth_, false};
-      }
+      Rect rect(points_[0].x, points_[0].y, points_[2].x - points_[0].x,
+                points_[2].y - points_[0].y);
+      commands.add(filled_ ? RenderCommandType::FilledRect
+                           : RenderCommandType::Rect,
+                   zOrder, transform,
+                   RectCommandData{rect, color_, strokeWidth, filled_});
     }
     break;
 
   case ShapeType::Circle:
     if (points_.size() >= 2) {
       float radius = points_[1].x;
-      if (filled_) {
-        cmd.type = RenderCommandType::FilledCircle;
-        cmd.data =
-            CircleCommandData{points_[0] + offset, radius, color_, segments_, 0.0f, true};
-      } else {
-        cmd.type = RenderCommandType::Circle;
-        cmd.data = CircleCommandData{points_[0] + offset, radius, color_, segments_,
-                              lineWidth_, false};
-      }
+      commands.add(filled_ ? RenderCommandType::FilledCircle
+                           : RenderCommandType::Circle,
+                   zOrder, transform,
+                   CircleCommandData{points_[0], radius, color_, segments_,
+                                     strokeWidth, filled_});
     }
     break;
 
   case ShapeType::Triangle:
     if (points_.size() >= 3) {
-      Vec2 p1 = points_[0] + offset;
-      Vec2 p2 = points_[1] + offset;
-      Vec2 p3 = points_[2] + offset;
-      if (filled_) {
-        cmd.type = RenderCommandType::FilledTriangle;
-        cmd.data = TriangleCommandData{p1, p2, p3, color_, 0.0f, true};
-      } else {
-        cmd.type = RenderCommandType::Triangle;
-        cmd.data = TriangleCommandData{p1, p2, p3, color_, lineWidth_, false};
-      }
+      commands.add(filled_ ? RenderCommandType::FilledTriangle
+                           : RenderCommandType::Triangle,
+                   zOrder, transform,
+                   TriangleCommandData{points_[0], points_[1], points_[2],
+                                       color_, strokeWidth, filled_});
     }
     break;
 
   case ShapeType::Polygon:
-    if (!points_.empty()) {
-      std::vector<Vec2> transformedPoints;
-      transformedPoints.reserve(points_.size());
-      for (const auto &p : points_) {
-        transformedPoints.push_back(p + offset);
-      }
+    if (filled_ && points_.size() >= 3) {
+      // 剖分结果跨帧缓存；顶点与索引拷贝到帧内存，渲染线程执行时
+      // 节点可能已被主线程修改
+      const auto &indices = getFillIndices();
+      commands.add(
+          RenderCommandType::FilledPolygonMesh, zOrder, transform,
+          PolygonMeshCommandData{
+              commands.copyPoints(points_.data(), points_.size()),
+              points_.size(),
+              commands.copyIndices(indices.data(), indices.size()),
+              indices.size(), color_});
+    } else if (!filled_) {
+      commands.add(RenderCommandType::Polygon, zOrder, transform,
+                   PolygonCommandData{
+                       commands.copyPoints(points_.data(), points_.size()),
+                       points_.size(), color_, lineWidth_, false});
+    }
+    break;
 
-      if (filled_) {
-        cmd.type = RenderCommandType::FilledPolygon;
-        cmd.data = PolygonCommandData{transformedPoints, color_, 0.0f, true};
-      } else {
-        cmd.type = RenderCommandType::Polygon;
-        cmd.data = PolygonCommandData{transformedPoints, color_, lineWidth_, false};
-      }
+  case ShapeType::RoundedRect:
+  case ShapeType::Capsule: {
+    // 轮廓写入复用的暂存数组，再拷贝到命令缓冲区的帧内存
+    buildOutline(outline_);
+    if (outline_.size() < 3) {
+      break;
     }
+    commands.add(filled_ ? RenderCommandType::FilledPolygon
+                         : RenderCommandType::Polygon,
+                 zOrder, transform,
+                 PolygonCommandData{commands.copyPoints(outline_.data(),
+                                                        outline_.size()),
+                                    outline_.size(), color_, strokeWidth,
+                                    filled_});
     break;
   }
-
-  commands.push_back(std::move(cmd));
+  }
 }
 
 } // namespace extra2d
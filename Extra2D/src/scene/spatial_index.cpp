@@ -0,0 +1,308 @@
+#include <algorithm>
+#include <cmath>
+#include <extra2d/scene/node.h>
+#include <extra2d/scene/spatial_index.h>
+
+namespace extra2d {
+
+/**
+ * @brief 世界坐标换算为单元坐标（限制在 int32 范围内）
+ */
+static int32_t toCell(float v, float invCellSize) {
+  float c = std::floor(v * invCellSize);
+  if (!(c > -1.0e9f)) {
+    return -1000000000;
+  }
+  if (c > 1.0e9f) {
+    return 1000000000;
+  }
+  return static_cast<int32_t>(c);
+}
+
+/**
+ * @brief 构造函数
+ * @param cellSize 网格单元边长
+ */
+SpatialIndex::SpatialIndex(float cellSize)
+    : cellSize_(cellSize > 0.0f ? cellSize : DEFAULT_CELL_SIZE),
+      invCellSize_(1.0f / cellSize_) {}
+
+/**
+ * @brief 设置网格单元边长并重新登记全部节点
+ * @param cellSize 单元边长
+ */
+void SpatialIndex::setCellSize(float cellSize) {
+  if (cellSize <= 0.0f || cellSize == cellSize_) {
+    return;
+  }
+  cellSize_ = cellSize;
+  invCellSize_ = 1.0f / cellSize;
+  cells_.clear();
+  oversized_.clear();
+  for (Handle h = 0; h < entries_.size(); ++h) {
+    if (entries_[h].node != nullptr && entries_[h].hasBounds) {
+      entries_[h].cells = rangeOf(entries_[h].bounds);
+      link(h);
+    }
+  }
+}
+
+/**
+ * @brief 登记节点
+ * @param node 节点
+ * @return 句柄
+ */
+SpatialIndex::Handle SpatialIndex::insert(Node *node) {
+  Handle handle;
+  if (!freeList_.empty()) {
+    handle = freeList_.back();
+    freeList_.pop_back();
+  } else {
+    handle = static_cast<Handle>(entries_.size());
+    entries_.emplace_back();
+  }
+  Entry &entry = entries_[handle];
+  entry = Entry{};
+  entry.node = node;
+  markDirty(handle);
+  return handle;
+}
+
+/**
+ * @brief 移除节点
+ * @param handle 句柄
+ *
+ * 脏队列中残留的句柄在 refresh() 时按 node 为空跳过
+ */
+void SpatialIndex::remove(Handle handle) {
+  if (handle >= entries_.size() || entries_[handle].node == nullptr) {
+    return;
+  }
+  unlink(handle);
+  entries_[handle] = Entry{};
+  freeList_.push_back(handle);
+}
+
+/**
+ * @brief 标记节点需要重算包围盒
+ * @param handle 句柄
+ */
+void SpatialIndex::markDirty(Handle handle) {
+  Entry &entry = entries_[handle];
+  if (!entry.dirty) {
+    entry.dirty = true;
+    dirtyQueue_.push_back(handle);
+  }
+}
+
+/**
+ * @brief 重算被标记节点的包围盒
+ *
+ * 包围盒覆盖的单元范围不变时只更新包围盒本身
+ */
+void SpatialIndex::refresh() {
+  for (Handle handle : dirtyQueue_) {
+    Entry &entry = entries_[handle];
+    if (entry.node == nullptr || !entry.dirty) {
+      continue;
+    }
+    entry.dirty = false;
+
+    Rect bounds;
+    bool hasBounds = entry.node->getWorldBounds(bounds);
+    CellRange cells = hasBounds ? rangeOf(bounds) : CellRange{};
+    if (hasBounds && entry.hasBounds && cells == entry.cells) {
+      entry.bounds = bounds;
+      continue;
+    }
+
+    unlink(handle);
+    entry.bounds = bounds;
+    entry.hasBounds = hasBounds;
+    entry.cells = cells;
+    if (hasBounds) {
+      link(handle);
+    }
+  }
+  dirtyQueue_.clear();
+}
+
+/**
+ * @brief 移除全部节点
+ * @return 被移除的节点
+ */
+std::vector<Node *> SpatialIndex::clear() {
+  std::vector<Node *> nodes;
+  nodes.reserve(size());
+  for (const Entry &entry : entries_) {
+    if (entry.node != nullptr) {
+      nodes.push_back(entry.node);
+    }
+  }
+  entries_.clear();
+  freeList_.clear();
+  dirtyQueue_.clear();
+  oversized_.clear();
+  cells_.clear();
+  return nodes;
+}
+
+/**
+ * @brief 计算包围盒覆盖的单元范围
+ */
+SpatialIndex::CellRange SpatialIndex::rangeOf(const Rect &bounds) const {
+  CellRange range;
+  range.x0 = toCell(bounds.left(), invCellSize_);
+  range.y0 = toCell(bounds.top(), invCellSize_);
+  range.x1 = toCell(bounds.right(), invCellSize_);
+  range.y1 = toCell(bounds.bottom(), invCellSize_);
+  return range;
+}
+
+/**
+ * @brief 将条目登记到其单元范围（或大节点列表）
+ */
+void SpatialIndex::link(Handle handle) {
+  Entry &entry = entries_[handle];
+  entry.oversized = entry.cells.cellCount() > MAX_CELLS_PER_ENTRY;
+  if (entry.oversized) {
+    oversized_.push_back(handle);
+    return;
+  }
+  for (int32_t y = entry.cells.y0; y <= entry.cells.y1; ++y) {
+    for (int32_t x = entry.cells.x0; x <= entry.cells.x1; ++x) {
+      cells_[cellKey(x, y)].push_back(handle);
+    }
+  }
+}
+
+/**
+ * @brief 将条目从网格中移除
+ *
+ * 单元内的句柄列表无序，移除时与末尾交换；空单元保留以复用内存
+ */
+void SpatialIndex::unlink(Handle handle) {
+  Entry &entry = entries_[handle];
+  if (!entry.hasBounds) {
+    return;
+  }
+  auto eraseFrom = [handle](std::vector<Handle> &list) {
+    auto it = std::find(list.begin(), list.end(), handle);
+    if (it != list.end()) {
+      *it = list.back();
+      list.pop_back();
+    }
+  };
+  if (entry.oversized) {
+    eraseFrom(oversized_);
+    entry.oversized = false;
+    return;
+  }
+  for (int32_t y = entry.cells.y0; y <= entry.cells.y1; ++y) {
+    for (int32_t x = entry.cells.x0; x <= entry.cells.x1; ++x) {
+      auto it = cells_.find(cellKey(x, y));
+      if (it != cells_.end()) {
+        eraseFrom(it->second);
+      }
+    }
+  }
+}
+
+/**
+ * @brief 遍历与 rect 相交单元中的条目及全部大节点
+ *
+ * 查询范围覆盖的单元数多于已有单元数时改为遍历全部单元；
+ * 以查询戳去重，跨越多个单元的条目只回调一次
+ */
+template <typename Fn>
+void SpatialIndex::forEachCandidate(const Rect &rect, Fn &&fn) {
+  if (++queryStamp_ == 0) {
+    for (Entry &entry : entries_) {
+      entry.queryStamp = 0;
+    }
+    queryStamp_ = 1;
+  }
+
+  auto visit = [&](Handle handle) {
+    Entry &entry = entries_[handle];
+    if (entry.queryStamp != queryStamp_) {
+      entry.queryStamp = queryStamp_;
+      fn(entry);
+    }
+  };
+
+  CellRange range = rangeOf(rect);
+  if (range.cellCount() > static_cast<int64_t>(cells_.size())) {
+    for (const auto &cell : cells_) {
+      for (Handle handle : cell.second) {
+        visit(handle);
+      }
+    }
+  } else {
+    for (int32_t y = range.y0; y <= range.y1; ++y) {
+      for (int32_t x = range.x0; x <= range.x1; ++x) {
+        auto it = cells_.find(cellKey(x, y));
+        if (it == cells_.end()) {
+          continue;
+        }
+        for (Handle handle : it->second) {
+          visit(handle);
+        }
+      }
+    }
+  }
+  for (Handle handle : oversized_) {
+    visit(handle);
+  }
+}
+
+/**
+ * @brief 查询包围盒与矩形相交的节点
+ * @param rect 查询矩形（世界坐标）
+ * @param out 结果
+ */
+void SpatialIndex::queryRect(const Rect &rect, std::vector<Node *> &out) {
+  forEachCandidate(rect, [&](const Entry &entry) {
+    if (entry.bounds.intersects(rect)) {
+      out.push_back(entry.node);
+    }
+  });
+}
+
+/**
+ * @brief 查询包围盒包含某点的节点
+ * @param point 查询点（世界坐标）
+ * @param out 结果
+ */
+void SpatialIndex::queryPoint(const Vec2 &point, std::vector<Node *> &out) {
+  forEachCandidate(Rect(point, Size(0.0f, 0.0f)), [&](const Entry &entry) {
+    if (entry.bounds.containsPoint(point)) {
+      out.push_back(entry.node);
+    }
+  });
+}
+
+/**
+ * @brief 查询包围盒与圆相交的节点
+ * @param center 圆心（世界坐标）
+ * @param radius 半径
+ * @param out 结果
+ */
+void SpatialIndex::queryRadius(const Vec2 &center, float radius,
+                               std::vector<Node *> &out) {
+  Rect rect(center.x - radius, center.y - radius, radius * 2.0f,
+            radius * 2.0f);
+  float radiusSq = radius * radius;
+  forEachCandidate(rect, [&](const Entry &entry) {
+    // 圆心到包围盒的最近距离
+    float dx = std::max({entry.bounds.left() - center.x, 0.0f,
+                         center.x - entry.bounds.right()});
+    float dy = std::max({entry.bounds.top() - center.y, 0.0f,
+                         center.y - entry.bounds.bottom()});
+    if (dx * dx + dy * dy <= radiusSq) {
+      out.push_back(entry.node);
+    }
+  });
+}
+
+} // namespace extra2d
@@ -34,6 +34,7 @@ void Sprite::setTexture(Ptr<Texture> texture) {
     textureRect_ = Rect(0, 0, static_cast<float>(texture_->getWidth()),
                         static_cast<float>(texture_->getHeight()));
   }
+  markBoundsDirty();
 }
 
 /**
@@ -42,7 +43,10 @@ void Sprite::setTexture(Ptr<Texture> texture) {
  *
  * 设置精灵显示纹理的哪一部分
  */
-void Sprite::setTextureRect(const Rect &rect) { textureRect_ = rect; }
+void Sprite::setTextureRect(const Rect &rect) {
+  textureRect_ = rect;
+  markBoundsDirty();
+}
 
 /**
  * @brief 设置精灵颜色
@@ -121,6 +125,22 @@ Rect Sprite::getBounds() const {
   return Rect(l, t, std::abs(w), std::abs(h));
 }
 
+/**
+ * @brief 获取精灵在局部坐标系中的边界
+ * @param bounds 输出边界，与精灵批处理按锚点放置四角的方式一致
+ * @return 无有效纹理时返回false
+ */
+bool Sprite::getLocalBounds(Rect &bounds) const {
+  if (!texture_ || !texture_->isValid()) {
+    return false;
+  }
+  float width = std::abs(textureRect_.width());
+  float height = std::abs(textureRect_.height());
+  Vec2 anchor = getAnchor();
+  bounds = Rect(-width * anchor.x, -height * anchor.y, width, height);
+  return true;
+}
+
 /**
  * @brief 绘制精灵
  * @param renderer 渲染后端引用
@@ -132,27 +152,12 @@ void Sprite::onDraw(RenderBackend &renderer) {
     return;
   }
 
-  // Calculate destination rectangle based on texture rect
   float width = textureRect_.width();
   float height = textureRect_.height();
 
-  // 使用世界变换来获取最终的位置
-  auto worldTransform = getWorldTransform();
-
-  // 从世界变换矩阵中提取位置（第四列）
-  float worldX = worldTransform[3][0];
-  float worldY = worldTransform[3][1];
-
-  // 从世界变换矩阵中提取缩放
-  float worldScaleX =
-      glm::length(glm::vec2(worldTransform[0][0], worldTransform[0][1]));
-  float worldScaleY =
-      glm::length(glm::vec2(worldTransform[1][0], worldTransform[1][1]));
-
-  auto anchor = getAnchor();
-
-  // 锚点由 RenderBackend 在绘制时处理，这里只传递位置和尺寸
-  Rect destRect(worldX, worldY, width * worldScaleX, height * worldScaleY);
+  // 世界变换直接交给精灵批处理变换四个角点，不再分解为位置/缩放/旋转，
+  // 斜切与非等比缩放的层级也能正确绘制
+  Affine2D world = getWorldTransform();
 
   // Adjust source rect for flipping
   Rect srcRect = textureRect_;
@@ -165,47 +170,27 @@ void Sprite::onDraw(RenderBackend &renderer) {
     srcRect.size.height = -srcRect.size.height;
   }
 
-  // 从世界变换矩阵中提取旋转角度
-  float worldRotation = std::atan2(worldTransform[0][1], worldTransform[0][0]);
-
-  renderer.drawSprite(*texture_, destRect, srcRect, color_, worldRotation,
-                      anchor);
+  renderer.drawSprite(*texture_, world, Size(width, height), srcRect, color_,
+                      getAnchor());
 }
 
 /**
  * @brief 生成渲染命令
- * @param commands 渲染命令输出向量
+ * @param commands 渲染命令缓冲区
  * @param zOrder 渲染层级
  *
  * 根据精灵的纹理、变换和颜色生成精灵渲染命令
  */
-void Sprite::generateRenderCommand(std::vector<RenderCommand> &commands,
+void Sprite::generateRenderCommand(RenderCommandBuffer &commands,
                                    int zOrder) {
   if (!texture_ || !texture_->isValid()) {
     return;
   }
 
-  // 计算目标矩形（与 onDraw 一致，使用世界变换）
+  // 目标矩形位于局部空间，世界变换随命令携带，不做分解
   float width = textureRect_.width();
   float height = textureRect_.height();
-
-  // 使用世界变换来获取最终的位置
-  auto worldTransform = getWorldTransform();
-
-  // 从世界变换矩阵中提取位置（第四列）
-  float worldX = worldTransform[3][0];
-  float worldY = worldTransform[3][1];
-
-  // 从世界变换矩阵中提取缩放
-  float worldScaleX =
-      glm::length(glm::vec2(worldTransform[0][0], worldTransform[0][1]));
-  float worldScaleY =
-      glm::length(glm::vec2(worldTransform[1][0], worldTransform[1][1]));
-
-  auto anchor = getAnchor();
-
-  // 锚点由 RenderBackend 在绘制时处理，这里只传递位置和尺寸
-  Rect destRect(worldX, worldY, width * worldScaleX, height * worldScaleY);
+  Rect destRect(0.0f, 0.0f, width, height);
 
   // 调整源矩形（翻转）
   Rect srcRect = textureRect_;
@@ -218,17 +203,10 @@ void Sprite::generateRenderCommand(std::vector<RenderCommand> &commands,
     srcRect.size.height = -srcRect.size.height;
   }
 
-  // 从世界变换矩阵中提取旋转角度
-  float worldRotation = std::atan2(worldTransform[0][1], worldTransform[0][0]);
-
-  // 创建渲染命令
-  RenderCommand cmd;
-  cmd.type = RenderCommandType::Sprite;
-  cmd.layer = zOrder;
-  cmd.data = SpriteCommandData{texture_.get(), destRect, srcRect, color_,
-                               worldRotation,  anchor,   0};
-
-  commands.push_back(std::move(cmd));
+  commands.add(RenderCommandType::Sprite, zOrder, getWorldTransform(),
+               SpriteCommandData{texture_.get(), destRect, srcRect, color_,
+                                 0.0f, getAnchor()});
+  commands.retain(texture_);
 }
 
 } // namespace extra2d
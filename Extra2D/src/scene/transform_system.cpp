@@ -0,0 +1,234 @@
+#include <cmath>
+#include <extra2d/scene/node.h>
+#include <extra2d/scene/transform_system.h>
+
+namespace extra2d {
+
+// 空槽数超过该值且超过总槽数一半时压实
+static constexpr size_t COMPACT_MIN_FREE = 1024;
+
+/**
+ * @brief 分配槽位
+ * @param owner 持有该槽位的节点
+ * @return 槽位索引，初始为单位变换、无父节点
+ */
+TransformSystem::Index TransformSystem::allocate(Node *owner) {
+  Index index;
+  if (!freeList_.empty()) {
+    index = freeList_.back();
+    freeList_.pop_back();
+    positions_[index] = Vec2::Zero();
+    scales_[index] = Vec2(1.0f, 1.0f);
+    skews_[index] = Vec2::Zero();
+    rotations_[index] = 0.0f;
+    parents_[index] = INVALID_INDEX;
+  } else {
+    index = appendSlot();
+  }
+  owners_[index] = owner;
+  markLocalDirty(index);
+  return index;
+}
+
+/**
+ * @brief 在数组末尾追加一个单位变换槽位
+ */
+TransformSystem::Index TransformSystem::appendSlot() {
+  Index index = static_cast<Index>(owners_.size());
+  positions_.push_back(Vec2::Zero());
+  scales_.push_back(Vec2(1.0f, 1.0f));
+  skews_.push_back(Vec2::Zero());
+  rotations_.push_back(0.0f);
+  locals_.emplace_back();
+  worlds_.emplace_back();
+  parents_.push_back(INVALID_INDEX);
+  flags_.push_back(0);
+  owners_.push_back(nullptr);
+  return index;
+}
+
+/**
+ * @brief 释放槽位
+ * @param index 槽位索引
+ *
+ * 空槽的标记清零，update() 扫描时直接跳过
+ */
+void TransformSystem::release(Index index) {
+  owners_[index] = nullptr;
+  parents_[index] = INVALID_INDEX;
+  flags_[index] = 0;
+  freeList_.push_back(index);
+}
+
+/**
+ * @brief 设置父槽位
+ * @param index 槽位索引
+ * @param parent 父槽位，INVALID_INDEX 表示根节点
+ */
+void TransformSystem::setParent(Index index, Index parent) {
+  parents_[index] = parent;
+}
+
+/**
+ * @brief 将槽位搬到数组末尾
+ * @param index 原槽位
+ * @param parent 新的父槽位
+ * @return 新槽位
+ *
+ * 节点先序遍历子树依次调用，子树内部仍保持父前子后
+ */
+TransformSystem::Index TransformSystem::relocate(Index index, Index parent) {
+  Index moved = appendSlot();
+  positions_[moved] = positions_[index];
+  scales_[moved] = scales_[index];
+  skews_[moved] = skews_[index];
+  rotations_[moved] = rotations_[index];
+  locals_[moved] = locals_[index];
+  worlds_[moved] = worlds_[index];
+  owners_[moved] = owners_[index];
+  parents_[moved] = parent;
+  flags_[moved] = flags_[index];
+  if (flags_[moved] != 0) {
+    extendDirtySpan(moved);
+  }
+  release(index);
+  return moved;
+}
+
+/**
+ * @brief 由局部 TRS 计算局部仿射变换
+ *
+ * T - R - Skew - S 顺序，直接写出 2x3 仿射系数而不经过通用的矩阵乘法；
+ * 锚点偏移在渲染时处理，不在局部变换中处理，
+ * 这样可以避免锚点偏移被父节点的缩放影响
+ */
+void TransformSystem::computeLocal(Index index) {
+  const Vec2 &position = positions_[index];
+  const Vec2 &skew = skews_[index];
+  const Vec2 &scale = scales_[index];
+  float rotation = rotations_[index];
+
+  float c = 1.0f;
+  float s = 0.0f;
+  if (rotation != 0.0f) {
+    c = std::cos(rotation * DEG_TO_RAD);
+    s = std::sin(rotation * DEG_TO_RAD);
+  }
+
+  // R * Skew，Skew 的 [1][0] 为 tan(skew.x)、[0][1] 为 tan(skew.y)
+  float a00 = c, a01 = -s, a10 = s, a11 = c;
+  if (skew.x != 0.0f || skew.y != 0.0f) {
+    float kx = std::tan(skew.x * DEG_TO_RAD);
+    float ky = std::tan(skew.y * DEG_TO_RAD);
+    a00 = c - s * ky;
+    a01 = c * kx - s;
+    a10 = s + c * ky;
+    a11 = s * kx + c;
+  }
+
+  locals_[index] = Affine2D(a00 * scale.x, a10 * scale.x, a01 * scale.y,
+                            a11 * scale.y, position.x, position.y);
+  flags_[index] &= static_cast<uint8_t>(~LOCAL_DIRTY);
+}
+
+/**
+ * @brief 获取局部变换
+ * @param index 槽位索引
+ * @return 局部仿射变换
+ */
+const Affine2D &TransformSystem::getLocal(Index index) {
+  if (flags_[index] & LOCAL_DIRTY) {
+    computeLocal(index);
+  }
+  return locals_[index];
+}
+
+/**
+ * @brief 获取世界变换
+ * @param index 槽位索引
+ * @return 世界仿射变换
+ *
+ * 为脏时沿父索引向上按需重算，不经过节点指针
+ */
+const Affine2D &TransformSystem::getWorld(Index index) {
+  if (flags_[index] & WORLD_DIRTY) {
+    const Affine2D &local = getLocal(index);
+    Index parent = parents_[index];
+    worlds_[index] = parent == INVALID_INDEX ? local : getWorld(parent) * local;
+    flags_[index] &= static_cast<uint8_t>(~WORLD_DIRTY);
+  }
+  return worlds_[index];
+}
+
+/**
+ * @brief 重算脏区间内被标记槽位的变换
+ *
+ * 父槽位索引总小于子槽位：父节点若为脏，已在本次扫描中先行更新；
+ * 若在脏区间之外或未被标记，其世界变换本就是最新
+ */
+void TransformSystem::update() {
+  for (Index i = dirtyBegin_; i < dirtyEnd_; ++i) {
+    uint8_t flags = flags_[i];
+    if (!(flags & WORLD_DIRTY)) {
+      continue;
+    }
+    if (flags & LOCAL_DIRTY) {
+      computeLocal(i);
+    }
+    Index parent = parents_[i];
+    worlds_[i] =
+        parent == INVALID_INDEX ? locals_[i] : worlds_[parent] * locals_[i];
+    flags_[i] = 0;
+  }
+  dirtyBegin_ = INVALID_INDEX;
+  dirtyEnd_ = 0;
+
+  if (freeList_.size() > COMPACT_MIN_FREE &&
+      freeList_.size() * 2 > owners_.size()) {
+    compact();
+  }
+}
+
+/**
+ * @brief 按原顺序移除空槽并更新节点持有的索引
+ *
+ * 相对顺序不变，父前子后的约束依然成立；只在脏区间为空时调用
+ */
+void TransformSystem::compact() {
+  remap_.assign(owners_.size(), INVALID_INDEX);
+  Index next = 0;
+  for (Index i = 0; i < owners_.size(); ++i) {
+    if (owners_[i] == nullptr) {
+      continue;
+    }
+    remap_[i] = next;
+    if (next != i) {
+      positions_[next] = positions_[i];
+      scales_[next] = scales_[i];
+      skews_[next] = skews_[i];
+      rotations_[next] = rotations_[i];
+      locals_[next] = locals_[i];
+      worlds_[next] = worlds_[i];
+      flags_[next] = flags_[i];
+      owners_[next] = owners_[i];
+    }
+    // 父槽位在前，已完成映射
+    parents_[next] =
+        parents_[i] == INVALID_INDEX ? INVALID_INDEX : remap_[parents_[i]];
+    owners_[next]->transformIndex_ = next;
+    ++next;
+  }
+
+  positions_.resize(next);
+  scales_.resize(next);
+  skews_.resize(next);
+  rotations_.resize(next);
+  locals_.resize(next);
+  worlds_.resize(next);
+  parents_.resize(next);
+  flags_.resize(next);
+  owners_.resize(next);
+  freeList_.clear();
+}
+
+} // namespace extra2d
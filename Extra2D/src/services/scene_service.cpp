@@ -84,7 +84,7 @@ void SceneService::render(RenderBackend& renderer) {
     manager_.render(renderer);
 }
 
-void SceneService::collectRenderCommands(std::vector<RenderCommand>& commands) {
+void SceneService::collectRenderCommands(RenderCommandBuffer &commands) {
     manager_.collectRenderCommands(commands);
 }
 
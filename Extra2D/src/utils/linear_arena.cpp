@@ -0,0 +1,52 @@
+#include <extra2d/utils/linear_arena.h>
+
+namespace extra2d {
+
+/**
+ * @brief 构造函数，首个内存块在第一次分配时申请
+ * @param blockSize 内存块大小
+ */
+LinearArena::LinearArena(size_t blockSize) : blockSize_(blockSize) {}
+
+/**
+ * @brief 当前内存块不足时切换到下一块
+ *
+ * 优先复用 reset() 前已申请的内存块；超过块大小的请求单独申请一块
+ */
+void *LinearArena::allocateSlow(size_t size, size_t alignment) {
+  size_t needed = size + alignment;
+  size_t next = blocks_.empty() || cursor_ == 0 ? 0 : blockIndex_ + 1;
+
+  // 跳过容量不足的旧块（仅在出现超大请求后发生）
+  while (next < blocks_.size() && blocks_[next].size < needed) {
+    ++next;
+  }
+  if (next >= blocks_.size()) {
+    size_t blockSize = needed > blockSize_ ? needed : blockSize_;
+    blocks_.push_back({std::make_unique<unsigned char[]>(blockSize), blockSize});
+    reserved_ += blockSize;
+    next = blocks_.size() - 1;
+  }
+
+  blockIndex_ = next;
+  cursor_ = reinterpret_cast<uintptr_t>(blocks_[next].data.get());
+  limit_ = cursor_ + blocks_[next].size;
+  return allocate(size, alignment);
+}
+
+/**
+ * @brief 回退到第一块的起点
+ */
+void LinearArena::reset() {
+  blockIndex_ = 0;
+  used_ = 0;
+  if (blocks_.empty()) {
+    cursor_ = 0;
+    limit_ = 0;
+    return;
+  }
+  cursor_ = reinterpret_cast<uintptr_t>(blocks_[0].data.get());
+  limit_ = cursor_ + blocks_[0].size;
+}
+
+} // namespace extra2d
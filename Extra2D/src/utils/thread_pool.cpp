@@ -0,0 +1,150 @@
+#include <algorithm>
+#include <extra2d/utils/logger.h>
+#include <extra2d/utils/thread_pool.h>
+
+namespace extra2d {
+
+// 标记当前线程是否为池内工作线程，用于检测嵌套调用
+static thread_local bool tlsIsWorker = false;
+
+/**
+ * @brief 构造函数，按 CPU 核心数创建工作线程
+ */
+ThreadPool::ThreadPool()
+    : job_(nullptr), jobCount_(0), chunkSize_(0), chunkTotal_(0),
+      nextChunk_(0), generation_(0), activeWorkers_(0), jobActive_(false),
+      stop_(false) {
+  unsigned int cores = std::thread::hardware_concurrency();
+  size_t workerCount = cores > 1 ? cores - 1 : 0;
+
+  workers_.reserve(workerCount);
+  for (size_t i = 0; i < workerCount; ++i) {
+    workers_.emplace_back(&ThreadPool::workerLoop, this);
+  }
+
+  E2D_LOG_INFO("ThreadPool started with {} worker thread(s)", workerCount);
+}
+
+/**
+ * @brief 析构函数，通知并等待所有工作线程退出
+ */
+ThreadPool::~ThreadPool() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  wakeCond_.notify_all();
+
+  for (auto &worker : workers_) {
+    if (worker.joinable()) {
+      worker.join();
+    }
+  }
+}
+
+/**
+ * @brief 获取ThreadPool单例实例
+ * @return ThreadPool单例的引用
+ */
+ThreadPool &ThreadPool::get() {
+  static ThreadPool instance;
+  return instance;
+}
+
+/**
+ * @brief 将 [0, count) 切分为若干块并行执行
+ * @param count 元素总数
+ * @param minChunk 每块最少元素数
+ * @param fn 区间任务
+ *
+ * 块数约为线程数的 4 倍以平衡负载；调用线程领取块直到全部派发，
+ * 再等待仍在执行的工作线程结束
+ */
+void ThreadPool::parallelFor(size_t count, size_t minChunk,
+                             const RangeFn &fn) {
+  if (count == 0) {
+    return;
+  }
+
+  size_t threads = workers_.size() + 1;
+  minChunk = std::max<size_t>(minChunk, 1);
+
+  // 单线程、任务过小、嵌套调用或已有任务在执行时直接串行
+  if (workers_.empty() || count <= minChunk || tlsIsWorker) {
+    fn(0, count);
+    return;
+  }
+  std::unique_lock<std::mutex> submitLock(submitMutex_, std::try_to_lock);
+  if (!submitLock.owns_lock()) {
+    fn(0, count);
+    return;
+  }
+
+  size_t chunkSize = std::max(minChunk, (count + threads * 4 - 1) / (threads * 4));
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    job_ = &fn;
+    jobCount_ = count;
+    chunkSize_ = chunkSize;
+    chunkTotal_ = (count + chunkSize - 1) / chunkSize;
+    nextChunk_.store(0, std::memory_order_relaxed);
+    jobActive_ = true;
+    ++generation_;
+  }
+  wakeCond_.notify_all();
+
+  runChunks();
+
+  // 工作线程只在 jobActive_ 为真时接手任务，等其全部退出后才可释放 fn
+  std::unique_lock<std::mutex> lock(mutex_);
+  doneCond_.wait(lock, [this] { return activeWorkers_ == 0; });
+  jobActive_ = false;
+  job_ = nullptr;
+}
+
+/**
+ * @brief 领取并执行块，直到没有剩余块
+ */
+void ThreadPool::runChunks() {
+  while (true) {
+    size_t chunk = nextChunk_.fetch_add(1, std::memory_order_relaxed);
+    if (chunk >= chunkTotal_) {
+      break;
+    }
+    size_t begin = chunk * chunkSize_;
+    size_t end = std::min(begin + chunkSize_, jobCount_);
+    (*job_)(begin, end);
+  }
+}
+
+/**
+ * @brief 工作线程主循环：等待新任务，参与执行后回到等待
+ */
+void ThreadPool::workerLoop() {
+  tlsIsWorker = true;
+  uint64_t seenGeneration = 0;
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    wakeCond_.wait(lock, [this, &seenGeneration] {
+      return stop_ || (jobActive_ && generation_ != seenGeneration);
+    });
+    if (stop_) {
+      break;
+    }
+
+    seenGeneration = generation_;
+    ++activeWorkers_;
+    lock.unlock();
+
+    runChunks();
+
+    lock.lock();
+    if (--activeWorkers_ == 0) {
+      doneCond_.notify_one();
+    }
+  }
+}
+
+} // namespace extra2d
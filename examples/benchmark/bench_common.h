@@ -0,0 +1,68 @@
+#pragma once
+
+/**
+ * @file bench_common.h
+ * @brief 基准测试公共工具
+ */
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+
+namespace bench {
+
+/**
+ * @brief 以最佳轮次计时，返回单次迭代的毫秒数
+ * @param rounds 轮数
+ * @param iterations 每轮迭代次数
+ * @param fn 被测函数
+ */
+template <typename Fn> double measureMs(int rounds, int iterations, Fn &&fn) {
+  double best = 1e30;
+  for (int r = 0; r < rounds; ++r) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+      fn();
+    }
+    auto end = std::chrono::steady_clock::now();
+    double ms = std::chrono::duration<double, std::milli>(end - start).count();
+    if (ms / iterations < best) {
+      best = ms / iterations;
+    }
+  }
+  return best;
+}
+
+/**
+ * @brief 打印一行结果
+ * @param name 用例名称
+ * @param items 每次迭代处理的元素数
+ * @param ms 单次迭代耗时
+ * @param unit 元素单位
+ */
+inline void report(const std::string &name, size_t items, double ms,
+                   const char *unit) {
+  std::printf("  %-40s %10.3f ms  %12.1f %s/ms\n", name.c_str(), ms,
+              static_cast<double>(items) / ms, unit);
+}
+
+/**
+ * @brief 打印分组标题
+ */
+inline void section(const char *title) { std::printf("\n[%s]\n", title); }
+
+/**
+ * @brief 防止编译器优化掉结果
+ */
+template <typename T> inline void doNotOptimize(const T &value) {
+#if defined(__GNUC__)
+  asm volatile("" : : "r,m"(value) : "memory");
+#else
+  // MSVC 不支持 GNU 内联汇编，通过 volatile 写入保留求值
+  static const void *volatile sink;
+  sink = &value;
+  (void)sink;
+#endif
+}
+
+} // namespace bench
@@ -0,0 +1,166 @@
+/**
+ * @file culling_bench.cpp
+ * @brief 视口剔除基准测试
+ *
+ * 20 万个精灵铺成的滚动世界（500 个 20x20 的分块），1280x720 的视口
+ * 横向滚动：对比不剔除、逐节点剔除与逐节点 + 子树剔除时每帧收集渲染命令
+ * 的耗时，并统计绘制与剔除的节点数
+ */
+
+#include "bench_common.h"
+
+#include <extra2d/graphics/render_command.h>
+#include <extra2d/graphics/texture.h>
+#include <extra2d/scene/node.h>
+#include <extra2d/scene/sprite.h>
+
+using namespace extra2d;
+
+namespace {
+
+constexpr size_t TILE_SPRITES = 20; // 每个分块 20x20 个精灵
+constexpr size_t TILES_X = 25;
+constexpr size_t TILES_Y = 20;
+constexpr float SPACING = 32.0f;
+constexpr float VIEW_WIDTH = 1280.0f;
+constexpr float VIEW_HEIGHT = 720.0f;
+constexpr int SCROLL_FRAMES = 64;
+
+/**
+ * @brief 不持有 GPU 资源的纹理
+ */
+class FakeTexture : public Texture {
+public:
+  int getWidth() const override { return 32; }
+  int getHeight() const override { return 32; }
+  Size getSize() const override { return Size(32.0f, 32.0f); }
+  int getChannels() const override { return 4; }
+  PixelFormat getFormat() const override { return PixelFormat::RGBA8; }
+  void *getNativeHandle() const override { return nullptr; }
+  bool isValid() const override { return true; }
+  void setFilter(bool) override {}
+  void setWrap(bool) override {}
+};
+
+/**
+ * @brief 构建世界：根节点下 TILES_X * TILES_Y 个分块，每块 400 个精灵
+ */
+Ptr<Node> buildWorld(const Ptr<Texture> &texture) {
+  auto root = makePtr<Node>();
+  const float tileSize = TILE_SPRITES * SPACING;
+  for (size_t ty = 0; ty < TILES_Y; ++ty) {
+    for (size_t tx = 0; tx < TILES_X; ++tx) {
+      auto tile = makePtr<Node>();
+      tile->setPos(tx * tileSize, ty * tileSize);
+      std::vector<Ptr<Node>> sprites;
+      sprites.reserve(TILE_SPRITES * TILE_SPRITES);
+      for (size_t i = 0; i < TILE_SPRITES * TILE_SPRITES; ++i) {
+        auto sprite = Sprite::create(texture);
+        sprite->setPos((i % TILE_SPRITES) * SPACING + SPACING * 0.5f,
+                       (i / TILE_SPRITES) * SPACING + SPACING * 0.5f);
+        sprite->setRotation(static_cast<float>(i % 8) * 11.25f);
+        sprites.push_back(sprite);
+      }
+      tile->addChildren(std::move(sprites));
+      root->addChild(tile);
+    }
+  }
+  root->batchTransforms();
+  return root;
+}
+
+/**
+ * @brief 设置分块的子树剔除
+ */
+void setSubtreeCulling(Node &root, bool enabled) {
+  for (const auto &tile : root.getChildren()) {
+    tile->setSubtreeCulling(enabled);
+  }
+}
+
+/**
+ * @brief 第 frame 帧的视口：沿世界对角方向往返滚动
+ */
+Rect viewAt(int frame) {
+  const float worldWidth = TILES_X * TILE_SPRITES * SPACING;
+  const float worldHeight = TILES_Y * TILE_SPRITES * SPACING;
+  float t = static_cast<float>(frame % SCROLL_FRAMES) / SCROLL_FRAMES;
+  return Rect(t * (worldWidth - VIEW_WIDTH), t * (worldHeight - VIEW_HEIGHT),
+              VIEW_WIDTH, VIEW_HEIGHT);
+}
+
+struct ModeResult {
+  double ms = 0.0;
+  size_t commands = 0;
+  CullStats stats;
+};
+
+/**
+ * @brief 滚动 SCROLL_FRAMES 帧，返回每帧平均收集耗时
+ */
+ModeResult runMode(Node &root, RenderCommandBuffer &buffer, bool culling) {
+  ModeResult result;
+  double total = bench::measureMs(1, 3, [&] {
+    for (int frame = 0; frame < SCROLL_FRAMES; ++frame) {
+      buffer.clear();
+      if (culling) {
+        buffer.setCullRect(viewAt(frame));
+      } else {
+        buffer.clearCullRect();
+      }
+      root.collectRenderCommands(buffer, 0);
+      bench::doNotOptimize(buffer.getCommands().data());
+    }
+  });
+  result.ms = total / SCROLL_FRAMES;
+  result.commands = buffer.size();
+  result.stats = buffer.getCullStats();
+  return result;
+}
+
+void printMode(const char *name, const ModeResult &r) {
+  bench::report(name, r.commands, r.ms, "cmds");
+  std::printf("    drawn %u, culled %u, subtrees culled %u\n", r.stats.drawn,
+              r.stats.culled, r.stats.subtreesCulled);
+}
+
+} // namespace
+
+/**
+ * @brief 20 万精灵滚动世界的剔除收益
+ */
+void runCullingBench() {
+  bench::section("Viewport culling (200000 sprites, 1280x720 view)");
+
+  auto texture = makePtr<FakeTexture>();
+  Ptr<Node> root = buildWorld(texture);
+  RenderCommandBuffer buffer;
+  buffer.reserve(TILES_X * TILES_Y * TILE_SPRITES * TILE_SPRITES);
+
+  ModeResult none = runMode(*root, buffer, false);
+  printMode("collect, no culling (per frame)", none);
+
+  setSubtreeCulling(*root, false);
+  ModeResult perNode = runMode(*root, buffer, true);
+  printMode("collect, per-node culling (per frame)", perNode);
+
+  setSubtreeCulling(*root, true);
+  ModeResult subtree = runMode(*root, buffer, true);
+  printMode("collect, per-node + subtree culling (per frame)", subtree);
+
+  // 滚动世界中每帧只有一个分块移动：验证子树包围盒增量失效后的结果
+  auto &tiles = root->getChildren();
+  double moveMs = bench::measureMs(1, 3, [&] {
+    for (int frame = 0; frame < SCROLL_FRAMES; ++frame) {
+      Node &tile = *tiles[static_cast<size_t>(frame) % tiles.size()];
+      tile.setPos(tile.getPosition() + Vec2(frame % 2 ? -1.0f : 1.0f, 0.0f));
+      root->batchTransforms();
+      buffer.clear();
+      buffer.setCullRect(viewAt(frame));
+      root->collectRenderCommands(buffer, 0);
+      bench::doNotOptimize(buffer.getCommands().data());
+    }
+  });
+  bench::report("move one tile + batchTransforms + subtree-culled collect",
+                buffer.size(), moveMs / SCROLL_FRAMES, "cmds");
+}
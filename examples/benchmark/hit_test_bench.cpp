@@ -0,0 +1,196 @@
+/**
+ * @file hit_test_bench.cpp
+ * @brief 指针命中测试基准测试
+ *
+ * 20 万个精灵的场景，指针每帧移动一次并做一次命中测试：对比原先逐层
+ * 复制并稳定排序子节点的做法、复用已排序子节点并跳过无监听器子树的遍历，
+ * 以及经空间索引的查询；分别在没有监听器、少量监听器和全部节点都有
+ * 监听器时测量
+ */
+
+#include "bench_common.h"
+
+#include <algorithm>
+#include <extra2d/graphics/texture.h>
+#include <extra2d/scene/scene.h>
+#include <extra2d/scene/sprite.h>
+
+using namespace extra2d;
+
+namespace {
+
+constexpr size_t GRID_X = 500;
+constexpr size_t GRID_Y = 400;
+constexpr float SPACING = 32.0f;
+constexpr int FRAMES = 64;
+
+/**
+ * @brief 不持有 GPU 资源的纹理
+ */
+class FakeTexture : public Texture {
+public:
+  int getWidth() const override { return 40; }
+  int getHeight() const override { return 40; }
+  Size getSize() const override { return Size(40.0f, 40.0f); }
+  int getChannels() const override { return 4; }
+  PixelFormat getFormat() const override { return PixelFormat::RGBA8; }
+  void *getNativeHandle() const override { return nullptr; }
+  bool isValid() const override { return true; }
+  void setFilter(bool) override {}
+  void setWrap(bool) override {}
+};
+
+/**
+ * @brief 构建场景：根下 GRID_Y 行分组，每行 GRID_X 个精灵，相邻精灵互相
+ * 重叠且Z序交错
+ */
+Ptr<Scene> buildScene(const Ptr<Texture> &texture,
+                      std::vector<Ptr<Sprite>> &sprites) {
+  auto scene = Scene::create();
+  for (size_t y = 0; y < GRID_Y; ++y) {
+    auto row = makePtr<Node>();
+    row->setPos(0.0f, y * SPACING);
+    for (size_t x = 0; x < GRID_X; ++x) {
+      auto sprite = Sprite::create(texture);
+      sprite->setPos(x * SPACING, 0.0f);
+      sprite->setZOrder(static_cast<int>(x % 3));
+      row->addChild(sprite);
+      sprites.push_back(sprite);
+    }
+    scene->addChild(row);
+  }
+  scene->onAttachToScene(scene.get());
+  scene->batchTransforms();
+  return scene;
+}
+
+/**
+ * @brief 原先的命中测试：每层复制子节点并按Z序稳定排序
+ */
+Node *legacyHitTest(const Ptr<Node> &node, const Vec2 &worldPos) {
+  if (!node || !node->isVisible()) {
+    return nullptr;
+  }
+
+  std::vector<Ptr<Node>> children = node->getChildren();
+  std::stable_sort(children.begin(), children.end(),
+                   [](const Ptr<Node> &a, const Ptr<Node> &b) {
+                     return a->getZOrder() < b->getZOrder();
+                   });
+
+  for (auto it = children.rbegin(); it != children.rend(); ++it) {
+    if (Node *hit = legacyHitTest(*it, worldPos)) {
+      return hit;
+    }
+  }
+
+  if (node->getEventDispatcher().getTotalListenerCount() == 0) {
+    return nullptr;
+  }
+
+  Rect bounds;
+  if (!node->getWorldBounds(bounds) || !bounds.containsPoint(worldPos)) {
+    return nullptr;
+  }
+  return node.get();
+}
+
+Vec2 pointerAt(int frame) {
+  return Vec2(static_cast<float>((frame * 7919) % (GRID_X * 32)),
+              static_cast<float>((frame * 104729) % (GRID_Y * 32)));
+}
+
+/**
+ * @brief 为每 stride 个精灵中的一个注册监听器
+ */
+std::vector<ListenerId> addListeners(std::vector<Ptr<Sprite>> &sprites,
+                                     size_t stride) {
+  std::vector<ListenerId> ids;
+  for (size_t i = 0; i < sprites.size(); i += stride) {
+    ids.push_back(sprites[i]->getEventDispatcher().addListener(
+        EventType::UIClicked, [](Event &) {}));
+  }
+  return ids;
+}
+
+void removeListeners(std::vector<Ptr<Sprite>> &sprites, size_t stride,
+                     const std::vector<ListenerId> &ids) {
+  for (size_t i = 0, n = 0; i < sprites.size(); i += stride, ++n) {
+    sprites[i]->getEventDispatcher().removeListener(ids[n]);
+  }
+}
+
+/**
+ * @brief 以三种方式各测 FRAMES 帧，返回每帧耗时并核对命中结果
+ */
+void runCase(const char *label, Scene &scene, const Ptr<Node> &root) {
+  size_t mismatches = 0;
+  size_t hits = 0;
+  for (int frame = 0; frame < FRAMES; ++frame) {
+    Vec2 p = pointerAt(frame);
+    scene.setSpatialIndexing(false);
+    Node *tree = scene.hitTest(p);
+    scene.setSpatialIndexing(true);
+    Node *indexed = scene.hitTest(p);
+    if (tree != legacyHitTest(root, p) || tree != indexed) {
+      ++mismatches;
+    }
+    hits += tree != nullptr;
+  }
+
+  double legacyMs = bench::measureMs(1, 1, [&] {
+    for (int frame = 0; frame < FRAMES; ++frame) {
+      bench::doNotOptimize(legacyHitTest(root, pointerAt(frame)));
+    }
+  });
+  scene.setSpatialIndexing(false);
+  double treeMs = bench::measureMs(3, 5, [&] {
+    for (int frame = 0; frame < FRAMES; ++frame) {
+      bench::doNotOptimize(scene.hitTest(pointerAt(frame)));
+    }
+  });
+  scene.setSpatialIndexing(true);
+  scene.updateSpatialIndex();
+  double indexMs = bench::measureMs(3, 5, [&] {
+    for (int frame = 0; frame < FRAMES; ++frame) {
+      bench::doNotOptimize(scene.hitTest(pointerAt(frame)));
+    }
+  });
+
+  std::printf("  %s\n", label);
+  bench::report("  copy + stable_sort per level (legacy)", 1,
+                legacyMs / FRAMES, "frames");
+  bench::report("  sorted children + listener pruning", 1, treeMs / FRAMES,
+                "frames");
+  bench::report("  spatial index", 1, indexMs / FRAMES, "frames");
+  std::printf("    hits %zu/%d, results match: %s\n", hits, FRAMES,
+              mismatches == 0 ? "yes" : "NO");
+}
+
+} // namespace
+
+/**
+ * @brief 20 万节点场景的每帧命中测试开销
+ */
+void runHitTestBench() {
+  bench::section("Pointer hit testing (200000 sprites, per frame)");
+
+  auto texture = makePtr<FakeTexture>();
+  std::vector<Ptr<Sprite>> sprites;
+  sprites.reserve(GRID_X * GRID_Y);
+  Ptr<Scene> scene = buildScene(texture, sprites);
+  Ptr<Node> root = scene;
+
+  runCase("no listeners", *scene, root);
+
+  constexpr size_t SPARSE = 3001;
+  auto ids = addListeners(sprites, SPARSE);
+  char label[64];
+  std::snprintf(label, sizeof(label), "%zu listening sprites", ids.size());
+  runCase(label, *scene, root);
+  removeListeners(sprites, SPARSE, ids);
+
+  ids = addListeners(sprites, 1);
+  runCase("every sprite listening", *scene, root);
+  removeListeners(sprites, 1, ids);
+}
@@ -0,0 +1,68 @@
+/**
+ * @file main.cpp
+ * @brief Extra2D 性能基准测试
+ *
+ * 纯 CPU 基准，不创建窗口与 GL 上下文：
+ * - 精灵顶点计算内核
+ * - 精灵顶点计算多线程扩展
+ * - 精灵世界变换提交方式
+ * - 折线三角化
+ * - SDF 形状
+ * - 凹多边形剖分
+ * - 延迟渲染队列排序
+ * - 渲染命令并行收集
+ * - 视口剔除
+ * - 场景空间索引
+ * - 指针命中测试
+ * - 变换层级更新
+ *
+ * 用法：benchmark [用例名]，不带参数时运行全部用例
+ */
+
+#include <cstdio>
+#include <cstring>
+
+void runSpriteKernelBench();
+void runSpriteParallelBench();
+void runSpriteTransformBench();
+void runPolylineBench();
+void runSDFShapeBench();
+void runPolygonBench();
+void runRenderQueueBench();
+void runSceneCollectBench();
+void runCullingBench();
+void runSpatialIndexBench();
+void runHitTestBench();
+void runTransformBench();
+
+struct BenchCase {
+  const char *name;
+  void (*run)();
+};
+
+static const BenchCase BENCH_CASES[] = {
+    {"sprite_kernel", runSpriteKernelBench},
+    {"sprite_parallel", runSpriteParallelBench},
+    {"sprite_transform", runSpriteTransformBench},
+    {"polyline", runPolylineBench},
+    {"sdf_shapes", runSDFShapeBench},
+    {"polygon", runPolygonBench},
+    {"render_queue", runRenderQueueBench},
+    {"scene_collect", runSceneCollectBench},
+    {"culling", runCullingBench},
+    {"spatial_index", runSpatialIndexBench},
+    {"hit_test", runHitTestBench},
+    {"transform", runTransformBench},
+};
+
+int main(int argc, char **argv) {
+  const char *filter = argc > 1 ? argv[1] : nullptr;
+
+  std::printf("Extra2D Benchmark\n");
+  for (const auto &bc : BENCH_CASES) {
+    if (filter == nullptr || std::strcmp(filter, bc.name) == 0) {
+      bc.run();
+    }
+  }
+  return 0;
+}
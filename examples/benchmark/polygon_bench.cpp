@@ -0,0 +1,82 @@
+/**
+ * @file polygon_bench.cpp
+ * @brief 多边形剖分基准测试
+ *
+ * 对比每帧重新剖分与 ShapeNode 缓存剖分索引两种提交方式的 CPU 开销
+ */
+
+#include "bench_common.h"
+
+#include <cmath>
+#include <extra2d/graphics/polygon_triangulator.h>
+#include <vector>
+
+using namespace extra2d;
+
+namespace {
+
+/**
+ * @brief 生成凹的星形多边形
+ */
+std::vector<Vec2> makeStar(size_t points, float outer, float inner) {
+  std::vector<Vec2> star(points);
+  for (size_t i = 0; i < points; ++i) {
+    float r = (i % 2 == 0) ? outer : inner;
+    float a = 2.0f * PI_F * static_cast<float>(i) / static_cast<float>(points);
+    star[i] = Vec2(r * std::cos(a), r * std::sin(a));
+  }
+  return star;
+}
+
+/**
+ * @brief 按索引展开三角形顶点（模拟写入形状批次）
+ */
+size_t emitTriangles(const std::vector<Vec2> &points,
+                     const std::vector<uint32_t> &indices, Vec2 *out) {
+  for (size_t k = 0; k < indices.size(); ++k) {
+    out[k] = points[indices[k]];
+  }
+  return indices.size();
+}
+
+} // namespace
+
+/**
+ * @brief 1000 个 64 顶点凹多边形
+ */
+void runPolygonBench() {
+  constexpr size_t POLYGON_COUNT = 1000;
+  constexpr size_t POLYGON_POINTS = 64;
+  bench::section("Concave polygon fill (1000 x 64-pt stars)");
+
+  std::vector<std::vector<Vec2>> polygons(POLYGON_COUNT);
+  for (size_t i = 0; i < POLYGON_COUNT; ++i) {
+    polygons[i] = makeStar(POLYGON_POINTS, 40.0f + static_cast<float>(i % 7),
+                           18.0f);
+  }
+  std::vector<Vec2> vertices((POLYGON_POINTS - 2) * 3);
+  std::vector<uint32_t> scratch;
+
+  double perFrame = bench::measureMs(3, 20, [&] {
+    for (const auto &poly : polygons) {
+      PolygonTriangulator::triangulate(poly, scratch);
+      emitTriangles(poly, scratch, vertices.data());
+    }
+    bench::doNotOptimize(vertices[0]);
+  });
+
+  std::vector<std::vector<uint32_t>> cached(POLYGON_COUNT);
+  for (size_t i = 0; i < POLYGON_COUNT; ++i) {
+    PolygonTriangulator::triangulate(polygons[i], cached[i]);
+  }
+  double reuse = bench::measureMs(3, 20, [&] {
+    for (size_t i = 0; i < POLYGON_COUNT; ++i) {
+      emitTriangles(polygons[i], cached[i], vertices.data());
+    }
+    bench::doNotOptimize(vertices[0]);
+  });
+
+  bench::report("ear clipping every frame", POLYGON_COUNT, perFrame,
+                "polygons");
+  bench::report("cached indices", POLYGON_COUNT, reuse, "polygons");
+}
@@ -0,0 +1,116 @@
+/**
+ * @file polyline_bench.cpp
+ * @brief 折线三角化基准测试
+ *
+ * 模拟大量不同线宽的调试线：原 GL_LINES 路径在线宽变化时必须刷新批次，
+ * 三角化路径把所有线宽写入同一批次
+ */
+
+#include "bench_common.h"
+
+#include <extra2d/graphics/polyline_tessellator.h>
+#include <random>
+#include <vector>
+
+using namespace extra2d;
+
+namespace {
+
+// 与 GLRenderer 形状批次容量一致
+constexpr size_t SHAPE_BATCH_VERTICES = 8192;
+
+struct DebugLine {
+  Vec2 start;
+  Vec2 end;
+  float width;
+};
+
+std::vector<DebugLine> makeLines(size_t count) {
+  std::mt19937 rng(3);
+  std::uniform_real_distribution<float> pos(0.0f, 1280.0f);
+  std::uniform_int_distribution<int> width(1, 4);
+  std::vector<DebugLine> lines(count);
+  for (auto &line : lines) {
+    line.start = Vec2(pos(rng), pos(rng));
+    line.end = Vec2(pos(rng), pos(rng));
+    line.width = static_cast<float>(width(rng));
+  }
+  return lines;
+}
+
+std::vector<Vec2> makePolyline(size_t count) {
+  std::mt19937 rng(5);
+  std::uniform_real_distribution<float> step(-40.0f, 40.0f);
+  std::vector<Vec2> points(count);
+  Vec2 p(640.0f, 360.0f);
+  for (auto &pt : points) {
+    p += Vec2(step(rng), step(rng));
+    pt = p;
+  }
+  return points;
+}
+
+/**
+ * @brief 原路径的批次数：相邻两条线线宽不同即刷新一次
+ */
+size_t legacyLineBatches(const std::vector<DebugLine> &lines) {
+  size_t batches = lines.empty() ? 0 : 1;
+  for (size_t i = 1; i < lines.size(); ++i) {
+    if (lines[i].width != lines[i - 1].width) {
+      ++batches;
+    }
+  }
+  return batches;
+}
+
+} // namespace
+
+/**
+ * @brief 5000 条混合线宽调试线 + 2000 顶点折线的三角化
+ */
+void runPolylineBench() {
+  constexpr size_t LINE_COUNT = 5000;
+  constexpr size_t POLYLINE_POINTS = 2000;
+  bench::section("Polyline tessellation");
+
+  auto lines = makeLines(LINE_COUNT);
+  PolylineTessellator tessellator;
+
+  double segments = bench::measureMs(5, 50, [&] {
+    tessellator.clear();
+    for (const auto &line : lines) {
+      tessellator.tessellateSegment(line.start, line.end, line.width);
+    }
+    bench::doNotOptimize(tessellator.getQuads().back());
+  });
+  bench::report("5000 mixed-width lines", LINE_COUNT, segments, "lines");
+  std::printf("  %-40s %10zu\n", "batches, GL_LINES (flush per width)",
+              legacyLineBatches(lines));
+  size_t vertices = 0;
+  for (const auto &q : tessellator.getQuads()) {
+    vertices += q.p[3] != q.p[2] ? 6 : 3;
+  }
+  std::printf("  %-40s %10zu\n", "batches, tessellated shape batch",
+              (vertices + SHAPE_BATCH_VERTICES - 1) / SHAPE_BATCH_VERTICES);
+
+  auto points = makePolyline(POLYLINE_POINTS);
+  const struct {
+    const char *name;
+    LineJoin join;
+  } joins[] = {{"2000-pt polyline, miter", LineJoin::Miter},
+               {"2000-pt polyline, bevel", LineJoin::Bevel},
+               {"2000-pt polyline, round", LineJoin::Round}};
+
+  for (const auto &j : joins) {
+    size_t quads = 0;
+    double ms = bench::measureMs(5, 50, [&] {
+      tessellator.clear();
+      tessellator.tessellate(points.data(), points.size(), 3.0f, false,
+                             j.join);
+      quads = tessellator.getQuads().size();
+      bench::doNotOptimize(tessellator.getQuads().back());
+    });
+    bench::report(j.name, POLYLINE_POINTS, ms, "points");
+    std::printf("  %-40s %10zu\n", "  quads emitted", quads);
+  }
+}
@@ -0,0 +1,159 @@
+/**
+ * @file sdf_shape_bench.cpp
+ * @brief SDF 形状基准测试
+ *
+ * 对比 fillCircle 的 CPU 扇形细分（每段 3 个顶点、2 次 cosf/sinf）、
+ * 单位圆查表 + 自动 LOD 的细分，以及每个圆只写一条 SDF 实例记录的
+ * 提交开销与上传字节数
+ */
+
+#include "bench_common.h"
+
+#include <cmath>
+#include <extra2d/graphics/opengl/gl_sdf_shape_batch.h>
+#include <extra2d/graphics/unit_circle.h>
+#include <random>
+#include <vector>
+
+using namespace extra2d;
+
+namespace {
+
+// 与 GLRenderer 形状批次的顶点格式一致
+struct ShapeVertex {
+  float x, y;
+  float r, g, b, a;
+};
+
+struct Circle {
+  float x, y, radius;
+};
+
+std::vector<Circle> makeCircles(size_t count) {
+  std::mt19937 rng(11);
+  std::uniform_real_distribution<float> pos(0.0f, 1280.0f);
+  std::uniform_real_distribution<float> radius(4.0f, 40.0f);
+  std::vector<Circle> circles(count);
+  for (auto &c : circles) {
+    c = Circle{pos(rng), pos(rng), radius(rng)};
+  }
+  return circles;
+}
+
+/**
+ * @brief 原路径：按 GLRenderer::fillCircle 逐段生成三角形
+ */
+size_t tessellateCircles(const std::vector<Circle> &circles, int segments,
+                         std::vector<ShapeVertex> &out) {
+  size_t n = 0;
+  for (const auto &c : circles) {
+    for (int i = 0; i < segments; ++i) {
+      float a1 = 2.0f * 3.14159f * static_cast<float>(i) /
+                 static_cast<float>(segments);
+      float a2 = 2.0f * 3.14159f * static_cast<float>(i + 1) /
+                 static_cast<float>(segments);
+      out[n++] = ShapeVertex{c.x, c.y, 1.0f, 1.0f, 1.0f, 1.0f};
+      out[n++] = ShapeVertex{c.x + c.radius * cosf(a1),
+                             c.y + c.radius * sinf(a1), 1.0f, 1.0f, 1.0f, 1.0f};
+      out[n++] = ShapeVertex{c.x + c.radius * cosf(a2),
+                             c.y + c.radius * sinf(a2), 1.0f, 1.0f, 1.0f, 1.0f};
+    }
+  }
+  return n;
+}
+
+/**
+ * @brief 查表路径：分段数为 <= 0 时按半径（1 单位 = 1 像素）自动选择
+ */
+size_t tessellateCirclesCached(const std::vector<Circle> &circles, int segments,
+                               UnitCircleCache &cache,
+                               std::vector<ShapeVertex> &out) {
+  size_t n = 0;
+  for (const auto &c : circles) {
+    int count = segments > 0 ? segments
+                             : UnitCircleCache::segmentsForRadius(c.radius);
+    const Vec2 *unit = cache.get(count);
+    for (int i = 0; i < count; ++i) {
+      out[n++] = ShapeVertex{c.x, c.y, 1.0f, 1.0f, 1.0f, 1.0f};
+      out[n++] = ShapeVertex{c.x + c.radius * unit[i].x,
+                             c.y + c.radius * unit[i].y, 1.0f, 1.0f, 1.0f,
+                             1.0f};
+      out[n++] = ShapeVertex{c.x + c.radius * unit[i + 1].x,
+                             c.y + c.radius * unit[i + 1].y, 1.0f, 1.0f, 1.0f,
+                             1.0f};
+    }
+  }
+  return n;
+}
+
+/**
+ * @brief SDF 路径：每个圆一条实例记录
+ */
+void writeSDFInstances(const std::vector<Circle> &circles,
+                       std::vector<GLSDFShapeBatch::InstanceData> &out) {
+  for (size_t i = 0; i < circles.size(); ++i) {
+    const auto &c = circles[i];
+    auto &inst = out[i];
+    inst.center = glm::vec2(c.x, c.y);
+    inst.axisX = glm::vec2(1.0f, 0.0f);
+    inst.axisY = glm::vec2(0.0f, 1.0f);
+    inst.halfSize = glm::vec2(c.radius, c.radius);
+    inst.radius = c.radius;
+    inst.thickness = 0.0f;
+    inst.color[0] = inst.color[1] = inst.color[2] = inst.color[3] = 255;
+    inst.kind = static_cast<uint8_t>(SDFShapeKind::Circle);
+  }
+}
+
+} // namespace
+
+/**
+ * @brief 10k 个 32 段填充圆
+ */
+void runSDFShapeBench() {
+  constexpr size_t CIRCLE_COUNT = 10000;
+  constexpr int SEGMENTS = 32;
+  bench::section("Filled circles (10k, 32 segments)");
+
+  auto circles = makeCircles(CIRCLE_COUNT);
+  std::vector<ShapeVertex> vertices(CIRCLE_COUNT *
+                                    UnitCircleCache::MAX_SEGMENTS * 3);
+  UnitCircleCache cache;
+  std::vector<GLSDFShapeBatch::InstanceData> instances(CIRCLE_COUNT);
+
+  size_t vertexCount = 0;
+  double tessellated = bench::measureMs(5, 50, [&] {
+    vertexCount = tessellateCircles(circles, SEGMENTS, vertices);
+    bench::doNotOptimize(vertices[vertexCount - 1]);
+  });
+  double cached = bench::measureMs(5, 50, [&] {
+    size_t n = tessellateCirclesCached(circles, SEGMENTS, cache, vertices);
+    bench::doNotOptimize(vertices[n - 1]);
+  });
+  size_t autoVertexCount = 0;
+  double autoLod = bench::measureMs(5, 50, [&] {
+    autoVertexCount = tessellateCirclesCached(circles, CIRCLE_SEGMENTS_AUTO,
+                                              cache, vertices);
+    bench::doNotOptimize(vertices[autoVertexCount - 1]);
+  });
+  double sdf = bench::measureMs(5, 50, [&] {
+    writeSDFInstances(circles, instances);
+    bench::doNotOptimize(instances.back());
+  });
+
+  bench::report("CPU triangle fan", CIRCLE_COUNT, tessellated, "circles");
+  bench::report("CPU triangle fan, unit-circle table", CIRCLE_COUNT, cached,
+                "circles");
+  bench::report("CPU triangle fan, auto LOD (r 4-40px)", CIRCLE_COUNT, autoLod,
+                "circles");
+  bench::report("SDF instance", CIRCLE_COUNT, sdf, "circles");
+  std::printf("  %-40s %10zu\n", "vertices per circle, triangle fan",
+              vertexCount / CIRCLE_COUNT);
+  std::printf("  %-40s %10zu\n", "vertices per circle, auto LOD (avg)",
+              autoVertexCount / CIRCLE_COUNT);
+  std::printf("  %-40s %10d\n", "vertices per circle, SDF quad", 4);
+  std::printf("  %-40s %10zu\n", "upload KiB, triangle fan",
+              vertexCount * sizeof(ShapeVertex) / 1024);
+  std::printf("  %-40s %10zu\n", "upload KiB, SDF instances",
+              instances.size() * sizeof(GLSDFShapeBatch::InstanceData) / 1024);
+}
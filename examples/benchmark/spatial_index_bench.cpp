@@ -0,0 +1,188 @@
+/**
+ * @file spatial_index_bench.cpp
+ * @brief 场景空间索引基准测试
+ *
+ * 20 万个精灵的场景：矩形、点与半径查询分别走空间索引与遍历整棵树，
+ * 以及每帧移动 1% 的精灵后增量更新索引的开销
+ */
+
+#include "bench_common.h"
+
+#include <extra2d/graphics/texture.h>
+#include <extra2d/scene/scene.h>
+#include <extra2d/scene/sprite.h>
+
+using namespace extra2d;
+
+namespace {
+
+constexpr size_t GRID_X = 500;
+constexpr size_t GRID_Y = 400;
+constexpr float SPACING = 32.0f;
+constexpr size_t QUERY_COUNT = 256;
+
+/**
+ * @brief 不持有 GPU 资源的纹理
+ */
+class FakeTexture : public Texture {
+public:
+  int getWidth() const override { return 24; }
+  int getHeight() const override { return 24; }
+  Size getSize() const override { return Size(24.0f, 24.0f); }
+  int getChannels() const override { return 4; }
+  PixelFormat getFormat() const override { return PixelFormat::RGBA8; }
+  void *getNativeHandle() const override { return nullptr; }
+  bool isValid() const override { return true; }
+  void setFilter(bool) override {}
+  void setWrap(bool) override {}
+};
+
+/**
+ * @brief 构建场景：根下 GRID_Y 行分组，每行 GRID_X 个精灵
+ */
+Ptr<Scene> buildScene(const Ptr<Texture> &texture,
+                      std::vector<Ptr<Sprite>> &sprites) {
+  auto scene = Scene::create();
+  for (size_t y = 0; y < GRID_Y; ++y) {
+    auto row = makePtr<Node>();
+    row->setPos(0.0f, y * SPACING);
+    for (size_t x = 0; x < GRID_X; ++x) {
+      auto sprite = Sprite::create(texture);
+      sprite->setPos(x * SPACING, 0.0f);
+      row->addChild(sprite);
+      sprites.push_back(sprite);
+    }
+    scene->addChild(row);
+  }
+  scene->onAttachToScene(scene.get());
+  scene->batchTransforms();
+  return scene;
+}
+
+/**
+ * @brief 遍历整棵树做同样的查询，作为对照
+ */
+template <typename Pred>
+void linearQuery(Node &node, Pred &&pred, std::vector<Node *> &out) {
+  for (const auto &child : node.getChildren()) {
+    Rect bounds;
+    if (child->getWorldBounds(bounds) && pred(bounds)) {
+      out.push_back(child.get());
+    }
+    linearQuery(*child, pred, out);
+  }
+}
+
+Vec2 queryPointAt(size_t i) {
+  return Vec2(static_cast<float>((i * 7919) % (GRID_X * 32)),
+              static_cast<float>((i * 104729) % (GRID_Y * 32)));
+}
+
+} // namespace
+
+/**
+ * @brief 20 万节点的索引查询与增量更新
+ */
+void runSpatialIndexBench() {
+  bench::section("Scene spatial index (200000 sprites)");
+
+  auto texture = makePtr<FakeTexture>();
+  std::vector<Ptr<Sprite>> sprites;
+  sprites.reserve(GRID_X * GRID_Y);
+  Ptr<Scene> scene = buildScene(texture, sprites);
+  std::vector<Node *> results;
+  results.reserve(4096);
+
+  double buildMs = bench::measureMs(1, 1, [&] {
+    scene->setSpatialIndexing(false);
+    scene->setSpatialIndexing(true);
+    scene->updateSpatialIndex();
+  });
+  bench::report("enable + initial refresh", scene->getSpatialIndex().size(),
+                buildMs, "nodes");
+  std::printf("    cells %zu, cell size %.0f\n",
+              scene->getSpatialIndex().getCellCount(),
+              scene->getSpatialIndex().getCellSize());
+
+  // 视口大小的矩形查询
+  size_t indexHits = 0;
+  double rectIndex = bench::measureMs(3, 5, [&] {
+    indexHits = 0;
+    for (size_t i = 0; i < QUERY_COUNT; ++i) {
+      results.clear();
+      Vec2 p = queryPointAt(i);
+      scene->queryRect(Rect(p.x, p.y, 1280.0f, 720.0f), results);
+      indexHits += results.size();
+    }
+  });
+  size_t linearHits = 0;
+  double rectLinear = bench::measureMs(1, 1, [&] {
+    linearHits = 0;
+    for (size_t i = 0; i < 8; ++i) {
+      results.clear();
+      Vec2 p = queryPointAt(i);
+      Rect rect(p.x, p.y, 1280.0f, 720.0f);
+      linearQuery(*scene, [&](const Rect &b) { return b.intersects(rect); },
+                  results);
+      linearHits += results.size();
+    }
+  });
+  bench::report("queryRect 1280x720 (index)", QUERY_COUNT, rectIndex,
+                "queries");
+  bench::report("queryRect 1280x720 (tree walk)", 8, rectLinear, "queries");
+
+  // 同样的 8 次查询，两种方式的命中数应一致
+  size_t sameQueryHits = 0;
+  for (size_t i = 0; i < 8; ++i) {
+    results.clear();
+    Vec2 p = queryPointAt(i);
+    scene->queryRect(Rect(p.x, p.y, 1280.0f, 720.0f), results);
+    sameQueryHits += results.size();
+  }
+  std::printf("    avg hits %.1f, tree walk hits match: %s\n",
+              static_cast<double>(indexHits) / QUERY_COUNT,
+              sameQueryHits == linearHits ? "yes" : "NO");
+
+  double pointIndex = bench::measureMs(3, 5, [&] {
+    for (size_t i = 0; i < QUERY_COUNT; ++i) {
+      results.clear();
+      scene->queryPoint(queryPointAt(i), results);
+      bench::doNotOptimize(results.data());
+    }
+  });
+  double pointLinear = bench::measureMs(1, 1, [&] {
+    for (size_t i = 0; i < 8; ++i) {
+      results.clear();
+      Vec2 p = queryPointAt(i);
+      linearQuery(*scene, [&](const Rect &b) { return b.containsPoint(p); },
+                  results);
+      bench::doNotOptimize(results.data());
+    }
+  });
+  bench::report("queryPoint (index)", QUERY_COUNT, pointIndex, "queries");
+  bench::report("queryPoint (tree walk)", 8, pointLinear, "queries");
+
+  double radiusIndex = bench::measureMs(3, 5, [&] {
+    for (size_t i = 0; i < QUERY_COUNT; ++i) {
+      results.clear();
+      scene->queryRadius(queryPointAt(i), 200.0f, results);
+      bench::doNotOptimize(results.data());
+    }
+  });
+  bench::report("queryRadius r=200 (index)", QUERY_COUNT, radiusIndex,
+                "queries");
+
+  // 每帧移动 1% 的精灵：标记为脏，下一次查询前增量更新
+  const size_t moved = sprites.size() / 100;
+  int frame = 0;
+  double updateMs = bench::measureMs(3, 10, [&] {
+    float dx = (frame++ % 2) ? -20.0f : 20.0f;
+    for (size_t i = 0; i < moved; ++i) {
+      Sprite &sprite = *sprites[(i * 97) % sprites.size()];
+      sprite.setPos(sprite.getPosition() + Vec2(dx, 3.0f));
+    }
+    scene->updateSpatialIndex();
+  });
+  bench::report("move 1% of sprites + updateSpatialIndex", moved, updateMs,
+                "nodes");
+}
@@ -0,0 +1,176 @@
+/**
+ * @file sprite_kernel_bench.cpp
+ * @brief 精灵顶点计算内核基准测试
+ *
+ * 对比原有逐精灵查表路径、标量查表内核与 SIMD 内核的吞吐（含单精灵调用
+ * 与只有尾部的短批次），
+ * 以及大批量时按线程池切分后的吞吐
+ */
+
+#include "bench_common.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <extra2d/graphics/opengl/gl_sprite_kernel.h>
+#include <extra2d/utils/thread_pool.h>
+#include <random>
+#include <vector>
+
+using namespace extra2d;
+
+namespace {
+
+/**
+ * @brief 原有 addVertices 的角点计算方式（0.25 度精度 sin/cos 查表）
+ */
+struct LegacyTrigTable {
+  static constexpr size_t TABLE_SIZE = 360 * 4;
+  static constexpr float RAD_TO_INDEX = 4.0f * 180.0f / 3.14159265359f;
+  std::array<float, TABLE_SIZE> sinTable;
+  std::array<float, TABLE_SIZE> cosTable;
+
+  LegacyTrigTable() {
+    for (size_t i = 0; i < TABLE_SIZE; ++i) {
+      float angle = static_cast<float>(i) / 4.0f * 3.14159265359f / 180.0f;
+      sinTable[i] = std::sin(angle);
+      cosTable[i] = std::cos(angle);
+    }
+  }
+
+  size_t index(float radians) const {
+    int idx = static_cast<int>(radians * RAD_TO_INDEX) %
+              static_cast<int>(TABLE_SIZE);
+    return static_cast<size_t>(idx < 0 ? idx + static_cast<int>(TABLE_SIZE)
+                                       : idx);
+  }
+};
+
+void legacyCorners(const LegacyTrigTable &table,
+                   const GLSpriteBatch::SpriteData *sprites, size_t count,
+                   SpriteCorners *out) {
+  for (size_t i = 0; i < count; ++i) {
+    const auto &d = sprites[i];
+    size_t idx = table.index(d.rotation);
+    float c = table.cosTable[idx];
+    float s = table.sinTable[idx];
+    float rx0 = -d.size.x * d.anchor.x;
+    float ry0 = -d.size.y * d.anchor.y;
+    float rx1 = d.size.x + rx0;
+    float ry1 = d.size.y + ry0;
+    const float rx[4] = {rx0, rx1, rx1, rx0};
+    const float ry[4] = {ry0, ry0, ry1, ry1};
+    for (int k = 0; k < 4; ++k) {
+      out[i].x[k] = d.position.x + rx[k] * c - ry[k] * s;
+      out[i].y[k] = d.position.y + rx[k] * s + ry[k] * c;
+    }
+  }
+}
+
+std::vector<GLSpriteBatch::SpriteData> makeSprites(size_t count,
+                                                   bool rotated) {
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<float> pos(0.0f, 1280.0f);
+  std::uniform_real_distribution<float> angle(-3.14159f, 3.14159f);
+  std::vector<GLSpriteBatch::SpriteData> sprites(count);
+  for (auto &s : sprites) {
+    s.position = glm::vec2(pos(rng), pos(rng));
+    s.size = glm::vec2(32.0f, 32.0f);
+    s.texCoordMin = glm::vec2(0.0f, 0.0f);
+    s.texCoordMax = glm::vec2(1.0f, 1.0f);
+    s.color = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f);
+    s.rotation = rotated ? angle(rng) : 0.0f;
+    s.anchor = glm::vec2(0.5f, 0.5f);
+  }
+  return sprites;
+}
+
+} // namespace
+
+/**
+ * @brief 精灵角点内核基准：20k 精灵 / 帧
+ */
+void runSpriteKernelBench() {
+  constexpr size_t SPRITE_COUNT = 20000;
+  constexpr size_t SHORT_RUN = 7;
+  bench::section("Sprite vertex kernel (20k sprites)");
+  std::printf("  active kernel: %s\n", getSpriteKernelName());
+
+  LegacyTrigTable table;
+  std::vector<SpriteCorners> corners(SPRITE_COUNT);
+
+  for (bool rotated : {false, true}) {
+    auto sprites = makeSprites(SPRITE_COUNT, rotated);
+    const char *tag = rotated ? "rotated" : "axis-aligned";
+
+    double legacy = bench::measureMs(5, 50, [&] {
+      legacyCorners(table, sprites.data(), sprites.size(), corners.data());
+      bench::doNotOptimize(corners[0]);
+    });
+    double scalar = bench::measureMs(5, 50, [&] {
+      computeSpriteCornersScalar(sprites.data(), sprites.size(),
+                                 corners.data());
+      bench::doNotOptimize(corners[0]);
+    });
+    double simd = bench::measureMs(5, 50, [&] {
+      computeSpriteCorners(sprites.data(), sprites.size(), corners.data());
+      bench::doNotOptimize(corners[0]);
+    });
+
+    // 单个精灵逐次调用（draw() 单精灵路径）与不满一个 SIMD 块的短批次
+    double single = bench::measureMs(5, 50, [&] {
+      for (size_t i = 0; i < sprites.size(); ++i) {
+        computeSpriteCornersScalar(&sprites[i], 1, &corners[i]);
+      }
+      bench::doNotOptimize(corners[0]);
+    });
+    double runs = bench::measureMs(5, 50, [&] {
+      for (size_t i = 0; i < sprites.size(); i += SHORT_RUN) {
+        size_t n = std::min(SHORT_RUN, sprites.size() - i);
+        computeSpriteCorners(&sprites[i], n, &corners[i]);
+      }
+      bench::doNotOptimize(corners[0]);
+    });
+
+    bench::report(std::string("legacy table lookup, ") + tag, SPRITE_COUNT,
+                  legacy, "sprites");
+    bench::report(std::string("scalar kernel, ") + tag, SPRITE_COUNT, scalar,
+                  "sprites");
+    bench::report(std::string("scalar kernel, one sprite per call, ") + tag,
+                  SPRITE_COUNT, single, "sprites");
+    bench::report(std::string("SIMD kernel, ") + tag, SPRITE_COUNT, simd,
+                  "sprites");
+    bench::report(std::string("SIMD kernel, runs of 7 (tails), ") + tag,
+                  SPRITE_COUNT, runs, "sprites");
+  }
+}
+
+/**
+ * @brief 大批量角点计算的多线程扩展：100k 旋转精灵 / 帧
+ */
+void runSpriteParallelBench() {
+  constexpr size_t SPRITE_COUNT = 100000;
+  bench::section("Sprite vertex kernel, parallel (100k sprites)");
+
+  ThreadPool &pool = ThreadPool::get();
+  std::printf("  worker threads: %zu (+ calling thread)\n",
+              pool.getWorkerCount());
+
+  auto sprites = makeSprites(SPRITE_COUNT, true);
+  std::vector<SpriteCorners> corners(SPRITE_COUNT);
+
+  double single = bench::measureMs(5, 20, [&] {
+    computeSpriteCorners(sprites.data(), sprites.size(), corners.data());
+    bench::doNotOptimize(corners[0]);
+  });
+  double parallel = bench::measureMs(5, 20, [&] {
+    pool.parallelFor(sprites.size(), 1024, [&](size_t begin, size_t end) {
+      computeSpriteCorners(sprites.data() + begin, end - begin,
+                           corners.data() + begin);
+    });
+    bench::doNotOptimize(corners[0]);
+  });
+
+  bench::report("single thread", SPRITE_COUNT, single, "sprites");
+  bench::report("thread pool", SPRITE_COUNT, parallel, "sprites");
+}
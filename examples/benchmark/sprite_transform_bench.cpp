@@ -0,0 +1,108 @@
+/**
+ * @file sprite_transform_bench.cpp
+ * @brief 精灵世界变换提交方式基准测试
+ *
+ * 对比原有"分解世界矩阵为位置/缩放/旋转再由 sin/cos 重建"的路径
+ * 与直接用 2x3 仿射矩阵变换四个角点的路径
+ */
+
+#include "bench_common.h"
+
+#include <cmath>
+#include <extra2d/core/math_types.h>
+#include <extra2d/graphics/opengl/gl_sprite_kernel.h>
+#include <glm/gtc/matrix_transform.hpp>
+#include <random>
+#include <vector>
+
+using namespace extra2d;
+
+namespace {
+
+struct SpriteInstance {
+  glm::mat4 world;
+  glm::vec2 size;
+  glm::vec2 anchor;
+};
+
+std::vector<SpriteInstance> makeInstances(size_t count) {
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> pos(0.0f, 1280.0f);
+  std::uniform_real_distribution<float> angle(-180.0f, 180.0f);
+  std::uniform_real_distribution<float> scale(0.5f, 2.0f);
+  std::vector<SpriteInstance> instances(count);
+  for (auto &inst : instances) {
+    glm::mat4 m(1.0f);
+    m = glm::translate(m, glm::vec3(pos(rng), pos(rng), 0.0f));
+    m = glm::rotate(m, angle(rng) * DEG_TO_RAD, glm::vec3(0.0f, 0.0f, 1.0f));
+    m = glm::scale(m, glm::vec3(scale(rng), scale(rng), 1.0f));
+    inst.world = m;
+    inst.size = glm::vec2(32.0f, 32.0f);
+    inst.anchor = glm::vec2(0.5f, 0.5f);
+  }
+  return instances;
+}
+
+/**
+ * @brief 原有路径：length x2 + atan2 得到缩放与旋转，再由 sin/cos 重建角点
+ */
+void decomposeCorners(const std::vector<SpriteInstance> &instances,
+                      SpriteCorners *out) {
+  for (size_t i = 0; i < instances.size(); ++i) {
+    const auto &inst = instances[i];
+    const glm::mat4 &m = inst.world;
+    GLSpriteBatch::SpriteData d;
+    d.position = glm::vec2(m[3][0], m[3][1]);
+    d.size = glm::vec2(inst.size.x * glm::length(glm::vec2(m[0][0], m[0][1])),
+                       inst.size.y * glm::length(glm::vec2(m[1][0], m[1][1])));
+    d.rotation = std::atan2(m[0][1], m[0][0]);
+    d.anchor = inst.anchor;
+    computeSpriteCornersScalar(&d, 1, &out[i]);
+  }
+}
+
+/**
+ * @brief 仿射路径：局部四边形直接经 2x3 矩阵变换
+ */
+void affineCorners(const std::vector<SpriteInstance> &instances,
+                   SpriteCorners *out) {
+  for (size_t i = 0; i < instances.size(); ++i) {
+    const auto &inst = instances[i];
+    Affine2D m = Affine2D::fromMat4(inst.world);
+    float x0 = -inst.size.x * inst.anchor.x;
+    float y0 = -inst.size.y * inst.anchor.y;
+    float x1 = x0 + inst.size.x;
+    float y1 = y0 + inst.size.y;
+    const float lx[4] = {x0, x1, x1, x0};
+    const float ly[4] = {y0, y0, y1, y1};
+    for (int k = 0; k < 4; ++k) {
+      out[i].x[k] = m.a * lx[k] + m.c * ly[k] + m.tx;
+      out[i].y[k] = m.b * lx[k] + m.d * ly[k] + m.ty;
+    }
+  }
+}
+
+} // namespace
+
+/**
+ * @brief 世界矩阵 -> 角点：20k 旋转且非等比缩放的精灵
+ */
+void runSpriteTransformBench() {
+  constexpr size_t SPRITE_COUNT = 20000;
+  bench::section("Sprite world transform -> corners (20k sprites)");
+
+  auto instances = makeInstances(SPRITE_COUNT);
+  std::vector<SpriteCorners> corners(SPRITE_COUNT);
+
+  double decompose = bench::measureMs(5, 50, [&] {
+    decomposeCorners(instances, corners.data());
+    bench::doNotOptimize(corners[0]);
+  });
+  double affine = bench::measureMs(5, 50, [&] {
+    affineCorners(instances, corners.data());
+    bench::doNotOptimize(corners[0]);
+  });
+
+  bench::report("decompose + sin/cos", SPRITE_COUNT, decompose, "sprites");
+  bench::report("affine 2x3", SPRITE_COUNT, affine, "sprites");
+}
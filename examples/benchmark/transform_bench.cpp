@@ -0,0 +1,139 @@
+/**
+ * @file transform_bench.cpp
+ * @brief 变换层级更新基准测试
+ *
+ * 20 万个节点（500 个分组 x 400 个精灵）：全部节点移动、1% 节点移动与
+ * 单个分组移动后 batchTransforms 的耗时，以及深层节点按需读取世界变换
+ */
+
+#include "bench_common.h"
+
+#include <extra2d/graphics/texture.h>
+#include <extra2d/scene/node.h>
+#include <extra2d/scene/sprite.h>
+
+using namespace extra2d;
+
+namespace {
+
+constexpr size_t GROUPS = 500;
+constexpr size_t GROUP_SPRITES = 400;
+constexpr size_t CHAIN_DEPTH = 64;
+
+/**
+ * @brief 不持有 GPU 资源的纹理
+ */
+class FakeTexture : public Texture {
+public:
+  int getWidth() const override { return 32; }
+  int getHeight() const override { return 32; }
+  Size getSize() const override { return Size(32.0f, 32.0f); }
+  int getChannels() const override { return 4; }
+  PixelFormat getFormat() const override { return PixelFormat::RGBA8; }
+  void *getNativeHandle() const override { return nullptr; }
+  bool isValid() const override { return true; }
+  void setFilter(bool) override {}
+  void setWrap(bool) override {}
+};
+
+/**
+ * @brief 构建根节点 - 分组 - 精灵三层结构（分组在精灵之后创建）
+ */
+Ptr<Node> buildTree(const Ptr<Texture> &texture,
+                    std::vector<Ptr<Sprite>> &sprites) {
+  auto root = makePtr<Node>();
+  for (size_t g = 0; g < GROUPS; ++g) {
+    std::vector<Ptr<Node>> children;
+    children.reserve(GROUP_SPRITES);
+    for (size_t i = 0; i < GROUP_SPRITES; ++i) {
+      auto sprite = Sprite::create(texture);
+      sprite->setPos(static_cast<float>(i % 20) * 40.0f,
+                     static_cast<float>(i / 20) * 40.0f);
+      sprite->setRotation(static_cast<float>(i % 8) * 11.25f);
+      children.push_back(sprite);
+      sprites.push_back(sprite);
+    }
+    auto group = makePtr<Node>();
+    group->setPos(static_cast<float>(g % 25) * 800.0f,
+                  static_cast<float>(g / 25) * 800.0f);
+    group->addChildren(std::move(children));
+    root->addChild(group);
+  }
+  root->batchTransforms();
+  return root;
+}
+
+} // namespace
+
+/**
+ * @brief 变换层级的批量更新与按需读取
+ */
+void runTransformBench() {
+  bench::section("Transform hierarchy (200000 nodes)");
+
+  auto texture = makePtr<FakeTexture>();
+  std::vector<Ptr<Sprite>> sprites;
+  sprites.reserve(GROUPS * GROUP_SPRITES);
+  Ptr<Node> root = buildTree(texture, sprites);
+  const auto &groups = root->getChildren();
+
+  int frame = 0;
+  double allMs = bench::measureMs(3, 5, [&] {
+    float dx = (frame++ % 2) ? -1.0f : 1.0f;
+    for (auto &sprite : sprites) {
+      sprite->setPos(sprite->getPosition() + Vec2(dx, 0.0f));
+    }
+    root->batchTransforms();
+  });
+  bench::report("move all sprites + batchTransforms", sprites.size(), allMs,
+                "nodes");
+
+  double batchOnlyMs = bench::measureMs(3, 5, [&] {
+    for (auto &sprite : sprites) {
+      sprite->markTransformDirty();
+    }
+    root->batchTransforms();
+  });
+  bench::report("mark all dirty + batchTransforms", sprites.size(),
+                batchOnlyMs, "nodes");
+
+  const size_t moved = sprites.size() / 100;
+  double sparseMs = bench::measureMs(3, 10, [&] {
+    float dx = (frame++ % 2) ? -1.0f : 1.0f;
+    for (size_t i = 0; i < moved; ++i) {
+      Sprite &sprite = *sprites[(i * 97) % sprites.size()];
+      sprite.setPos(sprite.getPosition() + Vec2(dx, 0.0f));
+    }
+    root->batchTransforms();
+  });
+  bench::report("move 1% of sprites + batchTransforms", moved, sparseMs,
+                "nodes");
+
+  double groupMs = bench::measureMs(3, 10, [&] {
+    Node &group = *groups[static_cast<size_t>(frame++) % groups.size()];
+    group.setPos(group.getPosition() + Vec2(1.0f, 0.0f));
+    root->batchTransforms();
+  });
+  bench::report("move one group (400 children) + batchTransforms",
+                GROUP_SPRITES, groupMs, "nodes");
+
+  double cleanMs = bench::measureMs(3, 20, [&] { root->batchTransforms(); });
+  bench::report("batchTransforms, nothing dirty", sprites.size(), cleanMs,
+                "nodes");
+
+  // 深层链：移动链首后按需读取链尾的世界变换
+  std::vector<Ptr<Node>> chain;
+  chain.push_back(makePtr<Node>());
+  for (size_t i = 1; i < CHAIN_DEPTH; ++i) {
+    auto node = makePtr<Node>();
+    node->setPos(1.0f, 0.0f);
+    chain.back()->addChild(node);
+    chain.push_back(node);
+  }
+  double chainMs = bench::measureMs(3, 1000, [&] {
+    chain.front()->setPos(static_cast<float>(frame++ % 7), 0.0f);
+    bench::doNotOptimize(chain.back()->getWorldTransform());
+  });
+  bench::report("lazy getWorldTransform, depth 64 chain", CHAIN_DEPTH,
+                chainMs, "nodes");
+}
@@ -190,3 +190,25 @@ target("demo_hello_module")
     -- 构建后安装Shader文件
     after_build(install_shaders)
 target_end()
+
+-- 性能基准测试 - 纯 CPU 基准，不依赖窗口
+target("benchmark")
+    set_kind("binary")
+    set_default(false)
+    
+    add_deps("extra2d")
+    add_files("examples/benchmark/*.cpp")
+    
+    -- 平台配置
+    local plat = get_config("plat") or os.host()
+    if plat == "mingw" or plat == "windows" then
+        add_packages("glm", "nlohmann_json", "libsdl2")
+        add_syslinks("opengl32", "glu32", "winmm", "imm32", "version", "setupapi")
+    elseif plat == "linux" then
+        add_packages("glm", "nlohmann_json", "libsdl2")
+        add_syslinks("GL", "dl", "pthread")
+    elseif plat == "macosx" then
+        add_packages("glm", "nlohmann_json", "libsdl2")
+        add_frameworks("OpenGL", "Cocoa", "IOKit", "CoreVideo")
+    end
+target_end()